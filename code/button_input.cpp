@@ -0,0 +1,69 @@
+// button_input.cpp - Button ISR, edge queue and debounce
+#include "button_input.h"
+#include "spsc_ring.h"
+
+// ESP32 runs the ISR from IRAM; other cores (AVR) have no such attribute.
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+struct ButtonEdge {
+	unsigned long us;
+	uint8_t level;
+};
+
+static SpscRing<ButtonEdge, 16> g_edges;
+static volatile unsigned long g_droppedEdges = 0;
+static uint8_t g_isrPin = 0;
+
+static void IRAM_ATTR onButtonEdge() {
+	ButtonEdge e{micros(), (uint8_t)digitalRead(g_isrPin)};
+	if (!g_edges.push(e)) g_droppedEdges = g_droppedEdges + 1;
+}
+
+void ButtonInput::begin(uint8_t pin) {
+	m_pin = pin;
+	g_isrPin = pin;
+	pinMode(pin, INPUT_PULLUP);
+	m_level = m_rawLevel = (uint8_t)digitalRead(pin);
+	m_acceptedUs = m_rawUs = micros();
+	attachInterrupt(digitalPinToInterrupt(pin), onButtonEdge, CHANGE);
+}
+
+void ButtonInput::accept(uint8_t level, unsigned long us) {
+	m_acceptedUs = us;
+	if (level == m_level) return;
+	m_level = level;
+	if (level == LOW) {
+		m_pressPending = true;
+		m_pressUs = us;
+	}
+}
+
+void ButtonInput::update() {
+	const unsigned long window = (unsigned long)BUTTON_DEBOUNCE_MS * 1000UL;
+	ButtonEdge e;
+	while (g_edges.pop(e)) {
+		m_rawLevel = e.level;
+		m_rawUs = e.us;
+		if (e.level != m_level && e.us - m_acceptedUs >= window) accept(e.level, e.us);
+	}
+	// A bounce inside the window may have left the pin in the other state.
+	if (m_rawLevel != m_level && micros() - m_rawUs >= window) accept(m_rawLevel, m_rawUs);
+}
+
+bool ButtonInput::takePress(unsigned long *edgeUs) {
+	if (!m_pressPending) return false;
+	m_pressPending = false;
+	if (edgeUs) *edgeUs = m_pressUs;
+	return true;
+}
+
+void ButtonInput::recordLatency(unsigned long us) {
+	m_lastLatencyUs = us;
+	if (us > m_maxLatencyUs) m_maxLatencyUs = us;
+}
+
+unsigned long ButtonInput::droppedEdges() const {
+	return g_droppedEdges;
+}
@@ -0,0 +1,48 @@
+// button_input.h - Interrupt-driven push button with consumer-side debounce
+//
+// A CHANGE interrupt on the pin timestamps every edge into an SpscRing; the
+// ISR does nothing else. update() drains the ring from the main loop and
+// debounces: an edge is accepted immediately (leading edge) unless it falls
+// within BUTTON_DEBOUNCE_MS of the last accepted one, and a level that
+// settles after a bounce is picked up once the pin has been quiet that long.
+#ifndef BUTTON_INPUT_H
+#define BUTTON_INPUT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+class ButtonInput {
+ public:
+  // Active-low button with the internal pull-up. Only one instance may exist.
+  void begin(uint8_t pin);
+  // Drain queued edges; call every scheduler pass.
+  void update();
+
+  // Debounced state.
+  bool pressed() const { return m_level == LOW; }
+  // True once per debounced press; `edgeUs` gets the micros() stamp the ISR
+  // took on the press edge, for measuring press-to-action latency.
+  bool takePress(unsigned long *edgeUs = nullptr);
+
+  // Latency bookkeeping for whoever acts on a press.
+  void recordLatency(unsigned long us);
+  unsigned long lastLatencyUs() const { return m_lastLatencyUs; }
+  unsigned long maxLatencyUs() const { return m_maxLatencyUs; }
+  // Edges lost because the ring was full (main loop stalled for a long time).
+  unsigned long droppedEdges() const;
+
+ private:
+  void accept(uint8_t level, unsigned long us);
+
+  uint8_t m_pin = 0;
+  uint8_t m_level = HIGH;      // debounced
+  uint8_t m_rawLevel = HIGH;   // last edge seen
+  unsigned long m_rawUs = 0;
+  unsigned long m_acceptedUs = 0;
+  bool m_pressPending = false;
+  unsigned long m_pressUs = 0;
+  unsigned long m_lastLatencyUs = 0;
+  unsigned long m_maxLatencyUs = 0;
+};
+
+#endif // BUTTON_INPUT_H
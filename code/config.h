@@ -10,6 +10,7 @@
 #define SPEAKER_PIN 3
 #define LED_PIN 13
 #define BUTTON_PIN 2
+#define BUTTON_DEBOUNCE_MS 20
 
 // Audio Configuration
 #define SAMPLE_RATE 16000
@@ -22,7 +23,18 @@
 // ML Model Configuration
 #define MODEL_INPUT_SIZE 128
 #define MODEL_OUTPUT_SIZE 10
+#define MODEL_HIDDEN_SIZE 32   // hidden layer of the int8 network (code/neural_model.h)
 #define CONFIDENCE_THRESHOLD 0.7
+// Static arena for the int8 network's activations: the input and hidden
+// layers are live together, then the logits reuse the input's bytes.
+#define MODEL_TENSOR_ARENA_SIZE (MODEL_INPUT_SIZE + MODEL_HIDDEN_SIZE)
+
+// Exported scikit-learn classifier (code/linear_model_data.cpp), consulted when
+// no keyword matches. Below LINEAR_MIN_CONFIDENCE the query stays Unknown.
+#ifndef USE_LINEAR_MODEL
+#define USE_LINEAR_MODEL 1
+#endif
+#define LINEAR_MIN_CONFIDENCE 0.25
 
 // System Settings
 #define SERIAL_BAUD_RATE 115200
@@ -30,6 +42,15 @@
 
 // Timing Constants
 #define RESPONSE_TIMEOUT 5000  // 5 seconds
-#define LISTEN_DURATION 3000   // 3 seconds
+#define LISTEN_DURATION 3000   // 3 seconds: give up if no speech starts by then
+
+// Voice activity detection (esp32/vad.h). Levels are normalized frame RMS;
+// ratios are relative to the adaptive noise floor.
+#define VAD_START_RATIO   3.0f   // speech starts above floor * 3 (+9.5 dB)
+#define VAD_STOP_RATIO    1.8f   // and continues while above floor * 1.8
+#define VAD_MIN_LEVEL     0.002f // never trigger below this (-54 dBFS)
+#define VAD_ATTACK_MS     64     // loud this long before speech is confirmed
+#define VAD_HANGOVER_MS   480    // quiet this long before the utterance ends
+#define VAD_MAX_UTTERANCE_MS 10000
 
 #endif
@@ -0,0 +1,27 @@
+// faq_answers.h - GENERATED by tools/gen_faq_answers.py from
+// database/faq.csv and database/faq.json; do not edit.
+#ifndef FAQ_ANSWERS_H
+#define FAQ_ANSWERS_H
+
+#include <Arduino.h>
+#include "intents.h"
+
+static const char FAQ_ANSWER_0[] PROGMEM = "You need to have completed 12th grade with minimum 75% marks and pass the entrance exam."; // requirements
+static const char FAQ_ANSWER_1[] PROGMEM = "The admission deadline is March 31st, 2026."; // deadline
+static const char FAQ_ANSWER_2[] PROGMEM = "The application fee is $50 for domestic students and $100 for international students."; // fee
+static const char FAQ_ANSWER_3[] PROGMEM = "Visit our official website, create an account, fill the application form, and submit required documents."; // process
+static const char FAQ_ANSWER_4[] PROGMEM = "You need transcripts, ID proof, passport photo, and entrance exam scorecard."; // documents
+static const char FAQ_ANSWER_5[] PROGMEM = "Yes, we offer scholarships based on merit and need. Contact the financial aid office for details."; // financial_aid
+static const char FAQ_ANSWER_6[] PROGMEM = "We offer undergraduate programs in Engineering, Business, Arts, and Science."; // programs
+static const char FAQ_ANSWER_7[] PROGMEM = "Classes for the new academic year start in September."; // schedule
+static const char FAQ_ANSWER_8[] PROGMEM = "Hello! I'm your admission assistant. How can I help you today?"; // greeting
+static const char FAQ_ANSWER_9[] PROGMEM = "I'm sorry, I didn't understand your question. Please ask about admissions, requirements, deadlines, fees, or application process."; // unknown
+
+// Indexed by Intent; the last entry answers Intent::Unknown.
+static const char *const FAQ_ANSWERS[INTENT_COUNT + 1] PROGMEM = {
+  FAQ_ANSWER_0, FAQ_ANSWER_1, FAQ_ANSWER_2, FAQ_ANSWER_3,
+  FAQ_ANSWER_4, FAQ_ANSWER_5, FAQ_ANSWER_6, FAQ_ANSWER_7,
+  FAQ_ANSWER_8, FAQ_ANSWER_9,
+};
+
+#endif // FAQ_ANSWERS_H
@@ -0,0 +1,150 @@
+// faq_db.cpp - Header check and bounded lookups over a mapped FAQ image
+#include "faq_db.h"
+
+#define FAQ_DB_MAGIC   0x44514146UL   // "FAQD"
+#define FAQ_DB_VERSION 1
+
+// Written by tools/gen_faq_db.py; every target that maps it is little-endian.
+struct FaqDbHeader {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t categoryCount;
+	uint32_t faqCount;
+	uint32_t keywordCount;
+	uint32_t stringsOffset;
+	uint32_t stringBytes;
+	uint32_t bytes;      // whole image
+	uint32_t checksum;   // FNV-1a over bytes [sizeof(header), bytes)
+};
+static_assert(sizeof(FaqDbHeader) == 32, "header layout is shared with tools/gen_faq_db.py");
+
+struct FaqDbCategory {
+	uint32_t name;       // string refs
+	uint32_t answer;
+	uint32_t firstFaq;
+	uint32_t faqCount;
+};
+static_assert(sizeof(FaqDbCategory) == 16, "category layout is shared with tools/gen_faq_db.py");
+
+struct FaqDbFaq {
+	uint32_t id;
+	uint32_t question;
+	uint32_t answer;
+	uint32_t firstKeyword;
+	uint16_t keywordCount;
+	uint16_t category;
+};
+static_assert(sizeof(FaqDbFaq) == 20, "FAQ layout is shared with tools/gen_faq_db.py");
+
+bool FaqDb::attach(const void *image, size_t size) {
+	detach();
+	if (!image || size < sizeof(FaqDbHeader)) return false;
+	const uint8_t *base = static_cast<const uint8_t *>(image);
+	FaqDbHeader hdr;
+	memcpy(&hdr, base, sizeof(hdr));
+	// 64-bit sums: counts come from the image and must not wrap.
+	uint64_t tables = sizeof(hdr) + (uint64_t)hdr.categoryCount * sizeof(FaqDbCategory) +
+	                  (uint64_t)hdr.faqCount * sizeof(FaqDbFaq) + (uint64_t)hdr.keywordCount * sizeof(uint32_t);
+	if (hdr.magic != FAQ_DB_MAGIC || hdr.version != FAQ_DB_VERSION || hdr.bytes > size ||
+	    hdr.categoryCount == 0 || tables > hdr.stringsOffset || hdr.stringBytes == 0 ||
+	    (uint64_t)hdr.stringsOffset + hdr.stringBytes > hdr.bytes || (uintptr_t)base % 4 != 0) {
+		return false;
+	}
+	// The pool ends in NUL, so any ref inside it reads as a terminated string
+	// without scanning the strings here.
+	if (base[hdr.stringsOffset + hdr.stringBytes - 1] != 0) return false;
+
+	m_image = base;
+	m_bytes = hdr.bytes;
+	m_categoryCount = hdr.categoryCount;
+	m_faqCount = hdr.faqCount;
+	m_keywordCount = hdr.keywordCount;
+	m_categories = reinterpret_cast<const FaqDbCategory *>(base + sizeof(hdr));
+	m_faqs = reinterpret_cast<const FaqDbFaq *>(m_categories + m_categoryCount);
+	m_keywords = reinterpret_cast<const uint32_t *>(m_faqs + m_faqCount);
+	m_strings = reinterpret_cast<const char *>(base + hdr.stringsOffset);
+	m_stringBytes = hdr.stringBytes;
+	return true;
+}
+
+void FaqDb::detach() {
+	m_image = nullptr;
+	m_bytes = 0;
+	m_categories = nullptr;
+	m_faqs = nullptr;
+	m_keywords = nullptr;
+	m_strings = nullptr;
+	m_stringBytes = 0;
+	m_categoryCount = 0;
+	m_faqCount = 0;
+	m_keywordCount = 0;
+}
+
+bool FaqDb::verify() const {
+	if (!m_image) return false;
+	uint32_t h = 2166136261UL;
+	for (uint32_t i = sizeof(FaqDbHeader); i < m_bytes; ++i) h = (h ^ m_image[i]) * 16777619UL;
+	FaqDbHeader hdr;
+	memcpy(&hdr, m_image, sizeof(hdr));
+	return h == hdr.checksum;
+}
+
+const FaqDbCategory *FaqDb::category(uint16_t c) const {
+	if (!m_image) return nullptr;
+	return &m_categories[c < m_categoryCount ? c : m_categoryCount - 1];
+}
+
+const char *FaqDb::string(uint32_t ref) const {
+	return ref < m_stringBytes ? m_strings + ref : "";
+}
+
+const char *FaqDb::categoryName(uint16_t c) const {
+	const FaqDbCategory *cat = category(c);
+	return cat ? string(cat->name) : "";
+}
+
+const char *FaqDb::answer(uint16_t c) const {
+	const FaqDbCategory *cat = category(c);
+	return cat ? string(cat->answer) : "";
+}
+
+uint32_t FaqDb::firstFaq(uint16_t c) const {
+	const FaqDbCategory *cat = category(c);
+	return cat && cat->firstFaq <= m_faqCount ? cat->firstFaq : m_faqCount;
+}
+
+uint32_t FaqDb::faqsIn(uint16_t c) const {
+	const FaqDbCategory *cat = category(c);
+	if (!cat || cat->firstFaq > m_faqCount) return 0;
+	uint32_t left = m_faqCount - cat->firstFaq;
+	return cat->faqCount < left ? cat->faqCount : left;
+}
+
+int FaqDb::findCategory(const char *name) const {
+	for (uint16_t c = 0; c < m_categoryCount; ++c) {
+		if (strcmp(string(m_categories[c].name), name) == 0) return c;
+	}
+	return -1;
+}
+
+bool FaqDb::entry(uint32_t index, FaqDbEntry &out) const {
+	if (!m_image || index >= m_faqCount) return false;
+	const FaqDbFaq &f = m_faqs[index];
+	out.id = f.id;
+	out.category = f.category;
+	out.keywordCount = (uint64_t)f.firstKeyword + f.keywordCount <= m_keywordCount ? f.keywordCount : 0;
+	out.question = string(f.question);
+	out.answer = string(f.answer);
+	return true;
+}
+
+const char *FaqDb::keyword(uint32_t index, uint16_t k) const {
+	FaqDbEntry e;
+	if (!entry(index, e) || k >= e.keywordCount) return "";
+	return string(m_keywords[m_faqs[index].firstKeyword + k]);
+}
+
+bool FaqDb::contains(const void *p) const {
+	const uint8_t *b = static_cast<const uint8_t *>(p);
+	return m_image && b >= m_image && b < m_image + m_bytes;
+}
@@ -0,0 +1,72 @@
+// faq_db.h - Zero-copy reader for the binary FAQ image (tools/gen_faq_db.py)
+//
+// The image is a header, a category table indexed by Intent id (Unknown
+// last), the FAQs grouped by category, their keyword refs and a pool of
+// interned NUL-terminated strings. attach() checks the header and that the
+// tables fit, and keeps pointers into the caller's mapping (an mmap'd file on
+// the host, a mapped flash partition on ESP32): nothing is parsed or copied,
+// so start-up costs the same however many FAQs the image holds. Every string
+// returned points into that mapping.
+#ifndef FAQ_DB_H
+#define FAQ_DB_H
+
+#include <Arduino.h>
+
+struct FaqDbCategory;
+struct FaqDbFaq;
+
+struct FaqDbEntry {
+  uint32_t id;            // "id" in faq.json
+  uint16_t category;      // index into the category table
+  uint16_t keywordCount;
+  const char *question;
+  const char *answer;
+};
+
+class FaqDb {
+ public:
+  // `image` must stay mapped until detach(). False if it is not an image of
+  // this version or its tables run past `size`.
+  bool attach(const void *image, size_t size);
+  void detach();
+  bool ready() const { return m_image != nullptr; }
+
+  // Checksum over the whole image: O(size), for tools and tests rather than
+  // start-up. Lookups stay in bounds on a damaged image regardless.
+  bool verify() const;
+
+  uint16_t categoryCount() const { return m_categoryCount; }
+  uint32_t faqCount() const { return m_faqCount; }
+  uint32_t bytes() const { return m_bytes; }
+
+  // Out-of-range categories read as the last one (Unknown).
+  const char *categoryName(uint16_t category) const;
+  const char *answer(uint16_t category) const;
+  // FAQs of a category are entries [firstFaq, firstFaq + faqsIn).
+  uint32_t firstFaq(uint16_t category) const;
+  uint32_t faqsIn(uint16_t category) const;
+  int findCategory(const char *name) const;   // -1 if absent
+
+  bool entry(uint32_t index, FaqDbEntry &out) const;
+  const char *keyword(uint32_t index, uint16_t k) const;   // "" past keywordCount
+
+  // True if `p` points into the attached image (answers are never copied).
+  bool contains(const void *p) const;
+
+ private:
+  const FaqDbCategory *category(uint16_t c) const;
+  const char *string(uint32_t ref) const;
+
+  const uint8_t *m_image = nullptr;
+  uint32_t m_bytes = 0;
+  const FaqDbCategory *m_categories = nullptr;
+  const FaqDbFaq *m_faqs = nullptr;
+  const uint32_t *m_keywords = nullptr;
+  const char *m_strings = nullptr;
+  uint32_t m_stringBytes = 0;
+  uint16_t m_categoryCount = 0;
+  uint32_t m_faqCount = 0;
+  uint32_t m_keywordCount = 0;
+};
+
+#endif // FAQ_DB_H
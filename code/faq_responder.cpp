@@ -1,19 +1,29 @@
 // faq_responder.cpp - Map categories to responses
 #include "faq_responder.h"
+#include "faq_answers.h"
+#include "faq_db.h"
+#include "ml_model.h"
 
-String faqResponseForCategory(const String &cat) {
-  if (cat == "requirements") {
-    return F("You need to have completed 12th grade with minimum 75% marks and pass the entrance exam.");
-  } else if (cat == "deadline") {
-    return F("The admission deadline is March 31st, 2026.");
-  } else if (cat == "fee") {
-    return F("The application fee is $50 for domestic students and $100 for international students.");
-  } else if (cat == "process") {
-    return F("Visit our official website, create an account, fill the application form, and submit required documents.");
-  } else if (cat == "documents") {
-    return F("You need transcripts, ID proof, passport photo, and entrance exam scorecard.");
-  } else if (cat == "greeting") {
-    return F("Hello! I'm your admission assistant. How can I help you today?");
+static const FaqDb *s_db = nullptr;
+
+const __FlashStringHelper *faqResponse(Intent intent) {
+  uint8_t i = (uint8_t)intent;
+  if (i > INTENT_COUNT) i = INTENT_COUNT;
+  if (s_db) return reinterpret_cast<const __FlashStringHelper *>(s_db->answer(i));
+  return reinterpret_cast<const __FlashStringHelper *>(pgm_read_ptr(&FAQ_ANSWERS[i]));
+}
+
+size_t printFaqResponse(Print &out, Intent intent) {
+  return out.print(faqResponse(intent));
+}
+
+bool faqSetDatabase(const FaqDb *db) {
+  if (db) {
+    if (!db->ready() || db->categoryCount() != INTENT_COUNT + 1) return false;
+    for (uint8_t i = 0; i <= INTENT_COUNT; ++i) {
+      if (strcmp_P(db->categoryName(i), reinterpret_cast<const char *>(intentName((Intent)i))) != 0) return false;
+    }
   }
-  return F("I'm sorry, I didn't understand your question. Please ask about admissions, requirements, deadlines, fees, or application process.");
+  s_db = db;
+  return true;
 }
@@ -3,7 +3,23 @@
 #define FAQ_RESPONDER_H
 
 #include <Arduino.h>
+#include "intents.h"
 
-String faqResponseForCategory(const String &category);
+class FaqDb;
+
+// Answer for `intent`, straight from the generated flash table
+// (code/faq_answers.h), or from the installed FaqDb image. Out-of-range ids
+// get the Unknown answer.
+const __FlashStringHelper *faqResponse(Intent intent);
+
+// Serve answers from a mapped FAQ image instead of the compiled-in table
+// (nullptr goes back to the table). Refused unless its categories are this
+// firmware's intents, in Intent order. Install it before answering queries;
+// the image must stay mapped while it is installed. Only for targets that
+// read mapped data like RAM (ESP32, host), not AVR PROGMEM.
+bool faqSetDatabase(const FaqDb *db);
+
+// Stream the answer to `out` (Serial, a TTS sink, ...) without a RAM copy.
+size_t printFaqResponse(Print &out, Intent intent);
 
 #endif // FAQ_RESPONDER_H
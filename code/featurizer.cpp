@@ -0,0 +1,85 @@
+// featurizer.cpp - Hashed unigram + bigram featurizer (one pass, no token list)
+#include "featurizer.h"
+
+static const uint32_t FNV_OFFSET = 2166136261UL;
+static const uint32_t FNV_PRIME = 16777619UL;
+
+static inline uint32_t fnv(uint32_t h, uint8_t b) {
+	return (h ^ b) * FNV_PRIME;
+}
+
+static inline bool isTokenByte(uint8_t c) {
+	return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+void HashedFeaturizer::reset() {
+	memset(m_counts, 0, sizeof(m_counts));
+	m_uni = FNV_OFFSET;
+	m_bi = 0;
+	m_prev = 0;
+	m_inToken = false;
+	m_hasPrev = false;
+}
+
+// Counts saturate at +-FEATURE_COUNT_MAX instead of wrapping on long input.
+void HashedFeaturizer::add(uint32_t h) {
+	int16_t &c = m_counts[h % MODEL_INPUT_SIZE];
+	if (h & 0x80000000UL) {
+		if (c > -FEATURE_COUNT_MAX) --c;
+	} else {
+		if (c < FEATURE_COUNT_MAX) ++c;
+	}
+}
+
+void HashedFeaturizer::endToken() {
+	m_inToken = false;
+	add(m_uni);
+	if (m_hasPrev) add(m_bi);
+	m_prev = m_uni;
+	m_hasPrev = true;
+}
+
+void HashedFeaturizer::push(uint8_t c) {
+	if (!isTokenByte(c)) {
+		if (m_inToken) endToken();
+		return;
+	}
+	if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+	if (!m_inToken) {
+		m_inToken = true;
+		m_uni = FNV_OFFSET;
+		if (m_hasPrev) m_bi = fnv(m_prev, ' ');
+	}
+	m_uni = fnv(m_uni, c);
+	if (m_hasPrev) m_bi = fnv(m_bi, c);
+}
+
+void HashedFeaturizer::push(const char *text, size_t len) {
+	for (size_t i = 0; i < len; ++i) push((uint8_t)text[i]);
+}
+
+void HashedFeaturizer::finish(float *out) {
+	if (m_inToken) endToken();
+	// At most MODEL_INPUT_SIZE * FEATURE_COUNT_MAX^2, well inside 64 bits.
+	uint64_t sumSq = 0;
+	for (size_t i = 0; i < MODEL_INPUT_SIZE; ++i) {
+		sumSq += (uint64_t)((int32_t)m_counts[i] * m_counts[i]);
+	}
+	if (sumSq == 0) {
+		memset(out, 0, MODEL_INPUT_SIZE * sizeof(float));
+		return;
+	}
+	// Each step is a single correctly rounded float32 op, mirrored in Python.
+	float n = (float)sumSq;
+	float root = sqrtf(n);
+	float inv = 1.0f / root;
+	for (size_t i = 0; i < MODEL_INPUT_SIZE; ++i) {
+		out[i] = (float)m_counts[i] * inv;
+	}
+}
+
+void HashedFeaturizer::featurize(const char *text, size_t len, float *out) {
+	HashedFeaturizer f;
+	f.push(text, len);
+	f.finish(out);
+}
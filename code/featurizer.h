@@ -0,0 +1,40 @@
+// featurizer.h - Streaming hashed n-gram features for the neural model
+//
+// C++ twin of ml_model/training/hashed_features.py (see that file for the exact
+// definition); the two produce bit-identical MODEL_INPUT_SIZE vectors.
+#ifndef FEATURIZER_H
+#define FEATURIZER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Largest bucket magnitude; see hashed_features.py.
+#define FEATURE_COUNT_MAX 32767
+
+class HashedFeaturizer {
+ public:
+  HashedFeaturizer() { reset(); }
+
+  void reset();
+  // Feed the text one byte at a time (e.g. straight from the STT stream).
+  void push(uint8_t c);
+  void push(const char *text, size_t len);
+  // Flush the last token and write the L2-normalised vector.
+  void finish(float *out);
+
+  // One-shot helper: featurize a whole buffer.
+  static void featurize(const char *text, size_t len, float *out);
+
+ private:
+  void add(uint32_t h);
+  void endToken();
+
+  int16_t m_counts[MODEL_INPUT_SIZE];
+  uint32_t m_uni;    // FNV-1a of the current token
+  uint32_t m_bi;     // FNV-1a of "<previous token> <current token>"
+  uint32_t m_prev;   // FNV-1a of the previous token
+  bool m_inToken;
+  bool m_hasPrev;
+};
+
+#endif // FEATURIZER_H
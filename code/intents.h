@@ -0,0 +1,26 @@
+// intents.h - GENERATED by tools/gen_keyword_automaton.py from
+// database/faq.json; do not edit.
+//
+// Category ids returned by AdmissionModel::classify. The order matches the
+// keyword tables and is the classifier's tie-break order.
+#ifndef INTENTS_H
+#define INTENTS_H
+
+#include <stdint.h>
+
+#define INTENT_COUNT 9
+
+enum class Intent : uint8_t {
+  Requirements = 0,
+  Deadline     = 1,
+  Fee          = 2,
+  Process      = 3,
+  Documents    = 4,
+  FinancialAid = 5,
+  Programs     = 6,
+  Schedule     = 7,
+  Greeting     = 8,
+  Unknown      = INTENT_COUNT, // below threshold / no keyword matched
+};
+
+#endif // INTENTS_H
@@ -0,0 +1,418 @@
+// keyword_automaton.h - GENERATED by tools/gen_keyword_automaton.py from
+// database/faq.json; do not edit.
+//
+// Aho-Corasick automaton over the classifier keywords, stored in flash
+// (220 states, 31 keywords, 9 categories; ~1612 bytes sparse, plus a 5060 byte
+// dense DFA on targets other than AVR).
+#ifndef KEYWORD_AUTOMATON_H
+#define KEYWORD_AUTOMATON_H
+
+#include <Arduino.h>
+#include "intents.h"
+
+#define KW_NUM_CATEGORIES INTENT_COUNT
+#define KW_NUM_KEYWORDS   31
+#define KW_NUM_STATES     220
+#define KW_NUM_CLASSES    23
+
+typedef uint8_t kw_state_t;
+typedef uint32_t kw_mask_t;
+#define KW_READ_STATE(p) ((kw_state_t)pgm_read_byte(p))
+
+// Keywords by id (bit position in kw_mask_t):
+//    0  "requirements"
+//    1  "eligibility"
+//    2  "criteria"
+//    3  "deadline"
+//    4  "last date"
+//    5  "timeline"
+//    6  "fee"
+//    7  "cost"
+//    8  "payment"
+//    9  "charge"
+//   10  "apply"
+//   11  "application"
+//   12  "process"
+//   13  "online"
+//   14  "documents"
+//   15  "papers"
+//   16  "certificates"
+//   17  "financial aid"
+//   18  "scholarship"
+//   19  "grant"
+//   20  "programs"
+//   21  "courses"
+//   22  "majors"
+//   23  "degrees"
+//   24  "classes start"
+//   25  "semester start"
+//   26  "schedule"
+//   27  "academic year"
+//   28  "hello"
+//   29  "hi"
+//   30  "hey"
+
+static const uint8_t KW_CHAR_CLASS[128] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+};
+
+static const kw_state_t KW_ROOT_NEXT[KW_NUM_CLASSES] PROGMEM = {
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93,
+  63, 0, 1, 134, 49, 0, 0,
+};
+
+static const uint16_t KW_EDGE_START[KW_NUM_STATES + 1] PROGMEM = {
+  0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 11, 12, 13,
+  14, 15, 16, 17, 18, 19, 20, 21, 21, 26, 27, 28, 29, 30, 31, 32,
+  32, 34, 36, 37, 38, 39, 40, 41, 41, 42, 43, 44, 45, 46, 47, 48,
+  49, 49, 50, 51, 52, 53, 54, 55, 56, 56, 58, 59, 59, 61, 62, 62,
+  64, 66, 67, 68, 69, 70, 70, 71, 72, 73, 74, 74, 76, 77, 78, 80,
+  80, 81, 82, 83, 84, 85, 86, 86, 87, 89, 90, 91, 92, 92, 93, 94,
+  95, 96, 97, 97, 98, 99, 100, 101, 102, 103, 104, 104, 105, 106, 107, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 117, 118, 119, 120, 121, 122,
+  123, 124, 125, 126, 127, 128, 128, 130, 131, 133, 134, 135, 136, 137, 138, 139,
+  140, 140, 141, 142, 143, 144, 144, 145, 146, 147, 148, 148, 149, 150, 151, 152,
+  152, 153, 154, 155, 156, 157, 157, 158, 159, 160, 161, 161, 162, 163, 164, 165,
+  166, 167, 168, 169, 170, 171, 172, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+  181, 182, 183, 184, 184, 185, 186, 187, 188, 188, 189, 190, 191, 192, 193, 194,
+  195, 196, 197, 198, 199, 199, 201, 203, 204, 205, 205, 205, 205,
+};
+
+static const uint8_t KW_EDGE_CLASS[205] PROGMEM = {
+  6, 17, 21, 10, 18, 6, 13, 6, 14, 20, 19, 12, 10, 8, 10, 3,
+  10, 12, 10, 20, 22, 6, 9, 12, 15, 18, 10, 20, 6, 18, 10, 2,
+  6, 15, 2, 8, 5, 12, 10, 14, 6, 2, 19, 20, 1, 5, 2, 20,
+  6, 10, 13, 6, 12, 10, 14, 6, 6, 10, 6, 19, 21, 20, 2, 18,
+  16, 22, 13, 6, 14, 20, 2, 18, 8, 6, 4, 16, 16, 12, 10, 22,
+  4, 2, 20, 10, 15, 14, 15, 4, 8, 6, 19, 19, 14, 12, 10, 14,
+  6, 4, 21, 13, 6, 14, 20, 19, 6, 18, 19, 18, 20, 10, 7, 10,
+  4, 2, 20, 6, 19, 14, 2, 14, 4, 10, 2, 12, 1, 2, 10, 5,
+  4, 6, 9, 6, 15, 12, 2, 18, 19, 9, 10, 16, 18, 2, 14, 20,
+  18, 2, 13, 19, 18, 19, 6, 19, 2, 11, 15, 18, 19, 18, 6, 6,
+  19, 2, 19, 19, 6, 19, 1, 19, 20, 2, 18, 20, 13, 6, 19, 20,
+  6, 18, 1, 19, 20, 2, 18, 20, 5, 21, 12, 6, 2, 5, 6, 13,
+  10, 4, 1, 22, 6, 2, 18, 6, 10, 12, 22, 12, 15,
+};
+
+static const kw_state_t KW_EDGE_NEXT[205] PROGMEM = {
+  2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 18,
+  19, 20, 21, 22, 23, 111, 70, 171, 60, 25, 26, 27, 28, 29, 30, 31,
+  33, 99, 34, 166, 35, 36, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47,
+  48, 50, 51, 52, 53, 54, 55, 56, 58, 122, 59, 61, 155, 62, 64, 87,
+  107, 65, 66, 67, 68, 69, 71, 72, 73, 74, 201, 76, 77, 78, 80, 79,
+  81, 82, 83, 84, 85, 86, 88, 89, 150, 90, 91, 92, 94, 95, 96, 97,
+  98, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 112, 113, 114, 115, 116,
+  117, 118, 119, 120, 121, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+  135, 183, 136, 196, 137, 138, 139, 140, 141, 142, 143, 144, 146, 147, 148, 149,
+  151, 152, 153, 154, 156, 157, 158, 159, 161, 162, 163, 164, 165, 167, 168, 169,
+  170, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 184, 185, 186, 187,
+  188, 189, 190, 191, 192, 193, 194, 195, 197, 198, 199, 200, 202, 203, 204, 205,
+  206, 207, 208, 209, 210, 211, 212, 214, 218, 215, 219, 216, 217,
+};
+
+static const kw_state_t KW_FAIL[KW_NUM_STATES] PROGMEM = {
+  0, 0, 13, 0, 0, 0, 1, 2, 160, 13, 0, 49, 134, 0, 40, 0,
+  145, 0, 0, 0, 40, 0, 49, 0, 0, 1, 0, 49, 13, 1, 0, 75,
+  0, 13, 75, 32, 40, 0, 0, 13, 0, 75, 134, 49, 0, 32, 75, 49,
+  13, 0, 0, 160, 13, 14, 15, 0, 13, 0, 13, 13, 93, 134, 49, 0,
+  75, 0, 160, 13, 0, 49, 213, 75, 1, 145, 13, 0, 63, 63, 40, 0,
+  0, 24, 75, 49, 50, 93, 94, 1, 93, 24, 111, 134, 134, 0, 0, 40,
+  0, 0, 13, 93, 24, 0, 160, 13, 0, 49, 134, 76, 13, 1, 134, 13,
+  1, 49, 50, 57, 122, 24, 75, 49, 13, 134, 0, 0, 75, 0, 24, 0,
+  75, 40, 0, 75, 0, 32, 0, 24, 70, 93, 40, 41, 1, 134, 213, 218,
+  63, 0, 1, 75, 0, 49, 145, 146, 147, 160, 134, 0, 1, 134, 183, 134,
+  0, 75, 0, 93, 1, 134, 145, 146, 2, 13, 134, 40, 41, 42, 134, 183,
+  134, 0, 134, 49, 75, 1, 49, 13, 160, 13, 134, 49, 13, 1, 0, 134,
+  49, 75, 1, 49, 214, 32, 0, 40, 13, 24, 75, 32, 33, 160, 0, 24,
+  0, 0, 13, 75, 1, 0, 13, 14, 40, 93, 0, 0,
+};
+
+#ifndef __AVR__
+#define KW_HAS_DELTA 1
+static const kw_state_t KW_DELTA[KW_NUM_STATES * KW_NUM_CLASSES] PROGMEM = {
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 3, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 4, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 5, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 6, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 7, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 8, 0, 93, 63, 3, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 9, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 10, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 11, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 12, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 15, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 16, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 17, 0, 40, 160, 0, 93, 63, 0, 146, 134, 49, 0, 0,
+  0, 0, 75, 18, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 19, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 20, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 21, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 22, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 23,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 26, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 27, 0, 0,
+  0, 0, 75, 0, 24, 32, 28, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 29, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 30, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 31, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 33, 57, 145, 213, 0, 0, 40, 160, 0, 99, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 34, 0, 24, 32, 13, 57, 166, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 35, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 33, 57, 145, 213, 0, 0, 36, 160, 0, 99, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 37, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 38, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 39, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 42, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 43, 0, 0,
+  0, 44, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 45, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 46, 0, 24, 32, 33, 57, 145, 213, 0, 0, 40, 160, 0, 99, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 47, 0, 0,
+  0, 0, 75, 0, 24, 32, 48, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 51, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 52, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 53, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 54, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 16, 213, 0, 0, 40, 160, 55, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 56, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 58, 57, 145, 213, 122, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 59, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 94, 93, 63, 0, 1, 61, 49, 155, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 62, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 64, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 87, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 107, 0, 1, 134, 49, 0, 65,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 66, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 67, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 68, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 69, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 71, 0, 24, 32, 214, 57, 145, 213, 218, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 72, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 73, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 74, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 146, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 64, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 77, 0, 87, 134, 49, 0, 0,
+  0, 0, 64, 0, 24, 32, 13, 57, 145, 213, 0, 0, 78, 160, 0, 93, 63, 0, 87, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 80, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 79,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 81, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 82, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 83, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 84, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 51, 0, 85, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 86, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 95, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 88, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 89, 32, 13, 57, 150, 213, 0, 0, 40, 160, 94, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 90, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 112, 91, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 92, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 94, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 95, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 96, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 97, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 98, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 100, 32, 13, 57, 145, 213, 0, 0, 40, 160, 94, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 101, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 102, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 103, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 104, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 105, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 106, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 64, 0, 24, 32, 108, 57, 145, 213, 0, 0, 40, 160, 0, 93, 77, 0, 87, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 109, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 110, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 112, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 113, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 114, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 115, 145, 213, 0, 0, 40, 51, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 58, 57, 145, 213, 116, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 117, 32, 13, 57, 145, 213, 0, 0, 40, 160, 123, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 118, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 119, 0, 0,
+  0, 0, 75, 0, 24, 32, 120, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 121, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 123, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 124, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 125, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 126, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 111, 57, 145, 70, 127, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 128, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 129, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 130, 41, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 131, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 132, 0, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 133, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 33, 57, 145, 213, 0, 0, 40, 160, 0, 99, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 111, 57, 145, 136, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 71, 0, 24, 32, 196, 57, 145, 213, 218, 0, 40, 160, 0, 137, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 138, 160, 94, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 139, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 140, 42, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 141, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 142, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 214, 57, 145, 213, 143, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 144, 0, 1, 134, 49, 0, 0,
+  0, 0, 64, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 87, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 146, 134, 49, 0, 0,
+  0, 0, 147, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 148, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 149, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 151, 134, 49, 0, 0,
+  0, 0, 152, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 153, 148, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 154, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 156, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 157, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 158, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 184, 0, 93, 63, 0, 1, 159, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 162, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 163, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 94, 93, 63, 0, 164, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 165, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 167, 134, 49, 0, 0,
+  0, 0, 147, 0, 24, 32, 168, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 169, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 3, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 170, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 172, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 173, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 174, 43, 0, 0,
+  0, 0, 75, 0, 135, 32, 175, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 184, 0, 93, 63, 0, 1, 176, 49, 0, 0,
+  0, 177, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 178, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 179, 0, 0,
+  0, 0, 180, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 181, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 182, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 184, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 185, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 186, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 187, 0, 0,
+  0, 0, 75, 0, 24, 32, 188, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 189, 134, 49, 0, 0,
+  0, 190, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 191, 49, 0, 0,
+  0, 0, 75, 0, 135, 32, 183, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 192, 0, 0,
+  0, 0, 193, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 194, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 195, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 50, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 197, 13, 57, 145, 213, 0, 0, 215, 160, 0, 93, 63, 0, 1, 134, 49, 0, 219,
+  0, 0, 75, 0, 24, 32, 33, 57, 145, 213, 0, 0, 40, 160, 0, 99, 63, 0, 1, 134, 49, 198, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 199, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 200, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 202, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 203, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 204, 57, 145, 213, 0, 0, 40, 160, 0, 99, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 34, 0, 24, 32, 13, 57, 166, 213, 0, 0, 14, 205, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 161, 0, 24, 32, 13, 57, 145, 213, 206, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 207, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 208, 75, 0, 24, 32, 111, 57, 145, 70, 0, 0, 171, 160, 0, 60, 63, 0, 25, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 209,
+  0, 0, 75, 0, 24, 32, 210, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 211, 0, 24, 32, 13, 57, 145, 213, 0, 0, 14, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 201, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 76, 0, 212, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 2, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 214, 57, 145, 213, 218, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 215, 160, 0, 93, 63, 0, 1, 134, 49, 0, 219,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 15, 0, 216, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 41, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 217, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 94, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+  0, 0, 75, 0, 24, 32, 13, 57, 145, 213, 0, 0, 40, 160, 0, 93, 63, 0, 1, 134, 49, 0, 0,
+};
+#endif
+
+static const uint8_t KW_STATE_OUTPUT[KW_NUM_STATES] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3,
+  0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 7, 0, 0, 8, 0,
+  0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 10, 0, 0, 0, 0, 11,
+  0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 13, 0, 0, 0,
+  0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 16, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  20, 0, 0, 0, 0, 21, 0, 0, 0, 0, 22, 0, 0, 0, 0, 23,
+  0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 27, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 29, 0, 0, 0, 0, 30, 19, 31,
+};
+
+static const kw_mask_t KW_OUTPUT_MASK[31] PROGMEM = {
+  0x00000001UL, 0x00000002UL, 0x00000004UL, 0x00000008UL,
+  0x00000010UL, 0x00000020UL, 0x00000040UL, 0x00000080UL,
+  0x00000100UL, 0x00000200UL, 0x00000400UL, 0x00000800UL,
+  0x00001000UL, 0x00002000UL, 0x00004000UL, 0x00008000UL,
+  0x00010000UL, 0x00020000UL, 0x20000000UL, 0x00040000UL,
+  0x00080000UL, 0x00100000UL, 0x00200000UL, 0x00400000UL,
+  0x00800000UL, 0x01000000UL, 0x02000000UL, 0x04000000UL,
+  0x08000000UL, 0x10000000UL, 0x40000000UL,
+};
+
+static const kw_mask_t KW_CATEGORY_MASK[KW_NUM_CATEGORIES] PROGMEM = {
+  0x00000007UL, 0x00000038UL, 0x000003C0UL, 0x00003C00UL,
+  0x0001C001UL, 0x000E0000UL, 0x00F00000UL, 0x0F000000UL,
+  0x70000000UL,
+};
+
+static const uint8_t KW_CATEGORY_KEYWORDS[KW_NUM_CATEGORIES] PROGMEM = {
+  3, 3, 4, 4, 4, 3, 4, 4, 3,
+};
+
+static const char KW_CATEGORY_NAME_0[] PROGMEM = "requirements";
+static const char KW_CATEGORY_NAME_1[] PROGMEM = "deadline";
+static const char KW_CATEGORY_NAME_2[] PROGMEM = "fee";
+static const char KW_CATEGORY_NAME_3[] PROGMEM = "process";
+static const char KW_CATEGORY_NAME_4[] PROGMEM = "documents";
+static const char KW_CATEGORY_NAME_5[] PROGMEM = "financial_aid";
+static const char KW_CATEGORY_NAME_6[] PROGMEM = "programs";
+static const char KW_CATEGORY_NAME_7[] PROGMEM = "schedule";
+static const char KW_CATEGORY_NAME_8[] PROGMEM = "greeting";
+static const char KW_CATEGORY_NAME_UNKNOWN[] PROGMEM = "unknown";
+// Indexed by Intent; the last entry names Intent::Unknown.
+static const char *const KW_CATEGORY_NAMES[KW_NUM_CATEGORIES + 1] PROGMEM = {
+  KW_CATEGORY_NAME_0, KW_CATEGORY_NAME_1, KW_CATEGORY_NAME_2, KW_CATEGORY_NAME_3,
+  KW_CATEGORY_NAME_4, KW_CATEGORY_NAME_5, KW_CATEGORY_NAME_6, KW_CATEGORY_NAME_7,
+  KW_CATEGORY_NAME_8, KW_CATEGORY_NAME_UNKNOWN,
+};
+
+#endif // KEYWORD_AUTOMATON_H
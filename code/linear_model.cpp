@@ -0,0 +1,157 @@
+// linear_model.cpp - Sparse TF-IDF features x dense weight rows
+#include "linear_model.h"
+
+#if defined(__SSE__) && !defined(__AVR__)
+#include <xmmintrin.h>
+#define LINEAR_SIMD_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LINEAR_SIMD_NEON 1
+#endif
+
+static const uint32_t FNV_OFFSET = 2166136261UL;
+static const uint32_t FNV_PRIME = 16777619UL;
+
+struct TermCount {
+	uint16_t index;
+	uint16_t count;
+};
+
+// Distinct vocabulary terms scored per pass over the query. A query of
+// STT_LINE_MAX bytes has at most (STT_LINE_MAX + 1) / 3 tokens of two or more
+// characters, so fewer unigrams and bigrams than this: device queries take
+// one pass. Longer text (host server lines) takes one more pass per
+// MAX_QUERY_TERMS further terms; nothing is dropped.
+static const uint8_t MAX_QUERY_TERMS = 2 * ((STT_LINE_MAX + 1) / 3);
+static_assert(2 * ((STT_LINE_MAX + 1) / 3) <= 255, "term counts are indexed by uint8_t");
+
+static inline uint32_t fnv(uint32_t h, uint8_t b) {
+	return (h ^ b) * FNV_PRIME;
+}
+
+static inline bool isWordByte(uint8_t c) {
+	return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
+}
+
+static int16_t lookupTerm(uint32_t h) {
+	uint16_t s = h & (LINEAR_HASH_SLOTS - 1);
+	for (;;) {
+		uint16_t idx = pgm_read_word(&LINEAR_TERM_INDEX[s]);
+		if (idx == LINEAR_EMPTY_SLOT) return -1;
+		if (pgm_read_dword(&LINEAR_TERM_HASH[s]) == h) return (int16_t)idx;
+		s = (s + 1) & (LINEAR_HASH_SLOTS - 1);
+	}
+}
+
+// Counts a term with a column above `after`. Once the buffer is full it keeps
+// the lowest columns: the largest is evicted for a smaller newcomer. The
+// buffer then only takes smaller columns, so an evicted one never returns
+// with a partial count, and whatever is kept at the end was counted in full.
+static void countTerm(uint32_t h, int32_t after, TermCount *terms, uint8_t &n, bool &more) {
+	int16_t idx = lookupTerm(h);
+	if (idx <= after) return; // also not in the vocabulary (-1)
+	for (uint8_t i = 0; i < n; ++i) {
+		if (terms[i].index == (uint16_t)idx) {
+			if (terms[i].count < 0xFFFF) ++terms[i].count;
+			return;
+		}
+	}
+	if (n < MAX_QUERY_TERMS) {
+		terms[n++] = TermCount{(uint16_t)idx, 1};
+		return;
+	}
+	more = true;
+	uint8_t top = 0;
+	for (uint8_t i = 1; i < n; ++i) {
+		if (terms[i].index > terms[top].index) top = i;
+	}
+	if ((uint16_t)idx < terms[top].index) terms[top] = TermCount{(uint16_t)idx, 1};
+}
+
+// Unigrams and bigrams of the tokens, hashed as "tok" and "prev tok", whose
+// column is above `after`. True if some did not fit; call again past the
+// largest column returned.
+static bool collectTerms(const char *text, size_t len, int32_t after, TermCount *terms, uint8_t &n) {
+	bool more = false;
+	n = 0;
+	uint32_t uni = FNV_OFFSET, bi = 0, prev = 0;
+	size_t tokLen = 0;
+	bool hasPrev = false;
+	for (size_t i = 0; i <= len; ++i) {
+		uint8_t c = i < len ? (uint8_t)text[i] : ' ';
+		if (isWordByte(c)) {
+			if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+			if (tokLen == 0) {
+				uni = FNV_OFFSET;
+				bi = fnv(prev, ' ');
+			}
+			uni = fnv(uni, c);
+			bi = fnv(bi, c);
+			++tokLen;
+			continue;
+		}
+		if (tokLen >= 2) { // single characters are not tokens and do not break bigrams
+			countTerm(uni, after, terms, n, more);
+#if LINEAR_MAX_NGRAM >= 2
+			if (hasPrev) countTerm(bi, after, terms, n, more);
+#endif
+			prev = uni;
+			hasPrev = true;
+		}
+		tokLen = 0;
+	}
+	return more;
+}
+
+// acc += scale * LINEAR_WEIGHTS[row]
+static inline void addRow(float *acc, uint16_t row, float scale) {
+	const float *w = LINEAR_WEIGHTS[row];
+#if (LINEAR_SIMD_SSE || LINEAR_SIMD_NEON) && LINEAR_NUM_LABELS % 4 == 0
+	for (uint8_t k = 0; k < LINEAR_NUM_LABELS; k += 4) {
+#if LINEAR_SIMD_SSE
+		_mm_storeu_ps(acc + k, _mm_add_ps(_mm_loadu_ps(acc + k), _mm_mul_ps(_mm_load_ps(w + k), _mm_set1_ps(scale))));
+#else
+		vst1q_f32(acc + k, vmlaq_n_f32(vld1q_f32(acc + k), vld1q_f32(w + k), scale));
+#endif
+	}
+#else
+	for (uint8_t k = 0; k < LINEAR_NUM_LABELS; ++k) {
+		acc[k] += pgm_read_float(&w[k]) * scale;
+	}
+#endif
+}
+
+void LinearClassifier::logits(const char *text, size_t len, float *out) {
+	TermCount terms[MAX_QUERY_TERMS];
+	uint8_t n;
+	float acc[LINEAR_NUM_LABELS] = {0};
+	float sumSq = 0.0f;
+	bool more;
+	int32_t after = -1;
+	do {
+		more = collectTerms(text, len, after, terms, n);
+		for (uint8_t i = 0; i < n; ++i) {
+			float tfidf = terms[i].count * pgm_read_float(&LINEAR_IDF[terms[i].index]);
+			sumSq += tfidf * tfidf;
+			addRow(acc, terms[i].index, terms[i].count); // rows already carry the idf
+			if (terms[i].index > after) after = terms[i].index;
+		}
+	} while (more);
+	float inv = sumSq > 0.0f ? 1.0f / sqrtf(sumSq) : 0.0f;
+	for (uint8_t k = 0; k < LINEAR_NUM_LABELS; ++k) {
+		out[k] = pgm_read_float(&LINEAR_INTERCEPT[k]) + acc[k] * inv;
+	}
+}
+
+Intent LinearClassifier::predict(const float *logits, float *confidence) {
+	uint8_t best = 0;
+	for (uint8_t k = 1; k < LINEAR_NUM_LABELS; ++k) {
+		if (logits[k] > logits[best]) best = k;
+	}
+	float sum = 0.0f;
+	for (uint8_t k = 0; k < LINEAR_NUM_LABELS; ++k) {
+		sum += expf(logits[k] - logits[best]);
+	}
+	if (confidence) *confidence = 1.0f / sum;
+	return LINEAR_LABEL_INTENTS[best];
+}
@@ -0,0 +1,29 @@
+// linear_model.h - TF-IDF + logistic regression intent scorer
+//
+// Runs the scikit-learn pipeline from ml_model/training/intent_pipeline.joblib
+// (exported by tools/export_linear_model.py) in one pass over the text: the
+// query is tokenized like TfidfVectorizer, vocabulary terms are looked up by
+// hash, and each hit adds its weight row to the label logits.
+#ifndef LINEAR_MODEL_H
+#define LINEAR_MODEL_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "linear_model_data.h"
+#include "stt_module.h"
+
+class LinearClassifier {
+ public:
+  // Decision values (LogisticRegression.decision_function) for every label,
+  // in LINEAR_LABEL_INTENTS order. Tokens are runs of ASCII [A-Za-z0-9_] of at
+  // least two characters; other bytes separate them (the Python \w also
+  // accepts non-ASCII letters, which never form vocabulary terms anyway).
+  // Every vocabulary term counts however long the text is; past STT_LINE_MAX
+  // bytes the text may be scanned more than once.
+  static void logits(const char *text, size_t len, float *out);
+
+  // Softmax over `logits`; returns the winning label's intent and probability.
+  static Intent predict(const float *logits, float *confidence);
+};
+
+#endif // LINEAR_MODEL_H
@@ -0,0 +1,317 @@
+// linear_model_data.cpp - GENERATED by tools/export_linear_model.py from
+// ml_model/training/artifacts/intent_pipeline.joblib; do not edit.
+#include "linear_model_data.h"
+
+const uint32_t LINEAR_TERM_HASH[LINEAR_HASH_SLOTS] PROGMEM = {
+  0x00000000, 0x00000000, 0x00000000, 0xc002ac03, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x25398c0a, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x621cd814, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x63e1d819, 0x00000000, 0x00000000, 0x21d7321c, 0xb40eb21c,
+  0x00000000, 0x00000000, 0x848c8620, 0x41326021, 0x7b4d9822, 0x00000000,
+  0x42454824, 0x00000000, 0x00000000, 0xb5672027, 0x00000000, 0x00000000,
+  0x00000000, 0xb193942b, 0x00000000, 0x00000000, 0x00000000, 0x856e942f,
+  0x00000000, 0x00000000, 0x60a24c32, 0x00000000, 0x93c2a834, 0x00000000,
+  0x00000000, 0x22f44037, 0xe032a838, 0x00000000, 0x00000000, 0x24bc4a3b,
+  0x6d22083c, 0x3329483c, 0x2db6483e, 0xfcb2483e, 0x00000000, 0xaa5c1641,
+  0x00000000, 0x00000000, 0x00000000, 0x1f47a245, 0x7a73b046, 0x00000000,
+  0x00000000, 0xf785ce49, 0x00000000, 0x00000000, 0x00000000, 0x2c29f04d,
+  0x406f344d, 0x044dc64f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x45064c55, 0x00000000, 0x00000000, 0x00000000, 0xd472dc59,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x58a61262, 0x00000000, 0x00000000, 0x2b234a65,
+  0x00000000, 0x00000000, 0x69343c68, 0x00000000, 0xe6759e6a, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x62297675, 0x9e6a8476, 0x4bbaac77,
+  0x5e24e475, 0xbf842479, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x229a5e7f, 0x00000000, 0x0cfb5881, 0x00000000, 0x00000000,
+  0x990e7e84, 0x00000000, 0x99a81e86, 0x00000000, 0x00000000, 0x00000000,
+  0xa89b5c8a, 0x8f73308a, 0x00000000, 0x01c3ac8d, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x7730a492, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x66fdf298, 0x00000000, 0x00000000, 0x00000000,
+  0x50b8d09c, 0x00000000, 0x00000000, 0xd9a2029f, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xef286ca5, 0x00000000, 0x702da6a7,
+  0xe5d46ea7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xb48952b1, 0x00000000, 0x57b98cb3,
+  0x00000000, 0x473c0cb5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb15ca6bf,
+  0x2e29c2c0, 0x2b0850c1, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xc84f6ccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x9464fad5, 0x00000000, 0x5af0d0d7,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x844bfedc, 0x00000000,
+  0x00000000, 0x9da81adf, 0x652b04df, 0x00000000, 0x5b4e76e2, 0x00000000,
+  0x707c9ae4, 0x00000000, 0x00000000, 0x394712e7, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x34e1f4ed, 0x00000000, 0x00000000,
+  0x14f68cf0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x212e7701,
+  0x00000000, 0x00000000, 0x00000000, 0x19dd9305, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x96b9e715, 0x4e388f15, 0x00000000, 0x00000000, 0x7f778519,
+  0x0ec50d1a, 0xdd9ed51a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0fbb8722, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x88683d2e, 0x00000000, 0x00000000, 0x00000000,
+  0x971f9f32, 0x00000000, 0x2c35b134, 0xf05e1934, 0xda536936, 0x00000000,
+  0xe85c3338, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xf5d3bf41, 0x01987941, 0x00000000,
+  0x00000000, 0x00000000, 0x16ba9f46, 0x00000000, 0x00000000, 0x00000000,
+  0xdcbde14a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6714f55a, 0x00000000,
+  0x1271ab5c, 0xb8ebd55d, 0x00000000, 0x7e36315f, 0x285d2d60, 0x00000000,
+  0x00000000, 0x4dd58d63, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xfb4b2d69, 0x00000000, 0x00000000, 0x207a9b6c, 0x00000000,
+  0x00000000, 0xe70f636f, 0x4b43636f, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc7c44f79,
+  0xbe6c097a, 0x9ce94d7a, 0xd12fe57c, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xd0a6278f, 0xacf38390, 0x00000000,
+  0x00000000, 0x00000000, 0x9d35e594, 0x00000000, 0x00000000, 0x72068797,
+  0xf0e04597, 0x00000000, 0x00000000, 0x4d7ab99b, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xf37001a0, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8f6db3a8, 0x00000000,
+  0xad681baa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x114571ba, 0x00000000,
+  0x19b8d1bc, 0x4e3df9bd, 0x00000000, 0x00000000, 0x5104edc0, 0x00000000,
+  0x00000000, 0x2b0f1dc3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xe783edc9, 0x00000000, 0x00000000, 0xb9559fcc, 0x00000000,
+  0x7b47a3ce, 0x8f5d11cf, 0x90e39fce, 0xa6e741ce, 0xe4251fd2, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xc1d9c9dd, 0xd5f545dd, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x009017e5,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd10ad7ea, 0xfa6a45ea,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xc98ee3f2, 0xbf5bbdf2, 0x00000000, 0x00000000, 0x3c7a13f6, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfd5629fc, 0x00000000,
+  0x00000000, 0xab3e0bff,
+};
+
+const uint16_t LINEAR_TERM_INDEX[LINEAR_HASH_SLOTS] PROGMEM = {
+  0xffff, 0xffff, 0xffff, 0x0034, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0013, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0028, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0048, 0xffff, 0xffff, 0x004d, 0x006e, 0xffff, 0xffff, 0x005e, 0x0004, 0x0074, 0xffff,
+  0x0076, 0xffff, 0xffff, 0x002d, 0xffff, 0xffff, 0xffff, 0x0031, 0xffff, 0xffff, 0xffff, 0x0078,
+  0xffff, 0xffff, 0x0014, 0xffff, 0x004e, 0xffff, 0xffff, 0x0002, 0x0064, 0xffff, 0xffff, 0x0010,
+  0x0024, 0x0082, 0x0021, 0x003b, 0xffff, 0x0017, 0xffff, 0xffff, 0xffff, 0x0009, 0x0046, 0xffff,
+  0xffff, 0x0006, 0xffff, 0xffff, 0xffff, 0x0007, 0x0012, 0x006d, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0059, 0xffff, 0xffff, 0xffff, 0x0025, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0081, 0xffff, 0xffff, 0x001a, 0xffff, 0xffff, 0x004f, 0xffff, 0x0040, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0022, 0x004b, 0x0073,
+  0x0079, 0x0057, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007f, 0xffff, 0x004a, 0xffff, 0xffff,
+  0x000d, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0x0005, 0x0053, 0xffff, 0x003c, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0083, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0018, 0xffff, 0xffff, 0xffff,
+  0x0080, 0xffff, 0xffff, 0x001e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0054, 0xffff, 0x001d,
+  0x0066, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0023, 0xffff, 0x000a,
+  0xffff, 0x0027, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0016,
+  0x0069, 0x0068, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0043, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x006b, 0xffff, 0x0042,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x0036, 0xffff, 0xffff, 0x002b, 0x0067, 0xffff, 0x0038, 0xffff,
+  0x0047, 0xffff, 0xffff, 0x002e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x000b, 0xffff, 0xffff,
+  0x0029, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0020, 0xffff, 0xffff, 0xffff, 0x006f, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0035, 0x003f, 0xffff, 0xffff, 0x007d, 0x0033, 0x0075, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0001, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x005f, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0x006a, 0x0085, 0x0084, 0xffff,
+  0x001f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x005d, 0x0061, 0xffff,
+  0xffff, 0xffff, 0x007e, 0xffff, 0xffff, 0xffff, 0x003e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0070, 0xffff,
+  0x0032, 0x0072, 0xffff, 0x000c, 0x0077, 0xffff, 0xffff, 0x0055, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x006c, 0xffff, 0xffff, 0x0045, 0xffff, 0xffff, 0x0049, 0x0060, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0063, 0x000f, 0x005b, 0x004c, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x0065, 0x003a, 0xffff, 0xffff, 0xffff, 0x0050, 0xffff, 0xffff, 0x001c,
+  0x0071, 0xffff, 0xffff, 0x0062, 0xffff, 0xffff, 0xffff, 0xffff, 0x007c, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x005c, 0xffff, 0x002f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0051, 0xffff,
+  0x0037, 0x007b, 0xffff, 0xffff, 0x002a, 0xffff, 0xffff, 0x0058, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0056, 0xffff, 0xffff, 0x000e, 0xffff, 0x0011, 0x0008, 0x0030, 0x005a, 0x003d, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0052, 0x007a, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x002c, 0xffff, 0xffff, 0xffff, 0xffff, 0x0019, 0x0041,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0003, 0x0044, 0xffff, 0xffff, 0x0026, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x0039, 0xffff, 0xffff, 0x001b,
+};
+
+const float LINEAR_IDF[LINEAR_NUM_TERMS] PROGMEM = {
+  2.73911574f, 3.51230562f, 4.61091791f, 3.35815494f, 3.35815494f, 3.35815494f,
+  4.61091791f, 4.61091791f, 4.61091791f, 2.53147637f, 4.61091791f, 3.00148f,
+  4.61091791f, 4.61091791f, 4.61091791f, 4.61091791f, 3.00148f, 3.51230562f,
+  2.35962611f, 4.61091791f, 3.51230562f, 2.81915844f, 4.61091791f, 4.61091791f,
+  2.66500776f, 4.61091791f, 3.35815494f, 4.61091791f, 4.61091791f, 3.22462355f,
+  3.35815494f, 4.2054528f, 4.61091791f, 3.10684052f, 3.10684052f, 4.2054528f,
+  4.61091791f, 3.91777073f, 4.61091791f, 3.22462355f, 2.66500776f, 3.35815494f,
+  3.35815494f, 4.61091791f, 3.10684052f, 3.35815494f, 4.61091791f, 4.61091791f,
+  4.2054528f, 4.61091791f, 4.61091791f, 4.61091791f, 2.90616982f, 4.61091791f,
+  4.61091791f, 3.22462355f, 3.35815494f, 4.61091791f, 4.61091791f, 4.61091791f,
+  3.22462355f, 3.35815494f, 4.61091791f, 2.21302264f, 4.61091791f, 2.59601489f,
+  3.35815494f, 3.10684052f, 4.61091791f, 4.61091791f, 3.69462718f, 4.2054528f,
+  4.2054528f, 4.2054528f, 4.2054528f, 4.61091791f, 4.61091791f, 4.61091791f,
+  4.61091791f, 4.2054528f, 4.61091791f, 4.61091791f, 4.61091791f, 3.51230562f,
+  4.61091791f, 3.10684052f, 4.61091791f, 4.61091791f, 3.69462718f, 4.2054528f,
+  4.61091791f, 4.61091791f, 3.22462355f, 4.61091791f, 3.22462355f, 4.61091791f,
+  4.61091791f, 3.35815494f, 4.61091791f, 4.61091791f, 4.61091791f, 4.61091791f,
+  4.61091791f, 3.00148f, 4.61091791f, 4.61091791f, 4.2054528f, 4.61091791f,
+  4.61091791f, 4.61091791f, 2.04596856f, 2.81915844f, 3.00148f, 3.51230562f,
+  3.22462355f, 4.61091791f, 3.51230562f, 4.61091791f, 3.91777073f, 3.91777073f,
+  2.00822823f, 2.81915844f, 3.35815494f, 3.10684052f, 4.61091791f, 2.81915844f,
+  3.35815494f, 3.51230562f, 3.00148f, 4.61091791f, 4.61091791f, 4.61091791f,
+  3.69462718f, 4.2054528f,
+};
+
+// Rows are vocabulary terms; coef * idf, one float per label.
+alignas(16) const float LINEAR_WEIGHTS[LINEAR_NUM_TERMS][LINEAR_NUM_LABELS] PROGMEM = {
+  {1.22598026f, -0.562467501f, -0.725867842f, -0.614127981f, -0.664135625f, -0.804171001f, 2.74545725f, -0.600667565f}, // admission
+  {2.89826368f, -0.292069742f, -0.509739909f, -0.390797f, -0.411334477f, -0.34628539f, -0.528808945f, -0.419228217f}, // admission deadline
+  {-0.380037076f, -0.250150913f, -0.298383693f, -0.309516509f, -0.341041793f, -0.281759144f, 2.14626837f, -0.285379241f}, // admission eligibility
+  {-0.605121192f, -0.445748618f, -0.46678467f, -0.401657612f, -0.441326648f, -0.742720076f, 3.47159714f, -0.368238324f}, // admission requirements
+  {-0.413946327f, -0.316867285f, -0.460785387f, 2.73939647f, -0.423419178f, -0.468249942f, -0.299846507f, -0.356281846f}, // aid
+  {-0.413946327f, -0.316867285f, -0.460785387f, 2.73939647f, -0.423419178f, -0.468249942f, -0.299846507f, -0.356281846f}, // aid available
+  {-0.275025134f, -0.238608949f, 1.90762272f, -0.294278031f, -0.320822079f, -0.275767841f, -0.22899953f, -0.274121156f}, // amount
+  {-0.168645744f, -0.127446821f, 1.14670048f, -0.268571743f, -0.188616747f, -0.136572015f, -0.117067976f, -0.139779436f}, // any
+  {-0.168645744f, -0.127446821f, 1.14670048f, -0.268571743f, -0.188616747f, -0.136572015f, -0.117067976f, -0.139779436f}, // any application
+  {0.152505934f, -0.197336487f, 1.95921525f, -0.780557067f, 0.907674279f, -0.735740334f, -0.631645699f, -0.674115881f}, // application
+  {1.73024605f, -0.153706546f, -0.655867131f, -0.174083354f, -0.269157708f, -0.178798913f, -0.153948973f, -0.144683422f}, // application deadline
+  {-0.754961176f, -0.441802178f, 3.82986438f, -0.541634275f, -0.719569488f, -0.501371782f, -0.437861283f, -0.432664193f}, // application fee
+  {1.64486012f, -0.195648412f, -0.293291458f, -0.228369158f, -0.291502076f, -0.214644188f, -0.179918312f, -0.241486517f}, // application last
+  {-0.3324651f, -0.265138361f, -0.430007063f, -0.30773096f, 2.15087604f, -0.28848708f, -0.240402009f, -0.286645464f}, // application procedure
+  {-0.323139535f, -0.16243938f, -0.639498801f, -0.1868784f, 1.82371278f, -0.189807351f, -0.165250167f, -0.156699143f}, // application process
+  {-0.235317645f, -0.191490706f, -0.286294796f, -0.225686684f, 1.53644214f, -0.211535978f, -0.176280226f, -0.209836106f}, // application steps
+  {0.00809894525f, -0.511097235f, 0.145874221f, -0.616873137f, 2.70821013f, -0.597569219f, -0.493337125f, -0.643306581f}, // apply
+  {-0.36956981f, -0.307226175f, -0.401748207f, -0.366583814f, 2.50784847f, -0.363451981f, -0.296473856f, -0.402794624f}, // apply online
+  {-0.729907684f, 1.16179724f, -0.71907612f, -0.169385723f, -0.701005056f, 0.630411692f, 1.11782496f, -0.590659317f}, // are
+  {-0.171716037f, 1.30151958f, -0.188139945f, -0.185098389f, -0.199002209f, -0.207576292f, -0.184148562f, -0.165838146f}, // are needed
+  {-0.365066801f, 2.83072454f, -0.417114132f, -0.393287737f, -0.418141692f, -0.463824884f, -0.41608365f, -0.357205642f}, // are required
+  {-0.656730858f, -0.563841558f, -0.59414813f, -0.550063342f, -0.557121619f, 1.37219036f, 2.01673065f, -0.467015503f}, // are the
+  {-0.229442462f, -0.235440499f, -0.249372864f, 1.68756422f, -0.266784685f, -0.25656857f, -0.225298606f, -0.224656532f}, // are there
+  {-0.288426938f, -0.243947338f, -0.293038237f, 1.95249292f, -0.334228973f, -0.27939925f, -0.23463541f, -0.278816777f}, // assistance
+  {-0.645850937f, -0.573149345f, -0.707610076f, 1.23771314f, -0.692749603f, 2.67524733f, -0.709462057f, -0.58413845f}, // available
+  {-0.289193457f, -0.243932899f, -0.293007794f, -0.389885155f, -0.333203939f, 2.05915945f, -0.230566479f, -0.279369724f}, // available courses
+  {-0.458159958f, -0.463808579f, -0.507360792f, -0.567310035f, -0.499809897f, 3.62385638f, -0.704360946f, -0.423046172f}, // available programs
+  {-0.276090864f, -0.185180144f, -0.221906111f, -0.228369569f, -0.247666053f, -0.213453544f, -0.178379435f, 1.55104572f}, // class
+  {-0.276090864f, -0.185180144f, -0.221906111f, -0.228369569f, -0.247666053f, -0.213453544f, -0.178379435f, 1.55104572f}, // class start
+  {-0.538238404f, -0.394785587f, -0.46128913f, -0.472163219f, -0.590300847f, -0.47910586f, -0.376548208f, 3.31243126f}, // classes
+  {-0.473736978f, -0.333485198f, -0.385985876f, -0.395505056f, -0.513696324f, -0.392959522f, -0.316926252f, 2.81229521f}, // classes start
+  {-0.403504289f, -0.292621795f, 2.547285f, -0.347112334f, -0.578171858f, -0.326663178f, -0.275038498f, -0.32417305f}, // cost
+  {-0.299221871f, -0.191378738f, 1.80280475f, -0.23402865f, -0.459269784f, -0.219489874f, -0.184506095f, -0.214909736f}, // cost to
+  {-0.0185540238f, 0.0851641316f, -0.0150866417f, -0.0460951863f, -0.0639026672f, -0.0318492089f, 0.063749552f, 0.0265740443f}, // could
+  {-0.0185540238f, 0.0851641316f, -0.0150866417f, -0.0460951863f, -0.0639026672f, -0.0318492089f, 0.063749552f, 0.0265740443f}, // could you
+  {-0.425816722f, -0.381086426f, -0.432869701f, -0.516090624f, -0.490371505f, 3.02319495f, -0.342211321f, -0.434748654f}, // courses
+  {-0.289976357f, -0.245687336f, -0.298571689f, -0.304798391f, -0.337425879f, -0.285210256f, 2.04271685f, -0.281046945f}, // criteria
+  {2.01774967f, -0.385337181f, -0.548459439f, -0.464235843f, -0.626482374f, -0.435494432f, -0.365365413f, 0.807625015f}, // date
+  {1.42611631f, -0.152921168f, -0.244500918f, -0.186297462f, -0.328603811f, -0.175127298f, -0.147788085f, -0.190877567f}, // date to
+  {4.22836517f, -0.439042648f, -0.886753532f, -0.559819518f, -0.638573543f, -0.515387198f, -0.631246012f, -0.557542718f}, // deadline
+  {-0.630181075f, -0.490317511f, -0.605787181f, -0.578974544f, 1.46187834f, -0.0915139453f, -0.468884437f, 1.40378035f}, // do
+  {-0.435810274f, -0.360050736f, -0.476953608f, -0.430513624f, 2.95927883f, -0.42733662f, -0.347655859f, -0.480958109f}, // do apply
+  {-0.473736978f, -0.333485198f, -0.385985876f, -0.395505056f, -0.513696324f, -0.392959522f, -0.316926252f, 2.81229521f}, // do classes
+  {-0.171699587f, -0.160258829f, -0.186544886f, -0.175887168f, -0.234462504f, 1.27253278f, -0.150684878f, -0.192994925f}, // do you
+  {-0.551192924f, 4.11691266f, -0.617070904f, -0.579666825f, -0.63930426f, -0.645910145f, -0.554441172f, -0.529326432f}, // documents
+  {-0.424808399f, 3.27806606f, -0.481099105f, -0.457704909f, -0.487800101f, -0.534109269f, -0.47803995f, -0.41450433f}, // documents are
+  {-0.21663119f, 1.53153222f, -0.218748975f, -0.225268375f, -0.247603185f, -0.241325828f, -0.1735524f, -0.208402263f}, // documents list
+  {-0.196551679f, 1.35636897f, -0.233414019f, -0.188612513f, -0.240897957f, -0.174420241f, -0.146429288f, -0.176043275f}, // documents required
+  {-0.557358021f, -0.412468484f, -0.49658388f, -0.511024586f, -0.564390773f, -0.471639713f, 3.48465329f, -0.471187834f}, // eligibility
+  {-0.289976357f, -0.245687336f, -0.298571689f, -0.304798391f, -0.337425879f, -0.285210256f, 2.04271685f, -0.281046945f}, // eligibility criteria
+  {-0.235317645f, -0.191490706f, -0.286294796f, -0.225686684f, 1.53644214f, -0.211535978f, -0.176280226f, -0.209836106f}, // explain
+  {-0.235317645f, -0.191490706f, -0.286294796f, -0.225686684f, 1.53644214f, -0.211535978f, -0.176280226f, -0.209836106f}, // explain application
+  {-0.817030327f, -0.508977468f, 4.34830501f, -0.624684724f, -0.802043609f, -0.579585426f, -0.50146551f, -0.514517942f}, // fee
+  {-0.275025134f, -0.238608949f, 1.90762272f, -0.294278031f, -0.320822079f, -0.275767841f, -0.22899953f, -0.274121156f}, // fee amount
+  {-0.185840304f, -0.160388934f, 1.25934759f, -0.183243404f, -0.235764461f, -0.17319976f, -0.146124275f, -0.174786455f}, // fee cost
+  {-0.522746003f, -0.411479586f, -0.56818948f, 3.48080541f, -0.55388152f, -0.568401598f, -0.391231189f, -0.464876036f}, // financial
+  {-0.413946327f, -0.316867285f, -0.460785387f, 2.73939647f, -0.423419178f, -0.468249942f, -0.299846507f, -0.356281846f}, // financial aid
+  {-0.288426938f, -0.243947338f, -0.293038237f, 1.95249292f, -0.334228973f, -0.27939925f, -0.23463541f, -0.278816777f}, // financial assistance
+  {-0.196551679f, 1.35636897f, -0.233414019f, -0.188612513f, -0.240897957f, -0.174420241f, -0.146429288f, -0.176043275f}, // for
+  {-0.196551679f, 1.35636897f, -0.233414019f, -0.188612513f, -0.240897957f, -0.174420241f, -0.146429288f, -0.176043275f}, // for application
+  {-0.492946395f, -0.381489532f, 0.0339702844f, -0.460600915f, 2.62150175f, -0.452026668f, -0.370736032f, -0.497672492f}, // how
+  {-0.435810274f, -0.360050736f, -0.476953608f, -0.430513624f, 2.95927883f, -0.42733662f, -0.347655859f, -0.480958109f}, // how do
+  {-0.186278062f, -0.101216068f, 0.968642822f, -0.130128827f, -0.219010642f, -0.118587092f, -0.102596716f, -0.110825415f}, // how much
+  {0.927358495f, -0.529614859f, 1.09105136f, 0.699135948f, -0.325950003f, -0.658397906f, -0.618054675f, -0.585528355f}, // is
+  {-0.181705092f, -0.134236125f, -0.184900798f, 1.17226257f, -0.18367865f, -0.209391786f, -0.126490668f, -0.151859449f}, // is financial
+  {1.57695035f, -0.499030967f, 1.4132496f, -0.589873956f, -0.135706763f, -0.582887006f, -0.634192553f, -0.548508698f}, // is the
+  {-0.40701928f, -0.313266046f, 0.245533605f, 1.97513719f, -0.426038485f, -0.429624275f, -0.294848445f, -0.349874266f}, // is there
+  {-0.0220272433f, 0.0847766257f, -0.0240389002f, -0.0512310687f, -0.0711744857f, -0.000627018321f, 0.060633168f, 0.0236889225f}, // kindly
+  {-0.127273776f, -0.106015414f, -0.13768114f, -0.126606722f, 0.861544606f, -0.124042364f, -0.102204957f, -0.137720233f}, // kindly how
+  {-0.119769966f, -0.0931202685f, -0.135901711f, 0.797928376f, -0.123663085f, -0.132672516f, -0.0882359326f, -0.104564898f}, // kindly is
+  {-0.40857949f, 0.380805922f, 0.330917346f, -0.336453169f, -0.379885752f, 0.319376268f, 0.385872272f, -0.292053398f}, // kindly what
+  {0.694518218f, -0.172401111f, -0.245212361f, -0.216392905f, -0.252030045f, -0.201394383f, -0.230435279f, 0.623347868f}, // kindly when
+  {2.55462542f, -0.289961427f, -0.447368485f, -0.344944975f, -0.515841882f, -0.324235684f, -0.27260616f, -0.359666804f}, // last
+  {2.55462542f, -0.289961427f, -0.447368485f, -0.344944975f, -0.515841882f, -0.324235684f, -0.27260616f, -0.359666804f}, // last date
+  {-0.365455005f, 1.0958537f, -0.371096688f, -0.37915235f, -0.419163579f, 1.10951105f, -0.294783534f, -0.375713593f}, // list
+  {-0.222691029f, -0.214180225f, -0.227355246f, -0.23051975f, -0.256283397f, 1.57509565f, -0.18081395f, -0.24325205f}, // list of
+  {-0.186278062f, -0.101216068f, 0.968642822f, -0.130128827f, -0.219010642f, -0.118587092f, -0.102596716f, -0.110825415f}, // much
+  {-0.186278062f, -0.101216068f, 0.968642822f, -0.130128827f, -0.219010642f, -0.118587092f, -0.102596716f, -0.110825415f}, // much is
+  {-0.171716037f, 1.30151958f, -0.188139945f, -0.185098389f, -0.199002209f, -0.207576292f, -0.184148562f, -0.165838146f}, // needed
+  {-0.357760844f, -0.326642784f, -0.368379652f, -0.374578581f, -0.411588219f, 1.11164184f, -0.293836621f, 1.02114486f}, // of
+  {-0.207381855f, -0.178484893f, -0.215482761f, -0.219770137f, -0.238496664f, -0.238764351f, -0.172414094f, 1.47079475f}, // of classes
+  {-0.222691029f, -0.214180225f, -0.227355246f, -0.23051975f, -0.256283397f, 1.57509565f, -0.18081395f, -0.24325205f}, // of courses
+  {-0.171699587f, -0.160258829f, -0.186544886f, -0.175887168f, -0.234462504f, 1.27253278f, -0.150684878f, -0.192994925f}, // offer
+  {-0.36956981f, -0.307226175f, -0.401748207f, -0.366583814f, 2.50784847f, -0.363451981f, -0.296473856f, -0.402794624f}, // online
+  {-0.289566934f, -0.242554108f, -0.295648327f, 1.95661105f, -0.33551429f, -0.282211525f, -0.23291311f, -0.278202756f}, // options
+  {-0.0220272433f, 0.0847766257f, -0.0240389002f, -0.0512310687f, -0.0711744857f, -0.000627018321f, 0.060633168f, 0.0236889225f}, // please
+  {-0.127273776f, -0.106015414f, -0.13768114f, -0.126606722f, 0.861544606f, -0.124042364f, -0.102204957f, -0.137720233f}, // please how
+  {-0.119769966f, -0.0931202685f, -0.135901711f, 0.797928376f, -0.123663085f, -0.132672516f, -0.0882359326f, -0.104564898f}, // please is
+  {-0.40857949f, 0.380805922f, 0.330917346f, -0.336453169f, -0.379885752f, 0.319376268f, 0.385872272f, -0.292053398f}, // please what
+  {0.694518218f, -0.172401111f, -0.245212361f, -0.216392905f, -0.252030045f, -0.201394383f, -0.230435279f, 0.623347868f}, // please when
+  {-0.3324651f, -0.265138361f, -0.430007063f, -0.30773096f, 2.15087604f, -0.28848708f, -0.240402009f, -0.286645464f}, // procedure
+  {-0.323139535f, -0.16243938f, -0.639498801f, -0.1868784f, 1.82371278f, -0.189807351f, -0.165250167f, -0.156699143f}, // process
+  {-0.506423925f, -0.506036772f, -0.55905037f, -0.609114321f, -0.575523763f, 3.96376815f, -0.723156696f, -0.484462306f}, // programs
+  {-0.171699587f, -0.160258829f, -0.186544886f, -0.175887168f, -0.234462504f, 1.27253278f, -0.150684878f, -0.192994925f}, // programs do
+  {-0.509793999f, 3.79842902f, -0.572728977f, -0.533922672f, -0.591367501f, -0.594290306f, -0.507212656f, -0.489112905f}, // required
+  {-0.21663119f, 1.53153222f, -0.218748975f, -0.225268375f, -0.247603185f, -0.241325828f, -0.1735524f, -0.208402263f}, // required documents
+  {-0.196551679f, 1.35636897f, -0.233414019f, -0.188612513f, -0.240897957f, -0.174420241f, -0.146429288f, -0.176043275f}, // required for
+  {-0.605121192f, -0.445748618f, -0.46678467f, -0.401657612f, -0.441326648f, -0.742720076f, 3.47159714f, -0.368238324f}, // requirements
+  {-0.289566934f, -0.242554108f, -0.295648327f, 1.95661105f, -0.33551429f, -0.282211525f, -0.23291311f, -0.278202756f}, // scholarship
+  {-0.289566934f, -0.242554108f, -0.295648327f, 1.95661105f, -0.33551429f, -0.282211525f, -0.23291311f, -0.278202756f}, // scholarship options
+  {-0.229442462f, -0.235440499f, -0.249372864f, 1.68756422f, -0.266784685f, -0.25656857f, -0.225298606f, -0.224656532f}, // scholarships
+  {-0.282397615f, -0.240875387f, -0.291614854f, -0.297787979f, -0.326370622f, -0.27782859f, -0.231785394f, 1.94866044f}, // semester
+  {-0.282397615f, -0.240875387f, -0.291614854f, -0.297787979f, -0.326370622f, -0.27782859f, -0.231785394f, 1.94866044f}, // semester start
+  {-0.702975853f, -0.522573223f, -0.61725347f, -0.632029245f, -0.754670516f, -0.623266277f, -0.500039086f, 4.35280767f}, // start
+  {-0.276090864f, -0.185180144f, -0.221906111f, -0.228369569f, -0.247666053f, -0.213453544f, -0.178379435f, 1.55104572f}, // start date
+  {-0.207381855f, -0.178484893f, -0.215482761f, -0.219770137f, -0.238496664f, -0.238764351f, -0.172414094f, 1.47079475f}, // start of
+  {-0.433798308f, -0.311586181f, -0.50007827f, -0.373938096f, 2.6091614f, -0.350638792f, -0.293493078f, -0.345628678f}, // steps
+  {-0.286161696f, -0.183074509f, -0.314861275f, -0.223833262f, 1.6000933f, -0.209975315f, -0.176534836f, -0.205652409f}, // steps to
+  {1.92032151f, -0.240619637f, -0.27873009f, -0.297039825f, -0.327594434f, -0.27818822f, -0.225363605f, -0.272785699f}, // submission
+  {1.92032151f, -0.240619637f, -0.27873009f, -0.297039825f, -0.327594434f, -0.27818822f, -0.225363605f, -0.272785699f}, // submission deadline
+  {0.63359687f, -0.606936204f, 0.564879168f, -0.656104733f, -0.377724743f, 0.3606759f, 0.668284354f, -0.586670612f}, // the
+  {1.4407446f, -0.502308999f, -0.657368227f, -0.534840717f, -0.576028894f, -0.74652923f, 2.10593662f, -0.529605152f}, // the admission
+  {-0.00850967838f, -0.453798238f, 2.26143925f, -0.503136354f, 0.118978529f, -0.526302118f, -0.46159346f, -0.427077934f}, // the application
+  {-0.357422346f, -0.387580129f, -0.411610137f, -0.414425446f, -0.381986743f, 2.94237563f, -0.667273807f, -0.322077022f}, // the available
+  {-0.487510537f, -0.40399849f, 0.104431137f, 2.64654439f, -0.523310756f, -0.521620514f, -0.382056223f, -0.432479001f}, // there
+  {-0.168645744f, -0.127446821f, 1.14670048f, -0.268571743f, -0.188616747f, -0.136572015f, -0.117067976f, -0.139779436f}, // there any
+  {-0.347388552f, -0.268735969f, -0.396772165f, 2.31646685f, -0.356605893f, -0.390727023f, -0.25461095f, -0.301626298f}, // there financial
+  {-0.229442462f, -0.235440499f, -0.249372864f, 1.68756422f, -0.266784685f, -0.25656857f, -0.225298606f, -0.224656532f}, // there scholarships
+  {0.606961598f, -0.380734568f, 0.89769536f, -0.465046719f, 0.586376796f, -0.43648166f, -0.367345837f, -0.44142497f}, // to
+  {0.606961598f, -0.380734568f, 0.89769536f, -0.465046719f, 0.586376796f, -0.43648166f, -0.367345837f, -0.44142497f}, // to apply
+  {-0.486218453f, 0.671841797f, 0.319692978f, -0.676728895f, -0.406823958f, 0.533576372f, 0.636655615f, -0.591995456f}, // what
+  {-0.656730858f, -0.563841558f, -0.59414813f, -0.550063342f, -0.557121619f, 1.37219036f, 2.01673065f, -0.467015503f}, // what are
+  {-0.424808399f, 3.27806606f, -0.481099105f, -0.457704909f, -0.487800101f, -0.534109269f, -0.47803995f, -0.41450433f}, // what documents
+  {0.0754540667f, -0.440263773f, 1.98322055f, -0.479999889f, 0.226910608f, -0.510060603f, -0.447989046f, -0.40727191f}, // what is
+  {-0.171699587f, -0.160258829f, -0.186544886f, -0.175887168f, -0.234462504f, 1.27253278f, -0.150684878f, -0.192994925f}, // what programs
+  {1.53333814f, -0.423190913f, -0.600424959f, -0.530504679f, -0.627031708f, -0.500034103f, -0.564040142f, 1.71188837f}, // when
+  {-0.473736978f, -0.333485198f, -0.385985876f, -0.395505056f, -0.513696324f, -0.392959522f, -0.316926252f, 2.81229521f}, // when do
+  {2.89826368f, -0.292069742f, -0.509739909f, -0.390797f, -0.411334477f, -0.34628539f, -0.528808945f, -0.419228217f}, // when is
+  {-0.0900723618f, 0.0115782745f, -0.0931266656f, -0.117551655f, -0.158992347f, 0.509493228f, -0.00435165706f, -0.0569768163f}, // you
+  {-0.128567325f, -0.108940158f, -0.138538922f, -0.127861647f, 0.878644737f, -0.131466874f, -0.104583098f, -0.138686714f}, // you how
+  {-0.120987596f, -0.0959985344f, -0.13641612f, 0.814965874f, -0.124926458f, -0.139000559f, -0.0907302582f, -0.106906349f}, // you is
+  {-0.171699587f, -0.160258829f, -0.186544886f, -0.175887168f, -0.234462504f, 1.27253278f, -0.150684878f, -0.192994925f}, // you offer
+  {-0.403724682f, 0.389000178f, 0.344347982f, -0.338043382f, -0.379828793f, 0.293839608f, 0.392560619f, -0.298151531f}, // you what
+  {0.696680934f, -0.177480606f, -0.245069271f, -0.218051186f, -0.251953946f, -0.214075095f, -0.229337721f, 0.639286891f}, // you when
+};
+
+const float LINEAR_INTERCEPT[LINEAR_NUM_LABELS] PROGMEM = {
+  0.0327812639f, -0.161922199f, 0.0626165933f, 0.0823348106f, 0.198846376f, 0.00446575884f, -0.208751416f, -0.0103711877f,
+};
+
+const Intent LINEAR_LABEL_INTENTS[LINEAR_NUM_LABELS] = {
+  Intent::Deadline,
+  Intent::Documents,
+  Intent::Fee,
+  Intent::FinancialAid,
+  Intent::Process,
+  Intent::Programs,
+  Intent::Requirements,
+  Intent::Schedule,
+};
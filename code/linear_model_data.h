@@ -0,0 +1,21 @@
+// linear_model_data.h - GENERATED by tools/export_linear_model.py; do not edit.
+#ifndef LINEAR_MODEL_DATA_H
+#define LINEAR_MODEL_DATA_H
+
+#include <Arduino.h>
+#include "intents.h"
+
+#define LINEAR_NUM_TERMS 134
+#define LINEAR_NUM_LABELS 8
+#define LINEAR_HASH_SLOTS 512 // power of two, linear probing
+#define LINEAR_EMPTY_SLOT 0xFFFF
+#define LINEAR_MAX_NGRAM 2
+
+extern const uint32_t LINEAR_TERM_HASH[LINEAR_HASH_SLOTS];
+extern const uint16_t LINEAR_TERM_INDEX[LINEAR_HASH_SLOTS];
+extern const float LINEAR_IDF[LINEAR_NUM_TERMS];
+extern const float LINEAR_WEIGHTS[LINEAR_NUM_TERMS][LINEAR_NUM_LABELS];
+extern const float LINEAR_INTERCEPT[LINEAR_NUM_LABELS];
+extern const Intent LINEAR_LABEL_INTENTS[LINEAR_NUM_LABELS];
+
+#endif // LINEAR_MODEL_DATA_H
@@ -3,26 +3,51 @@
 #include "stt_module.h"
 #include "tts_module.h"
 #include "utils.h"
+#include "button_input.h"
 #include "faq_responder.h"
+#include "scheduler.h"
+
+// ESP32: answers come from the "faqdb" flash partition when
+// esp32/faq_db_partition.* sits next to the sketch (with partitions.csv) and
+// the image is flashed; otherwise from the compiled-in table.
+#if defined(ARDUINO_ARCH_ESP32) && __has_include("faq_db_partition.h")
+#include "faq_db_partition.h"
+#define FAQ_DB_FROM_FLASH 1
+#endif
 
 // Global variables
 bool isListening = false;
 bool isProcessing = false;
-String currentQuery = "";
-String currentResponse = "";
+bool isResponding = false;
+char currentQuery[STT_LINE_MAX + 1] = "";   // filled in place by g_stt, no heap
+size_t currentQueryLen = 0;
+Intent currentIntent = Intent::Unknown;
 
 // Modules
 AdmissionModel g_model;
 STTModule g_stt;
 TTSModule g_tts;
+ButtonInput g_button;
+LedBlinker g_led;
+Scheduler g_scheduler;
+#if FAQ_DB_FROM_FLASH
+FaqDbPartition g_faqDb;
+#endif
 
 // Function declarations
 void setupSystem();
 void handleUserInput();
-void processQuery(String query);
+void processQuery(const char *query, size_t len);
 void provideFeedback();
 void initializeComponents();
 
+// Scheduler tasks; each returns immediately so the button is polled every pass.
+void taskButton();
+void taskSTT();
+void taskClassify();
+void taskTTS();
+void taskLED();
+
 void setup() {
   Serial.begin(SERIAL_BAUD_RATE);
   
@@ -37,36 +62,58 @@ void setup() {
   g_stt.begin();
   g_tts.begin(SPEAKER_PIN);
   setupSystem();
+
+  g_scheduler.add(taskButton);
+  g_scheduler.add(taskSTT);
+  g_scheduler.add(taskClassify);
+  g_scheduler.add(taskTTS);
+  g_scheduler.add(taskLED);
   
   Serial.println("System ready! Say 'Hello' to start...");
 }
 
 void loop() {
+  g_scheduler.run();
+}
+
+void taskButton() {
   handleUserInput();
-  
-  if (isListening) {
-    if (g_stt.available()) {
-      currentQuery = g_stt.readUtterance();
-      if (currentQuery.length() > 0) {
-        isListening = false;
-        isProcessing = true;
-        processQuery(currentQuery);
-      }
+}
+
+void taskSTT() {
+  if (isListening && g_stt.available()) {
+    currentQueryLen = g_stt.readUtterance(currentQuery, sizeof(currentQuery));
+    if (currentQueryLen > 0) {
+      isListening = false;
+      isProcessing = true;
     }
   }
-  
+}
+
+void taskClassify() {
   if (isProcessing) {
-    provideFeedback();
+    processQuery(currentQuery, currentQueryLen);
     isProcessing = false;
+    isResponding = true;
+  }
+}
+
+void taskTTS() {
+  g_tts.update();
+  if (isResponding) {
+    provideFeedback();
+    isResponding = false;
   }
-  
-  delay(100);
+}
+
+void taskLED() {
+  g_led.update();
 }
 
 void initializeComponents() {
   // Initialize pins
   pinMode(LED_PIN, OUTPUT);
-  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  g_button.begin(BUTTON_PIN);
   pinMode(MIC_PIN, INPUT);
   pinMode(SPEAKER_PIN, OUTPUT);
   
@@ -90,6 +137,14 @@ void setupSystem() {
   
   // Load FAQ database
   Serial.println("Loading FAQ database...");
+#if FAQ_DB_FROM_FLASH
+  if (g_faqDb.begin() && faqSetDatabase(&g_faqDb.db())) {
+    Serial.println("FAQ database: " + String(g_faqDb.db().faqCount()) + " FAQs from the faqdb partition");
+  } else {
+    g_faqDb.end();   // missing, damaged or built for other categories
+    Serial.println("FAQ database: built-in answers");
+  }
+#endif
   
   digitalWrite(LED_PIN, LOW);
   delay(500);
@@ -97,30 +152,44 @@ void setupSystem() {
 }
 
 void handleUserInput() {
-  // Check for button press or voice activation
-  if (digitalRead(BUTTON_PIN) == LOW && !isListening && !isProcessing) {
+  // Edges arrive from the button ISR; a press that comes while busy is dropped.
+  g_button.update();
+  unsigned long edgeUs;
+  bool fresh = g_button.takePress(&edgeUs);
+  if (fresh && !isListening && !isProcessing && !isResponding) {
     isListening = true;
-    Serial.println("\n🎤 Listening... Please ask your question:");
+    g_led.stop();
     digitalWrite(LED_PIN, LOW);
+    g_button.recordLatency(micros() - edgeUs);
+    Serial.println("\n🎤 Listening... Please ask your question:");
+    if (DEBUG_MODE) {
+      Serial.print(F("[BTN] press-to-listen "));
+      Serial.print(g_button.lastLatencyUs());
+      Serial.print(F(" us (max "));
+      Serial.print(g_button.maxLatencyUs());
+      Serial.println(F(" us)"));
+    }
   }
 }
 
-void processQuery(String query) {
-  Serial.println("Processing query: " + query);
-  ClassificationResult r = g_model.classify(query);
-  currentResponse = faqResponseForCategory(r.category);
+void processQuery(const char *query, size_t len) {
+  Serial.print(F("Processing query: "));
+  Serial.println(query);
+  ClassificationResult r = g_model.classify(query, len);
+  currentIntent = r.intent;
   if (DEBUG_MODE) {
-    Serial.print(F("[ML] Category: ")); Serial.print(r.category); Serial.print(F(" (confidence=")); Serial.print(r.confidence, 3); Serial.println(F(")"));
+    Serial.print(F("[ML] Category: ")); Serial.print(intentName(r.intent)); Serial.print(F(" (confidence=")); Serial.print(r.confidence, 3); Serial.println(F(")"));
   }
 }
 
 void provideFeedback() {
-  g_tts.speak(currentResponse);
+  g_tts.speak(faqResponse(currentIntent));
   Serial.println("\nPress the button and ask another question, or type 'exit' to quit.");
   
-  // Blink LED to indicate response
-  blinkLED(LED_PIN, 3, 200, 200);
+  // Blink LED to indicate response (runs in taskLED; a new press cuts it short)
+  g_led.start(LED_PIN, 3, 200, 200);
   
-  currentQuery = "";
-  currentResponse = "";
+  currentQuery[0] = '\0';
+  currentQueryLen = 0;
+  currentIntent = Intent::Unknown;
 }
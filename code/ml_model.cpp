@@ -1,67 +1,194 @@
-// ml_model.cpp - Lightweight placeholder model for embedded classification
+// ml_model.cpp - Keyword automaton classifier and the trained-model paths
 #include "ml_model.h"
 #include "config.h"
-
-// Simple keyword tables per category (could move to PROGMEM if needed)
-static const char *REQ_WORDS[] = {"requirement", "eligibility", "criteria"};
-static const char *DEADLINE_WORDS[] = {"deadline", "last date", "timeline"};
-static const char *FEE_WORDS[] = {"fee", "cost", "payment", "charge"};
-static const char *PROCESS_WORDS[] = {"apply", "application", "process", "online"};
-static const char *DOC_WORDS[] = {"document", "documents", "papers", "certificates"};
-static const char *GREETING_WORDS[] = {"hello", "hi", "hey"};
+#include "featurizer.h"
+#include "keyword_automaton.h"
+#include "neural_model.h"
+#if USE_LINEAR_MODEL
+#include "linear_model.h"
+#endif
 
 bool AdmissionModel::begin() {
-	// Placeholder for real TFLite Micro model initialization
-	// In a future iteration: load model from flash and allocate tensors
+	// The keyword automaton is generated offline (tools/gen_keyword_automaton.py)
+	// and read straight from flash, so there is nothing to build here.
 	if (DEBUG_MODE) {
-		Serial.println(F("[ML] Model initialized (stub)"));
+		Serial.print(F("[ML] Model initialized ("));
+		Serial.print(KW_NUM_KEYWORDS);
+		Serial.print(F(" keywords / "));
+		Serial.print(KW_NUM_STATES);
+		Serial.println(F(" automaton states in flash)"));
 	}
 	return true;
 }
 
-String AdmissionModel::normalize(const String &in) const {
-	String out = in; 
-	out.toLowerCase();
-	return out;
+// Advance the automaton by one input class.
+static kw_state_t kwStep(kw_state_t s, uint8_t cls) {
+#ifdef KW_HAS_DELTA
+	return KW_READ_STATE(&KW_DELTA[(uint16_t)s * KW_NUM_CLASSES + cls]);
+#else
+	// Sparse tables (AVR): scan this state's edges, then follow failure links.
+	if (cls == 0) return 0; // character appears in no keyword
+	while (s != 0) {
+		uint16_t e = pgm_read_word(&KW_EDGE_START[s]);
+		uint16_t end = pgm_read_word(&KW_EDGE_START[s + 1]);
+		for (; e < end; ++e) {
+			if (pgm_read_byte(&KW_EDGE_CLASS[e]) == cls) return KW_READ_STATE(&KW_EDGE_NEXT[e]);
+		}
+		s = KW_READ_STATE(&KW_FAIL[s]);
+	}
+	return KW_READ_STATE(&KW_ROOT_NEXT[cls]);
+#endif
 }
 
-static float scoreCategory(const String &text, const char **words, size_t count) {
-	float hits = 0;
-	for (size_t i = 0; i < count; ++i) {
-		if (text.indexOf(words[i]) >= 0) {
-			hits += 1.0f;
-		}
+// Feed one byte to the automaton, collecting any keywords that end there.
+static inline kw_state_t kwFeed(kw_state_t s, uint8_t c, kw_mask_t &hits) {
+	s = kwStep(s, c < 128 ? pgm_read_byte(&KW_CHAR_CLASS[c]) : 0);
+	uint8_t out = pgm_read_byte(&KW_STATE_OUTPUT[s]);
+	if (out) {
+		kw_mask_t m;
+		memcpy_P(&m, &KW_OUTPUT_MASK[out - 1], sizeof(m));
+		hits |= m;
+	}
+	return s;
+}
+
+// Single pass over the text; returns the set of keywords found anywhere in it
+// (case-insensitive substring match, same semantics as String::indexOf).
+static kw_mask_t scanKeywords(const char *text, size_t len) {
+	kw_mask_t hits = 0;
+	kw_state_t s = 0;
+	for (size_t i = 0; i < len; ++i) s = kwFeed(s, (uint8_t)text[i], hits);
+	return hits;
+}
+
+// Queries scored together by classifyBatch(), and how many of them walk the
+// automaton in lockstep. Each walk is a chain of dependent table loads; with
+// several independent chains interleaved their latencies overlap.
+static const size_t BATCH_BLOCK = 64;
+static const uint8_t BATCH_LANES = 8;
+
+// scanKeywords() for up to BATCH_LANES queries: in lockstep up to the
+// shortest one, then each remainder on its own.
+static void scanKeywordLanes(const char *const *texts, const size_t *lens, uint8_t n, kw_mask_t *hits) {
+	kw_state_t s[BATCH_LANES];
+	size_t common = (size_t)-1;
+	for (uint8_t k = 0; k < n; ++k) {
+		s[k] = 0;
+		hits[k] = 0;
+		if (lens[k] < common) common = lens[k];
+	}
+	for (size_t i = 0; i < common; ++i) {
+		for (uint8_t k = 0; k < n; ++k) s[k] = kwFeed(s[k], (uint8_t)texts[k][i], hits[k]);
+	}
+	for (uint8_t k = 0; k < n; ++k) {
+		for (size_t i = common; i < lens[k]; ++i) s[k] = kwFeed(s[k], (uint8_t)texts[k][i], hits[k]);
 	}
-	if (count == 0) return 0;
-	return hits / (float)count; // simple fractional match
 }
 
-ClassificationResult AdmissionModel::classify(const String &raw) {
-	String text = normalize(raw);
-	ClassificationResult best{"unknown", 0.0f};
-
-	struct Cat { const char *name; const char **words; size_t n; };
-	const Cat cats[] = {
-		{"requirements", REQ_WORDS, sizeof(REQ_WORDS)/sizeof(char*)},
-		{"deadline", DEADLINE_WORDS, sizeof(DEADLINE_WORDS)/sizeof(char*)},
-		{"fee", FEE_WORDS, sizeof(FEE_WORDS)/sizeof(char*)},
-		{"process", PROCESS_WORDS, sizeof(PROCESS_WORDS)/sizeof(char*)},
-		{"documents", DOC_WORDS, sizeof(DOC_WORDS)/sizeof(char*)},
-		{"greeting", GREETING_WORDS, sizeof(GREETING_WORDS)/sizeof(char*)}
-	};
-
-	for (auto &c : cats) {
-		float s = scoreCategory(text, c.words, c.n);
+static uint8_t countBits(kw_mask_t m) {
+	uint8_t n = 0;
+	for (; m; m &= m - 1) ++n;
+	return n;
+}
+
+// Keyword scores below this go to the fallback model (or Unknown).
+static const float KEYWORD_MIN_SCORE = 0.15f;
+
+#if USE_LINEAR_MODEL
+// No keyword: fall back to the trained TF-IDF model, like the simulator.
+static void linearFallback(const char *text, size_t len, ClassificationResult &r) {
+	float logits[LINEAR_NUM_LABELS];
+	LinearClassifier::logits(text, len, logits);
+	r.intent = LinearClassifier::predict(logits, &r.confidence);
+	if (r.confidence < LINEAR_MIN_CONFIDENCE) r.intent = Intent::Unknown;
+}
+#endif
+
+ClassificationResult AdmissionModel::classify(const char *text, size_t len) const {
+	kw_mask_t hits = scanKeywords(text, len);
+	ClassificationResult best{Intent::Unknown, 0.0f};
+
+	for (uint8_t c = 0; c < KW_NUM_CATEGORIES && hits; ++c) {
+		kw_mask_t mask;
+		memcpy_P(&mask, &KW_CATEGORY_MASK[c], sizeof(mask));
+		uint8_t count = pgm_read_byte(&KW_CATEGORY_KEYWORDS[c]);
+		if (count == 0) continue;
+		float s = countBits(hits & mask) / (float)count; // simple fractional match
 		if (s > best.confidence) {
-			best.category = c.name;
+			best.intent = (Intent)c;
 			best.confidence = s;
 		}
 	}
 
 	// Apply a simple threshold
-	if (best.confidence < 0.15f) {
-		best.category = "unknown";
+	if (best.confidence < KEYWORD_MIN_SCORE) {
+		best.intent = Intent::Unknown;
 	}
+#if USE_LINEAR_MODEL
+	if (best.intent == Intent::Unknown) linearFallback(text, len, best);
+#endif
 	return best;
 }
 
+void AdmissionModel::classifyBatch(const char *const *texts, const size_t *lens, size_t count,
+		ClassificationResult *out) const {
+	if (count == 1) { // nothing to interleave with
+		out[0] = classify(texts[0], lens[0]);
+		return;
+	}
+	kw_mask_t hits[BATCH_BLOCK];
+	for (size_t base = 0; base < count; base += BATCH_BLOCK) {
+		size_t n = count - base < BATCH_BLOCK ? count - base : BATCH_BLOCK;
+		const char *const *t = texts + base;
+		const size_t *l = lens + base;
+		ClassificationResult *r = out + base;
+
+		for (size_t q = 0; q < n; q += BATCH_LANES) {
+			uint8_t lanes = n - q < BATCH_LANES ? (uint8_t)(n - q) : BATCH_LANES;
+			scanKeywordLanes(t + q, l + q, lanes, hits + q);
+		}
+		for (size_t q = 0; q < n; ++q) r[q] = ClassificationResult{Intent::Unknown, 0.0f};
+
+		// Category-major: one mask load per category for the whole block.
+		for (uint8_t c = 0; c < KW_NUM_CATEGORIES; ++c) {
+			kw_mask_t mask;
+			memcpy_P(&mask, &KW_CATEGORY_MASK[c], sizeof(mask));
+			uint8_t kwCount = pgm_read_byte(&KW_CATEGORY_KEYWORDS[c]);
+			if (kwCount == 0) continue;
+			float denom = (float)kwCount;
+			for (size_t q = 0; q < n; ++q) {
+				kw_mask_t m = hits[q] & mask;
+				if (!m) continue;
+				float s = countBits(m) / denom; // same expression as classify()
+				if (s > r[q].confidence) {
+					r[q].intent = (Intent)c;
+					r[q].confidence = s;
+				}
+			}
+		}
+
+		for (size_t q = 0; q < n; ++q) {
+			if (r[q].confidence < KEYWORD_MIN_SCORE) r[q].intent = Intent::Unknown;
+#if USE_LINEAR_MODEL
+			if (r[q].intent == Intent::Unknown) linearFallback(t[q], l[q], r[q]);
+#endif
+		}
+	}
+}
+
+ClassificationResult AdmissionModel::classifyNeural(const char *text, size_t len) const {
+	float features[MODEL_INPUT_SIZE];
+	HashedFeaturizer::featurize(text, len, features);
+	int8_t logits[NEURAL_NUM_LABELS];
+	NeuralClassifier::logits(features, logits);
+	ClassificationResult r;
+	r.intent = NeuralClassifier::predict(logits, &r.confidence);
+	if (r.confidence < CONFIDENCE_THRESHOLD) r.intent = Intent::Unknown;
+	return r;
+}
+
+const __FlashStringHelper *intentName(Intent intent) {
+	uint8_t i = (uint8_t)intent;
+	if (i > KW_NUM_CATEGORIES) i = KW_NUM_CATEGORIES;
+	return reinterpret_cast<const __FlashStringHelper *>(pgm_read_ptr(&KW_CATEGORY_NAMES[i]));
+}
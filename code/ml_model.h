@@ -1,21 +1,38 @@
-// ml_model.h - Stub ML model interface for Admission Assistant
+// ml_model.h - ML model interface for Admission Assistant
 #ifndef ML_MODEL_H
 #define ML_MODEL_H
 
 #include <Arduino.h>
+#include "config.h"
+#include "intents.h"
 
 struct ClassificationResult {
-  String category;
+  Intent intent;
   float confidence; // 0..1
 };
 
 class AdmissionModel {
  public:
   bool begin();               // Initialize / load model
-  ClassificationResult classify(const String &text); // Classify a query
+  // Classify a query. Matching is case-insensitive and reads the text in
+  // place: no copies, no heap allocation. Queries with no keyword go to the
+  // exported TF-IDF classifier (USE_LINEAR_MODEL).
+  ClassificationResult classify(const char *text, size_t len) const;
+  ClassificationResult classify(const String &text) const { return classify(text.c_str(), text.length()); }
+  // Classify `count` queries at once (texts[i] / lens[i]); out[i] is exactly
+  // classify(texts[i], lens[i]). Queries are scored in blocks with per-query
+  // state held as parallel arrays: the automaton advances several queries in
+  // lockstep and each category's masks are loaded once per block.
+  void classifyBatch(const char *const *texts, const size_t *lens, size_t count, ClassificationResult *out) const;
 
- private:
-  String normalize(const String &in) const;
+  // The int8 neural network (code/neural_model.h) on the query's hashed
+  // features, without the keyword automaton. Probabilities below
+  // CONFIDENCE_THRESHOLD give Unknown. Not reentrant: the network's
+  // activations share one static arena.
+  ClassificationResult classifyNeural(const char *text, size_t len) const;
 };
 
+// Category name for logs and lookups ("fee", "unknown", ...), from flash.
+const __FlashStringHelper *intentName(Intent intent);
+
 #endif // ML_MODEL_H
@@ -0,0 +1,72 @@
+// neural_model.cpp - int8 fully connected layers in a static tensor arena
+#include "neural_model.h"
+
+static_assert(NEURAL_NUM_LABELS <= MODEL_OUTPUT_SIZE, "more labels than MODEL_OUTPUT_SIZE");
+static_assert(NEURAL_NUM_LABELS <= MODEL_INPUT_SIZE, "the logits reuse the input tensor's bytes");
+
+// Tensor plan: input [0, MODEL_INPUT_SIZE), hidden right after it, and the
+// logits back at 0 once layer 1 has consumed the input.
+alignas(16) static int8_t g_arena[MODEL_TENSOR_ARENA_SIZE];
+static size_t g_arenaHighWater = 0;
+
+static int8_t *tensor(size_t offset, size_t size) {
+	if (offset + size > g_arenaHighWater) g_arenaHighWater = offset + size;
+	return g_arena + offset;
+}
+
+// acc * M / 2^S, rounded half up, plus the output zero point, clamped to
+// [lo, 127]. The product needs 64 bits.
+static inline int8_t requantize(int32_t acc, int32_t mult, uint8_t shift, int8_t zero, int8_t lo) {
+	int32_t v = (int32_t)(((int64_t)acc * mult + ((int64_t)1 << (shift - 1))) >> shift) + zero;
+	return (int8_t)constrain(v, (int32_t)lo, (int32_t)127);
+}
+
+void NeuralClassifier::logits(const float *features, int8_t *out) {
+	NeuralQuantParams q;
+	memcpy_P(&q, &NEURAL_QUANT, sizeof(q));
+
+	// Features are in [-1, 1]: scale 1/127, zero point 0.
+	int8_t *in = tensor(0, MODEL_INPUT_SIZE);
+	for (size_t i = 0; i < MODEL_INPUT_SIZE; ++i) {
+		in[i] = (int8_t)constrain(lroundf(features[i] * 127.0f), -127L, 127L);
+	}
+
+	// Clamping at the zero point is the ReLU.
+	int8_t *hidden = tensor(MODEL_INPUT_SIZE, MODEL_HIDDEN_SIZE);
+	for (size_t j = 0; j < MODEL_HIDDEN_SIZE; ++j) {
+		int32_t acc = (int32_t)pgm_read_dword(&NEURAL_B1[j]);
+		for (size_t i = 0; i < MODEL_INPUT_SIZE; ++i) {
+			acc += (int8_t)pgm_read_byte(&NEURAL_W1[j][i]) * in[i];
+		}
+		hidden[j] = requantize(acc, q.hiddenMultiplier, q.hiddenShift, q.hiddenZero, q.hiddenZero);
+	}
+
+	int8_t *z = tensor(0, NEURAL_NUM_LABELS);
+	for (size_t k = 0; k < NEURAL_NUM_LABELS; ++k) {
+		int32_t acc = (int32_t)pgm_read_dword(&NEURAL_B2[k]);
+		for (size_t j = 0; j < MODEL_HIDDEN_SIZE; ++j) {
+			acc += (int8_t)pgm_read_byte(&NEURAL_W2[k][j]) * (hidden[j] - q.hiddenZero);
+		}
+		z[k] = requantize(acc, q.outputMultiplier, q.outputShift, q.outputZero, -128);
+	}
+	memcpy(out, z, NEURAL_NUM_LABELS);
+}
+
+Intent NeuralClassifier::predict(const int8_t *logits, float *confidence) {
+	uint8_t best = 0;
+	for (uint8_t k = 1; k < NEURAL_NUM_LABELS; ++k) {
+		if (logits[k] > logits[best]) best = k;
+	}
+	float scale;
+	memcpy_P(&scale, &NEURAL_QUANT.outputScale, sizeof(scale));
+	float sum = 0.0f;
+	for (uint8_t k = 0; k < NEURAL_NUM_LABELS; ++k) {
+		sum += expf((logits[k] - logits[best]) * scale);
+	}
+	if (confidence) *confidence = 1.0f / sum;
+	return NEURAL_LABEL_INTENTS[best];
+}
+
+size_t NeuralClassifier::arenaUsedBytes() {
+	return g_arenaHighWater;
+}
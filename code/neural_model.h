@@ -0,0 +1,32 @@
+// neural_model.h - int8 neural intent scorer over hashed features
+//
+// Runs the network trained and quantized by ml_model/training/train_int8_model.py
+// (weights in code/neural_model_data.cpp) with TFLite Micro's int8 arithmetic:
+// int32 accumulators, integer requantization, ReLU folded into the clamp. The
+// logits match the script's integer reference exactly. Activations live in
+// one static MODEL_TENSOR_ARENA_SIZE arena, so inference never touches the
+// heap; for the same reason it is not reentrant.
+#ifndef NEURAL_MODEL_H
+#define NEURAL_MODEL_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "neural_model_data.h"
+
+class NeuralClassifier {
+ public:
+  // Quantize a MODEL_INPUT_SIZE feature vector (HashedFeaturizer output), run
+  // both layers and copy out the int8 logits, in NEURAL_LABEL_INTENTS order.
+  static void logits(const float *features, int8_t *out);
+
+  // Softmax over the dequantized logits; returns the winning label's intent
+  // and probability.
+  static Intent predict(const int8_t *logits, float *confidence);
+
+  // Arena bytes the layers have touched so far (high-water mark), and the
+  // bytes reserved for them in config.h.
+  static size_t arenaUsedBytes();
+  static constexpr size_t arenaSize() { return MODEL_TENSOR_ARENA_SIZE; }
+};
+
+#endif // NEURAL_MODEL_H
@@ -0,0 +1,389 @@
+// neural_model_data.cpp - GENERATED by ml_model/training/train_int8_model.py from
+// ml_model/training/artifacts/processed_dataset.json; do not edit.
+#include "neural_model_data.h"
+
+alignas(16) const int8_t NEURAL_W1[MODEL_HIDDEN_SIZE][MODEL_INPUT_SIZE] PROGMEM = {
+  {
+     -39,   60,    0,  -99,   85,   56,  -92,    0,    0,    0,   31,    0,    0,    5,    0,   65,
+     -50,    0,  -60,    0,  -35,    2,    0,    9,  -88,   56,   56,  -26,  -61,    0,    0,   37,
+     -57,  -60,    5,    0,   64,   36,    0,  -44,   69,    0,  -44,  -61,    0,    0,  -40,  -27,
+       0,   58,   88,   29,  -93,   85,  -68,   39,  -83,    0,  -28,    7,  -18,   35,    1,   74,
+     -38,   57,    0,   58,   29,   64,   32,    0,    0,  -48,  -29,    0,   68,   60,  -42,  -26,
+       0,    0,    8,    0,    0,   70,    0,   47,    0,    5,   52,    0,  -35,  -19,    0,  -65,
+      50,    0,  -20,   15,    6,   63,    0,   40,  -28,  -44,  -69,    0,   -7,   71,    0,  -43,
+       0,    0,  -51,    0,    0,   -2,   57,   59,    0,   36,   87,    0,   22,    0,    0,   59,
+  },
+  {
+      40,  -75,    0,   64,  -69,   22,  -44,    0,    0,    0,  -39,    0,    0,   24,    0,  -59,
+      32,    0,    0,    0,   41,   30,    0,   28,   15,   95,    7,   -8,  -34,    0,    0,  -27,
+      51,  -28,   37,    0,  -14,    8,    0,   44,  -39,    0,   36,   16,    0,    0,   13,   42,
+       0,  -28,  -10,   65,   -7,   63,   29,  -26,   90,    0,   20,   72,  -38,  -16,   33,  -13,
+      48,   33,    0,  -19,  -31,   37,   21,    0,    0,   31,   25,    0,  -36,  -23,   -2,   46,
+       0,    0,  -25,    0,    0,   10,    0,  -17,    0, -102,  -15,    0,    6,   39,    0,  100,
+      -9,    0,  -12,    8,   47,   -9,    0,  -11,   57,  -35,  -27,    0,   -2,  -90,    0,  -42,
+       0,    0,   20,    0,    0,   15,   42,   -2,    0,    9,  -67,    0,   37,    0,    0,    0,
+  },
+  {
+     -43,   64,    0,   58,   24,  -45,   40,    0,    0,    0,   40,    0,    0,  -45,    0,  -80,
+     -35,    0,   63,    0,   50,  -40,    0,   -7,   63,   42,   48,  -27,   54,    0,    0,  -72,
+     -67,  -21,  -23,    0,  -27,   34,    0,   25,  -87,    0,  -33,   17,    0,    0,  -19,  -84,
+       0,  -43,   -4,    0,  -56,  -40,  -15,  -18,   45,    0,   42,  -49,  -75,  -45,   11,   40,
+      70,   14,    0,   31,   30,  -76,   32,    0,    0,   52,    0,    0,  -39,   70,   11,  -14,
+       0,    0,   37,    0,    0,   43,    0,  -29,    0,  -51,  -33,    0,   -2,  -27,    0,   92,
+     -27,    0,  -58,   57,   34,   57,    0,   28,   62,   17,   -1,    0,   -4,  -32,    0,   70,
+       0,    0,   62,    0,    0,   36,  -51,  -11,    0,   26,   39,    0,   31,    0,    0,  -98,
+  },
+  {
+     -18,   -9,    0,   68,   62,   52,  -55,    0,    0,    0,  -45,    0,    0,  -33,    0,    6,
+       6,    0,   48,    0,   15,   18,    0,  -53,   50,  -66,  -76,   55,  -23,    0,    0,    7,
+      70,   56,   20,    0,  -45,  -64,    0,   64,  -74,    0,    6,  -59,    0,    0,   20,  -42,
+       0,  -92,  -81,  -13,   31,  -53,   -1,   56,  -45,    0,   42,  -62,   93,  -64,    0,  -59,
+     -46,   15,    0,   20,   35,  -44,   15,    0,    0,   26,    4,    0,   -8,   77,  -40,    9,
+       0,    0,   17,    0,    0,    2,    0,   51,    0,   42,  -46,    0,    5,  -31,    0,  -76,
+     -43,    0,   65,   17,  -18,  -19,    0,  -24,   20,   39,   34,    0,   31,  -39,    0,  -26,
+       0,    0,  -79,    0,    0,   48,  -43,  -47,    0,  -68,   45,    0,  -56,    0,    0,  -43,
+  },
+  {
+     -12,   64,    0, -127,   92,   80,  -87,    0,    0,    0,   21,    0,    0,    8,    0,   41,
+       0,    0,    0,    0,  -18,   -2,    0,  -39,  -39,   49,   34,  -36,  -84,    0,    0,   33,
+      33,  -48,   13,    0,   25,   29,    0,   -3,   -7,    0,    0,  -83,    0,    0,   15,  -39,
+       0,  -16,  -67,   66,  -48,   96,  -42,   77,  -21,    0,    3,   11,   16,   41,    8,   58,
+     -46,   78,    0,   36,   13,   -2,  -10,    0,    0,  -48,  -14,    0,   65,   14,  -50,   25,
+       0,    0,   16,    0,    0,   54,    0,  -11,    0,  -67,   37,    0,  -36,   40,    0,  -19,
+      28,    0,  -55,   10,    2,  -84,    0,  -15,  -33,  -38,  -32,    0,    0,  106,    0,  -94,
+       0,    0,  -25,    0,    0,   60,   46,   27,    0,   23,  102,    0,   25,    0,    0,   34,
+  },
+  {
+      -4,   62,    0,   54,   58,   16,  -65,    0,    0,    0,   78,    0,    0,   -4,    0,   74,
+     -37,    0,   46,    0,    6,  -34,    0,  -40,   49,  -11,   33,  -16,  -40,    0,    0,   28,
+     -92,  -26,  -37,    0,  -23,    7,    0,  -71,  -72,    0,  -37,  -66,    0,    0,  -50,  -81,
+       0,  -57,  -63,   -7,  -26,  -31,  -42,   47,   55,    0,   35,  -30,   21,  -43,   -7,   36,
+      -8,   27,    0,   31,    4,  -52,   34,    0,    0,   44,    0,    0,  -25,   44,  -71,  -14,
+       0,    0,    4,    0,    0,   -1,    0,  -22,    0,   32,  -19,    0,   -4,  -28,    0,  -74,
+     -26,    0,  -27,    7,  -11,   61,    0,   35,   33,    7,    5,    0,   -3,  -52,    0,   37,
+       0,    0,  -46,    0,    0,   61,  -37,  -10,    0,   11,   22,    0,   32,    0,    0,  -16,
+  },
+  {
+      31,  -48,    0,   61,  -34,   20,  -40,    0,    0,    0,  -24,    0,    0,   26,    0,   10,
+       4,    0,   -9,    0,    7,   -5,    0,    4,  -13,  -21,  -29,   16,  -16,    0,    0,    3,
+      18,   17,   -8,    0,  -12,  -16,    0,    2,   29,    0,    4,  -47,    0,    0,    0,  -11,
+       0,    8,  -19,  -18,   51,  -33,    5,   24,   -4,    0,    0,    4,   65,    9,    7,  -36,
+      -9,    9,    0,   -6,  -29,   21,  -32,    0,    0,    1,    4,    0,  -54,   40,  -84,    0,
+       0,    0,  -31,    0,    0,  -47,    0,    0,    0,   17,    4,    0,    4,   -9,    0,  -25,
+      -9,    0,   17,    0,   -8,  -24,    0,    0,   -6,   14,    2,    0,    2,  -76,    0,   21,
+       0,    0,  -37,    0,    0,   20,    0,  -10,    0,  -17,  -93,    0,  -15,    0,    0,    2,
+  },
+  {
+      45,    1,    0,  -33,  -43,   38,  -56,    0,    0,    0,  -46,    0,    0,   34,    0,  -44,
+      36,    0,    0,    0,   47,  -52,    0,   39,  -44,  -42,   34,  -23,  -33,    0,    0,  -23,
+      44,  -18,  -56,    0,   43,   25,    0,    5,   40,    0,   36,  -81,    0,    0,    0,   -3,
+       0,   15,  -24,  -80,   59,  -69,   19,   27,  -12,    0,  -16,   45,   10,   18,   44,   37,
+      41,   63,    0,    0,  -32,   37,   12,    0,    0,  -42,   -4,    0,  -63,    0,  -24,  -25,
+       0,    0,  -51,    0,    0,  -42,    0,    5,    0,   58,   19,    0,  -11,   31,    0,   45,
+      37,    0,    1,   18,   -6,  -75,    0,    0,   10,    2,   44,    0,   -3,   59,    0,   81,
+       0,    0,  -30,    0,    0,   50,  -29,   18,    0,   18,  -68,    0,   19,    0,    0,  -23,
+  },
+  {
+     -48,   61,    0, -106,   33,  -61,   27,    0,    0,    0,    9,    0,    0,  -23,    0,   60,
+     -27,    0,   19,    0,  -22,    6,    0,  -56,   79,  -62,   -9,   30,    6,    0,    0,   15,
+     -39,   26,   12,    0,   22,  -22,    0,  -19,  -66,    0,  -59,   45,    0,    0,  -32,  -27,
+       0,  -74,   30,  -97,  -54,  -74,  -61,   -5,  -90,    0,   30,  -33,   46,   -3,  -50,  -10,
+     -50,  -71,    0,   50,   50,   28,   45,    0,    0,  -55,  -20,    0,    3,   51,   59,  -17,
+       0,    0,   27,    0,    0,   38,    0,   56,    0,   43,   28,    0,  -25,  -48,    0,  -60,
+      27,    0,   32,   26,   -2,   80,    0,   41,  -20,    9,  -32,    0,    9,   85,    0,   17,
+       0,    0,   32,    0,    0,   59,  -39,   14,    0,  -40,   99,    0,  -59,    0,    0,  -45,
+  },
+  {
+      58,   -1,    0,  -80,  -69,  -21,   63,    0,    0,    0,  -73,    0,    0,   57,    0,   22,
+      58,    0,   65,    0,   53,   27,    0,  -64,   52,  -50,  -22,   41,    5,    0,    0,   49,
+      57,   30,  -49,    0,   28,  -31,    0,   44,  -95,    0,   56,   60,    0,    0,   31,    3,
+       0,  -47,  -64, -110,   46,  -97,    1,  -17,  -62,    0,   25,   34,   -7,   14,   54,  -38,
+     -58,  -67,    0,    7,  -51,   64,   -9,    0,    0,  -68,  -18,    0,  -64,  -35,   34,  -27,
+       0,    0,  -41,    0,    0,  -43,    0,   34,    0,   45,   55,    0,  -39,  -22,    0,  -48,
+      12,    0,   42,   20,  -32,    6,    0,  -40,   -8,    0,  -75,    0,    4,   76,    0,   69,
+       0,    0,   43,    0,    0,  -21,  -47,   20,    0,  -43,  -66,    0,  -53,    0,    0,  -31,
+  },
+  {
+      56,  -58,    0,  105,  -83,    6,  -45,    0,    0,    0,  -68,    0,    0,   59,    0,    3,
+      61,    0,   58,    0,   76,  -18,    0,  -76,   54,  -69,   44,  -33,  -34,    0,    0,   36,
+      26,  -27,  -66,    0,   27,   32,    0,   42,  -91,    0,   36,  -74,    0,    0,   21,  -43,
+       0,  -71,  -57,  -76,   58,  -82,   15,   35,  100,    0,   50,   67,  -34,  -32,   39,    0,
+     -40,    1,    0,   -1,  -46,   65,  -63,    0,    0,   19,    6,    0,  -81,   26,  -13,  -13,
+       0,    0,  -44,    0,    0,  -69,    0,  -31,    0,   37,  -42,    0,   33,   56,    0,  -70,
+      -5,    0,  -27,   15,  -16,  -10,    0,  -23,   10,   13,   22,    0,   -7,  -79,    0,   81,
+       0,    0,  -61,    0,    0,   50,  -66,    0,    0,   27, -102,    0,   35,    0,    0,  -24,
+  },
+  {
+      43,  -44,    0,  -32,  -56,  -28,   47,    0,    0,    0,  -52,    0,    0,   67,    0,  -90,
+      54,    0,   -8,    0,   68,   34,    0,   61,  -62,   36,   25,  -11,  -11,    0,    0,  -55,
+      50,  -34,   12,    0,   71,   13,    0,   65,   27,    0,   37,   30,    0,    0,    3,   23,
+       0,   52,   21,   -8,   36,   56,   16,  -36,   -8,    0,  -30,   78,  -53,   67,   65,    7,
+      79,   19,    0,  -21,  -47,   77,   42,    0,    0,  -59,  -16,    0,  -53,  -69,   30,  -16,
+       0,    0,  -47,    0,    0,  -21,    0,   -3,    0,  -49,   44,    0,   58,   14,    0,   84,
+      28,    0,  -15,   47,   28,  -25,    0,  -22,   73,  -22,  -30,    0,   -4,   61,    0,   41,
+       0,    0,   30,    0,    0,  -28,   39,   26,    0,   17,  -68,    0,   14,    0,    0,  -32,
+  },
+  {
+      51,  -43,    0,   68,  -71,   57,  -60,    0,    0,    0,  -14,    0,    0,   24,    0,    0,
+      24,    0,   88,    0,   78,   14,    0,  -48,   46,   37,   24,  -18,  -19,    0,    0,   15,
+     -21,  -15,   35,    0,    2,   18,    0,   24, -100,    0,   24,    5,    0,    0,   19,  -24,
+       0,  -90,  -48,   76,   82,   65,   20,  -24,   75,    0,   73,   53,  -57,  -29,   18,    0,
+     -18,  -79,    0,  -16,  -77,   33,  -68,    0,    0,   -8,   23,    0,  -49,  -13,   -3,   58,
+       0,    0,  -48,    0,    0,  -39,    0,   -1,    0,  -53,   -3,    0,    8,   11,    0,  -85,
+     -18,    0,  -50,   22,   22,   32,    0,  -19,   51,  -40,  -58,    0,  -13,  -60,    0,   31,
+       0,    0,   33,    0,    0,   13,  -65,    5,    0,   25, -113,    0,   75,    0,    0,   40,
+  },
+  {
+     -40,   71,    0,  -54,    7,  -25,   64,    0,    0,    0,  -51,    0,    0,  -20,    0,   40,
+      -5,    0,   40,    0,   23,   63,    0,  -34,   52,  -45,  -54,   68,    7,    0,    0,   25,
+     -29,   61,   43,    0,    4,  -42,    0,   -5,  -85,    0,   -5,   54,    0,    0,    3,  -20,
+       0,  -58,  -22,  -39,  -16,  -41,   -6,    0,  -72,    0,   30,  -44,   77,    1,  -14,  -50,
+     -33,  -81,    0,    9,   39,    7,   -3,    0,    0,  -11,   -8,    0,    1,   39,   85,  -13,
+       0,    0,   30,    0,    0,   18,    0,   20,    0,   -4,   10,    0,   -7,  -82,    0,  -67,
+       1,    0,   35,   17,   -4,   85,    0,   -3,   -2,    9,  -31,    0,   18,   34,    0,  -45,
+       0,    0,   65,    0,    0,   15,  -42,   11,    0,  -71,   62,    0,  -52,    0,    0,   -6,
+  },
+  {
+      15,   33,    0,  -99,  -44,    6,  -43,    0,    0,    0,   -4,    0,    0,   55,    0,    9,
+      25,    0,    1,    0,   16,    8,    0,  -13,  -47,  -74,   50,  -19,  -22,    0,    0,   10,
+      58,  -15,  -54,    0,   26,   19,    0,   11,   25,    0,   25,  -49,    0,    0,    9,  -16,
+       0,   15,  -37,  -98,   44,  -97,   -6,   27,  -53,    0,   -9,   59,    0,   28,   25,   23,
+     -19,   30,    0,   13,  -17,   53,   12,    0,    0,  -57,  -20,    0,  -52,    3,  -76,  -38,
+       0,    0,  -19,    0,    0,  -21,    0,   26,    0,   58,   48,    0,    2,   26,    0,  -69,
+      33,    0,   -5,   12,  -13,  -73,    0,   -9,  -17,    0,    5,    0,   -2,   59,    0,   51,
+       0,    0,  -49,    0,    0,   25,  -41,   33,    0,   19,  -56,    0,   11,    0,    0,   -5,
+  },
+  {
+     -55,  -21,    0, -110,   56,   56,  -60,    0,    0,    0,   13,    0,    0,  -20,    0, -105,
+       4,    0,    0,    0,   37,  -33,    0,   57,  -32,   49,   25,  -32,  -34,    0,    0,  -81,
+      15,  -31,  -34,    0,  -20,   27,    0,   37,   62,    0,    4,  -76,    0,    0,    6,  -22,
+       0,   32,  -66,  -21,  -13,  -22,  -20,   67,   48,    0,  -23,  -42,   51,    0,   16,   37,
+      78,   61,    0,   16,   36,  -84,   33,    0,    0,   -1,  -10,    0,   22,   64,  -43,  -33,
+       0,    0,   46,    0,    0,   37,    0,   -6,    0,   -8,   10,    0,   -1,   45,    0,   83,
+     -12,    0,  -33,   29,   23,  -77,    0,   -6,   65,   14,   28,    0,    0,  104,    0,   52,
+       0,    0,  -73,    0,    0,   54,    8,   16,    0,   25,   67,    0,   39,    0,    0,  -79,
+  },
+  {
+     -19,    7,    0,   59,   31,   57,  -36,    0,    0,    0,   72,    0,    0,  -25,    0,  -63,
+     -12,    0,   59,    0,   27,   -8,    0,  -32,   58,   86,   28,  -36,   -5,    0,    0,  -54,
+     -58,  -39,   41,    0,   -5,   23,    0,   42,  -69,    0,  -12,    0,    0,    0,   -4,  -49,
+       0,  -66,  -25,   83,  -63,   92,    0,  -13,   75,    0,   40,  -25,  -77,  -28,    2,   38,
+      65,  -15,    0,    4,   19,   -9,   78,    0,    0,   39,    2,    0,   27,   32,   41,   60,
+       0,    0,   19,    0,    0,   44,    0,  -30,    0,  -72,  -15,    0,  -10,   14,    0,   80,
+      -8,    0,  -33,   30,   37,   80,    0,    4,   68,  -40,  -49,    0,   -9,  -34,    0,  -79,
+       0,    0,   43,    0,    0,   42,    0,   -6,    0,   38,   65,    0,   49,    0,    0,   57,
+  },
+  {
+      43,   18,    0,  -42,  -41,   48,  -67,    0,    0,    0,  -50,    0,    0,   45,    0,   35,
+      10,    0,  -40,    0,  -19,   24,    0,  -11,  -74,   42,  -25,   33,  -43,    0,    0,   26,
+      62,   41,   54,    0,   35,  -33,    0,    2,   54,    0,   10,  -11,    0,    0,    6,    5,
+       0,   65,   -2,    7,   22,   65,   -6,   21,  -45,    0,  -14,   78,   65,   73,   21,  -40,
+     -45,  -28,    0,    0,  -39,   86,  -34,    0,    0,  -74,   -9,    0,  -11,  -10,  -12,   10,
+       0,    0,  -53,    0,    0,  -19,    0,   36,    0,  -43,   58,    0,  -21,  -11,    0,  -59,
+      63,    0,   51,    5,  -13,  -66,    0,   -6,  -41,  -24,  -56,    0,    4,   36,    0,  -62,
+       0,    0,  -14,    0,    0,   -7,   22,   19,    0,  -38,  -18,    0,  -62,    0,    0,   69,
+  },
+  {
+      52,  -68,    0,   78,  -48,   71,  -61,    0,    0,    0,  -66,    0,    0,   25,    0,   25,
+      28,    0,  -31,    0,   11,   74,    0,    0,   -5,   58,  -93,   65,  -39,    0,    0,   53,
+      65,   40,   72,    0,   23,  -72,    0,   18,   68,    0,   24,  -11,    0,    0,    0,   40,
+       0,   50,  -23,   57,   49,   69,   39,    7,  -39,    0,   -1,   27,   84,   50,   33,  -93,
+     -38,  -49,    0,  -35,  -66,  100,  -77,    0,    0,   -6,   11,    0,  -33,    0,   -2,   36,
+       0,    0,  -31,    0,    0,  -45,    0,   43,    0,  -52,   31,    0,   25,  -65,    0,  -63,
+      25,    0,   43,    5,   -9,  -53,    0,    0,  -42,  -47,  -49,    0,   21, -116,    0,  -60,
+       0,    0,  -44,    0,    0,    2,   34,  -15,    0,  -54,  -80,    0,  -64,    0,    0,   76,
+  },
+  {
+      51,   44,    0,  -62,  -92,  -69,   57,    0,    0,    0,  -24,    0,    0,   27,    0,    9,
+      44,    0,   55,    0,   89,  -12,    0,  -44,   69,  -49,   28,  -28,  -27,    0,    0,   13,
+      67,  -27,  -17,    0,   55,   17,    0,   16, -101,    0,   44,   11,    0,    0,   32,  -24,
+       0,  -58,  -30,  -88,   56,  -87,   11,  -19,  -22,    0,   30,   71,  -65,   22,   35,   37,
+     -21,  -33,    0,    6,  -46,   70,  -31,    0,    0,  -80,  -11,    0,  -49,  -11,  -14,  -48,
+       0,    0,  -34,    0,    0,  -30,    0,  -15,    0,   23,   38,    0,   -5,   26,    0,  -47,
+      67,    0,  -39,    3,   -5,   13,    0,  -33,   30,    0,  -11,    0,   -7,   95,    0,   45,
+       0,    0,   49,    0,    0,   29,  -19,   37,    0,   17,  -57,    0,   24,    0,    0,    4,
+  },
+  {
+      33,  -14,    0,   74,  -68,   43,  -38,    0,    0,    0,   20,    0,    0,   56,    0,   22,
+      25,    0,   52,    0,   35,   17,    0,  -62,   39,   33,   35,  -38,  -48,    0,    0,   55,
+      50,  -70,   15,    0,   24,   35,    0,   16,  -58,    0,   25,  -35,    0,    0,   16,  -53,
+       0,  -57,  -79,   23,   82,   49,   11,   -1,   56,    0,   51,   80,  -70,   49,   25,   15,
+     -53,  -19,    0,    1,  -41,   99,  -36,    0,    0,    1,    6,    0,  -53,   13,  -41,   22,
+       0,    0,  -36,    0,    0,  -73,    0,  -17,    0,  -60,   26,    0,   35,   25,    0,  -54,
+      49,    0,  -23,    0,  -23,  -24,    0,  -14,    8,  -48,  -62,    0,  -23,  -73,    0,  -65,
+       0,    0,  -14,    0,    0,   43,  -28,    4,    0,   19,  -94,    0,   40,    0,    0,   43,
+  },
+  {
+     -22,    3,    0,   -1,   58,   81,  -88,    0,    0,    0,   13,    0,    0,   -8,    0,  -11,
+     -18,    0,  -23,    0,  -12,  -12,    0,   41,  -51,  -48,    6,   -9,  -10,    0,    0,  -19,
+     -19,  -11,  -32,    0,   -8,   14,    0,  -28,   62,    0,  -18,  -77,    0,    0,  -14,  -69,
+       0,   15,  -51,  -21,  -16,  -57,  -50,   37,    8,    0,  -15,  -14,   78,  -18,   11,   12,
+      33,   41,    0,   47,    6,  -28,   34,    0,    0,   25,    0,    0,  -21,   31,  -83,   -1,
+       0,    0,    7,    0,    0,    3,    0,  -23,    0,   23,   -9,    0,   -3,   17,    0,   26,
+      -8,    0,    2,   19,   -5,    5,    0,   14,   -1,    7,   43,    0,   -1,  -10,    0,    9,
+       0,    0,  -54,    0,    0,   25,   13,   -4,    0,    7,   16,    0,    9,    0,    0,  -49,
+  },
+  {
+     -25,   62,    0,  -89,   77,    3,   29,    0,    0,    0,   21,    0,    0,   -9,    0,  -47,
+      27,    0,   70,    0,   -1,   67,    0,  -77,   62,   84,   -8,  -17,  -19,    0,    0,   -7,
+      17,  -36,   29,    0,   43,   13,    0,   44,  -94,    0,   26,   10,    0,    0,   40,  -23,
+       0,  -65,  -43,   81,  -45,   72,    8,  -22, -100,    0,   30,    2,  -54,   65,    7,   14,
+      14,  -32,    0,    8,   24,   28,   50,    0,    0,  -58,  -30,    0,   77,  -26,   35,   41,
+       0,    0,   56,    0,    0,  107,    0,   31,    0,  -53,   30,    0,  -36,   38,    0,   64,
+      38,    0,  -51,   14,   46,  -42,    0,  -35,   38,  -79,  -81,    0,   -1,   98,    0,  -60,
+       0,    0,   63,    0,    0,   16,    7,   58,    0,   12,   89,    0,   -8,    0,    0,   34,
+  },
+  {
+      48,  -45,    0,  102,  -63,   74,  -77,    0,    0,    0,    2,    0,    0,   44,    0,   54,
+     -61,    0,  -51,    0,    7,   -1,    0,   -2,  -76,   54,   42,  -22,  -27,    0,    0,   25,
+     -74,  -42,    4,    0,    0,   22,    0,  -29,   82,    0,  -60,  -64,    0,    0,  -46,  -70,
+       0,    9,   83,   33,   33,   74,  -15,   39,   81,    0,  -12,   31,    5,  -14,  -16,   29,
+     -25,   35,    0,   -3,  -46,   77,  -63,    0,    0,   -5,   13,    0,  -75,   65,  -37,   43,
+       0,    0,  -45,    0,    0,  -69,    0,  -41,    0,    5,  -42,    0,   29,  -37,    0,  -53,
+      -2,    0,    2,   23,  -15,   78,    0,   42,  -27,  -22,   18,    0,   -4,  -48,    0,   15,
+       0,    0,  -35,    0,    0,   21,   24,  -30,    0,   24,  -90,    0,   37,    0,    0,   61,
+  },
+  {
+      16,   81,    0,  -89,  -62,  -55,   52,    0,    0,    0,   50,    0,    0,   45,    0,   58,
+     -45,    0,  -28,    0,   -2,  -17,    0,  -13,  -29,  -47,   89,  -35,   26,    0,    0,   17,
+     -49,  -30,  -42,    0,   57,   34,    0,  -38,   45,    0,  -37,   30,    0,    0,  -54,  -75,
+       0,   -6,   62,  -96,  -16,  -66,  -68,  -33,  -43,    0,   -6,   47,  -72,   61,    7,   70,
+     -31,   -3,    0,   51,  -16,   36,    9,    0,    0,  -56,  -46,    0,  -54,   66,   -5,  -55,
+       0,    0,  -19,    0,    0,  -17,    0,   31,    0,   61,   71,    0,   -1,  -69,    0,  -52,
+      26,    0,  -23,   27,  -25,   51,    0,   49,  -16,    0,  -66,    0,  -11,   80,    0,   61,
+       0,    0,   48,    0,    0,  -34,  -47,   35,    0,   29,  -38,    0,   21,    0,    0,    5,
+  },
+  {
+     -26,   42,    0,   43,   10,  -36,   63,    0,    0,    0,  -44,    0,    0,  -34,    0,   30,
+     -34,    0,   31,    0,   -2,   33,    0,  -55,   72,  -26,  -60,   39,   60,    0,    0,   14,
+     -81,   27,   56,    0,  -22,  -45,    0,  -24,  -47,    0,  -65,   58,    0,    0,  -46,  -69,
+       0,  -73,   40,  -16,  -15,  -55,  -22,   -2,  -37,    0,   38,  -59,   42,  -47,  -47,  -50,
+     -56,  -64,    0,   34,   36,  -52,   -1,    0,    0,   16,    3,    0,   -4,   50,   34,    3,
+       0,    0,   28,    0,    0,    5,    0,   20,    0,    5,  -39,    0,    2,  -85,    0,  -20,
+     -24,    0,   58,   14,  -18,   59,    0,   47,   22,   19,  -26,    0,   28,  -38,    0,   24,
+       0,    0,   22,    0,    0,   44,  -52,  -23,    0,  -57,   48,    0,  -73,    0,    0,  -19,
+  },
+  {
+      72,  -23,    0,   45,  -46,   24,  -43,    0,    0,    0,  -36,    0,    0,   43,    0,   75,
+     -70,    0,  -82,    0,  -33,   73,    0,   46,  -60,   79,    2,   24,  -36,    0,    0,   20,
+     -89,   29,   52,    0,   39,  -26,    0,  -68,   77,    0,  -51,   -2,    0,    0,  -35,  -43,
+       0,   40,   86,   72,  -16,   66,    0,  -17,   81,    0,  -11,   31,   24,   -3,  -14,  -10,
+     -46,  -12,    0,  -22,  -62,   83,  -20,    0,    0,  -13,   30,    0,  -32,   60,   26,   65,
+       0,    0,  -74,    0,    0,  -50,    0,  -13,    0,  -87,   -7,    0,   29,  -45,    0,  -20,
+      29,    0,   57,   18,   -2,   61,    0,   48,  -10,  -71,  -14,    0,    1,  -50,    0,  -31,
+       0,    0,  -28,    0,    0,  -15,   43,  -25,    0,  -22,  -62,    0,   -4,    0,    0,   84,
+  },
+  {
+     -34,   63,    0,  -88,   57,   39,  -84,    0,    0,    0,  -55,    0,    0,  -22,    0,   11,
+       0,    0,  -14,    0,  -19,   15,    0,   22,   18,  -31,  -78,   72,  -24,    0,    0,    7,
+      49,   82,   17,    0,   10,  -57,    0,   19,   60,    0,    0,  -43,    0,    0,   16,   14,
+       0,   49,  -68,  -45,  -37,  -61,  -14,   58,  -91,    0,  -22,  -14,   57,   11,    1,  -45,
+     -22,   37,    0,    9,   32,  -24,   35,    0,    0,  -47,  -12,    0,   49,   51,  -32,  -21,
+       0,    0,   36,    0,    0,   50,    0,   76,    0,   63,   23,    0,  -16,  -39,    0,  -50,
+      16,    0,   60,    6,   -5,  -63,    0,  -18,  -32,    0,   23,    0,   18,   85,    0,   -6,
+       0,    0,  -81,    0,    0,   22,    7,   20,    0,  -79,   88,    0,  -64,    0,    0,  -21,
+  },
+  {
+     -11,   -8,    0,   46,   28,  -41,    3,    0,    0,    0,  -56,    0,    0,  -18,    0,  -64,
+     -67,    0,  -64,    0,  -40,   43,    0,   61,  -13,  -17,  -54,   47,   54,    0,    0,  -91,
+     -39,   60,   24,    0,  -26,  -70,    0,  -48,   87,    0,  -63,    0,    0,    0,  -46,  -16,
+       0,   59,   76,  -20,  -48,  -41,  -28,   31,  -38,    0,  -51,  -21,   62,  -22,  -33,  -40,
+      59,   34,    0,   14,   31,  -47,   74,    0,    0,   23,    9,    0,  -28,   87,  -42,  -27,
+       0,    0,   49,    0,    0,    8,    0,   65,    0,   54,  -23,    0,    1,  -83,    0,  109,
+     -26,    0,   40,   16,   10,   97,    0,   46,   50,   26,   46,    0,   13,  -37,    0,   68,
+       0,    0,  -28,    0,    0,  -22,   31,  -39,    0,  -65,    2,    0,  -83,    0,    0,  -49,
+  },
+  {
+      55,  -58,    0,   99,  -67,   38,  -54,    0,    0,    0,  -31,    0,    0,   46,    0,  -64,
+      17,    0,   -7,    0,   77,  -52,    0,   50,  -57,   -8,   39,  -19,  -23,    0,    0,  -71,
+      40,  -10,  -58,    0,  -33,   19,    0,   44,   55,    0,   17,  -55,    0,    0,    0,  -24,
+       0,   19,  -77,  -70,   55,  -73,   -8,   44,   43,    0,  -16,   24,   15,   11,   32,   13,
+      90,   61,    0,   -6,  -57,  -33,   50,    0,    0,   57,    0,    0, -111,    9,  -76,  -30,
+       0,    0,  -63,    0,    0,  -37,    0,   -6,    0,   69,   19,    0,   20,   27,    0,   79,
+     -29,    0,    8,   31,    6,  -81,    0,    0,   32,   26,   57,    0,   -2,  -59,    0,   69,
+       0,    0,  -76,    0,    0,   27,  -10,    0,    0,   23, -105,    0,   13,    0,    0,  -76,
+  },
+  {
+     -13,  -38,    0,   81,   60,   48,  -67,    0,    0,    0,  -70,    0,    0,  -35,    0,  -24,
+       0,    0,  -56,    0,  -22,   77,    0,   31,   19,   99,  -67,   52,  -30,    0,    0,   13,
+      36,   27,   70,    0,   28,  -52,    0,    0,   40,    0,    0,   48,    0,    0,    4,   75,
+       0,   68,   -8,   89,  -45,   94,   23,  -19,  -31,    0,    0,  -14,   75,    9,   17,  -60,
+     -26,  -88,    0,  -29,   15,   36,  -13,    0,    0,    2,   14,    0,   16,  -19,   54,   52,
+       0,    0,   18,    0,    0,   33,    0,   25,    0,  -78,   12,    0,   -2,  -51,    0,   86,
+      22,    0,   79,   41,   40,  -87,    0,   -8,   -3,  -40,  -70,    0,   30,  -64,    0,  -92,
+       0,    0,    5,    0,    0,  -15,   80,  -18,    0,  -38,   78,    0,  -86,    0,    0,   33,
+  },
+  {
+      63,   62,    0,  -59,  -57,  -31,   67,    0,    0,    0,   17,    0,    0,   51,    0,  -69,
+     -53,    0,  -68,    0,   16,   44,    0,   86,  -84,  -73,   64,  -22,   -3,    0,    0,  -41,
+     -83,  -34,  -19,    0,   56,   33,    0,  -75,   44,    0,  -62,   27,    0,    0,  -46,  -12,
+       0,   63,   57, -114,  -34, -115,  -40,  -19,  -44,    0,  -28,   66,  -60,   60,    3,   50,
+      75,   43,    0,    1,  -34,   40,   64,    0,    0,  -89,  -16,    0,  -49,   20,   18,  -38,
+       0,    0,  -26,    0,    0,  -20,    0,   10,    0,   28,   75,    0,   -4,  -44,    0,   64,
+      30,    0,  -25,   21,    7,   70,    0,   57,  -25,    0,  -41,    0,   -3,   83,    0,   80,
+       0,    0,   35,    0,    0,  -46,   14,   32,    0,   24,  -66,    0,    2,    0,    0,  -71,
+  },
+};
+
+const int32_t NEURAL_B1[MODEL_HIDDEN_SIZE] PROGMEM = {
+  7139, 9085, 9222, 8177, 6444, 5880, 3489, 6218,
+  7372, 8335, 7941, 8274, 4540, 7496, 6600, 7073,
+  8178, 7013, 7753, 4563, 6736, 4653, 7251, 6635,
+  7625, 7245, 6319, 5902, 8708, 9459, 9084, 7757,
+};
+
+alignas(16) const int8_t NEURAL_W2[NEURAL_NUM_LABELS][MODEL_HIDDEN_SIZE] PROGMEM = {
+  { // deadline
+      46,   86,  -86,  -93,   64,  -69,  -49,  -65,  -95, -109,  -71,   32,   91,  -50, -123,  -68,
+      87,   65,  100,  -39,   86,  -99,   94,   54,  -87,  -84,  107,  -83, -101, -102,  106,  -84,
+  },
+  { // documents
+      62, -101,   39,  -82,  -71,   72,  -39,  -84,   72,  -81,  -86,  -97,  -52,   34,  -99,  -58,
+      46,  -51,  -82,  -67,  -50,    9,  -85,   79,   98,   73,   95,  -78,   93,  -81,  -85,   75,
+  },
+  { // fee
+     102, -116,  -85,  -95,   69,  -83, -122,   52,   74,   87,  -76,   37, -115,   19,   40,   31,
+     -49,   70,  -53,  114,  -16,  -48,   99,  -80,  101,  -61,  -61,   79,  -72,  -77,  -72,   75,
+  },
+  { // financial_aid
+    -100,  -57,  -84,   89,  -99,  -59,   12,  -60,   58,   60,  -81,  -64,  -69,   99,  -83,  -80,
+     -58,   71,   99,  -80,  -77,  -41,  -30,  -53,  -66,   87,   30,   91,   96,  -68,  103,  -74,
+  },
+  { // process
+     -99,   35,  -96,  -98,  -98,  -78,   58,   80,  -76,   62,  101,   77,   97,  -60,   26,  -99,
+     -54,   54,   83,   96,  122,  -75, -127,   86,   48,  -81,   65, -114,  -71,   66,  -81,   50,
+  },
+  { // programs
+    -104,  -11,   69,   51,  -16,   79,  -55,  -50,   67,   83,   70,  -87,  124,   81,  -69,  -67,
+      90,  -87,  -63,  103,   91,  -75,   84,  -72,   -8,   76,  -97,  -88,  -98,  -73, -101,  -97,
+  },
+  { // requirements
+      36,  -57,  -85,   64,   91,   62,   57,   69,  -60,  -87,   46, -102,  -30,  -87,   30,   91,
+     -26,    4,   37,  -54,   36,  100,  -81,   62,  -65,  -74,  -18,   64,   -9,   80,  -47,  -82,
+  },
+  { // schedule
+     -98,   64,   86,  -63,  -43,  -91,  -45,   54,  -93,  -71,  -72,   84,  -10,  -95,  -86,  106,
+     100,  -92,  -75,  -17,  -86,    4,   50,  -82,  -79,  -36,  -73,  -59,   85,   81,   21,   73,
+  },
+};
+
+const int32_t NEURAL_B2[NEURAL_NUM_LABELS] PROGMEM = {
+  1203, 646, -3600, 3252, -5331, 355, -7747, 9257,
+};
+
+const Intent NEURAL_LABEL_INTENTS[NEURAL_NUM_LABELS] = {
+  Intent::Deadline,
+  Intent::Documents,
+  Intent::Fee,
+  Intent::FinancialAid,
+  Intent::Process,
+  Intent::Programs,
+  Intent::Requirements,
+  Intent::Schedule,
+};
+
+const NeuralQuantParams NEURAL_QUANT PROGMEM = {
+  2036558087, 38, -128,
+  2001365266, 41, -29,
+  0.0555898212f,
+};
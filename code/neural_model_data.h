@@ -0,0 +1,30 @@
+// neural_model_data.h - GENERATED by ml_model/training/train_int8_model.py; do not edit.
+#ifndef NEURAL_MODEL_DATA_H
+#define NEURAL_MODEL_DATA_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "intents.h"
+
+#define NEURAL_NUM_LABELS 8
+
+// Layer 1: MODEL_INPUT_SIZE -> MODEL_HIDDEN_SIZE, ReLU
+extern const int8_t NEURAL_W1[MODEL_HIDDEN_SIZE][MODEL_INPUT_SIZE];
+extern const int32_t NEURAL_B1[MODEL_HIDDEN_SIZE];
+// Layer 2: MODEL_HIDDEN_SIZE -> NEURAL_NUM_LABELS logits
+extern const int8_t NEURAL_W2[NEURAL_NUM_LABELS][MODEL_HIDDEN_SIZE];
+extern const int32_t NEURAL_B2[NEURAL_NUM_LABELS];
+extern const Intent NEURAL_LABEL_INTENTS[NEURAL_NUM_LABELS];
+
+struct NeuralQuantParams {
+  int32_t hiddenMultiplier;  // layer 1 accumulator -> hidden: (acc * M + 2^(S-1)) >> S
+  uint8_t hiddenShift;
+  int8_t hiddenZero;
+  int32_t outputMultiplier;  // layer 2 accumulator -> logits
+  uint8_t outputShift;
+  int8_t outputZero;
+  float outputScale;         // logit = (q - outputZero) * outputScale
+};
+extern const NeuralQuantParams NEURAL_QUANT;
+
+#endif // NEURAL_MODEL_DATA_H
@@ -0,0 +1,23 @@
+// scheduler.cpp - Cooperative scheduler implementation
+#include "scheduler.h"
+
+bool Scheduler::add(TaskFn fn, uint16_t periodMs) {
+	if (!fn || m_count >= SCHEDULER_MAX_TASKS) return false;
+	m_tasks[m_count++] = Task{fn, periodMs, millis()};
+	return true;
+}
+
+void Scheduler::run() {
+	unsigned long start = micros();
+	for (uint8_t i = 0; i < m_count; ++i) {
+		Task &t = m_tasks[i];
+		if (t.periodMs) {
+			unsigned long now = millis();
+			if (now - t.lastRun < t.periodMs) continue; // wrap-safe
+			t.lastRun = now;
+		}
+		t.fn();
+	}
+	unsigned long pass = micros() - start;
+	if (pass > m_maxPassUs) m_maxPassUs = pass;
+}
@@ -0,0 +1,41 @@
+// scheduler.h - millis()-based cooperative task scheduler
+//
+// Tasks are plain functions that must return quickly (no delay()); each runs
+// whenever its period has elapsed, period 0 meaning every pass. loop() just
+// calls run(), so a pass costs only the tasks that are actually due.
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 8
+#endif
+
+class Scheduler {
+ public:
+  typedef void (*TaskFn)();
+
+  // Returns false when the task table is full.
+  bool add(TaskFn fn, uint16_t periodMs = 0);
+  // One pass over the task table.
+  void run();
+
+  // Longest pass seen so far: the worst-case delay before any task (e.g. the
+  // button poll) gets to run again.
+  unsigned long maxPassMicros() const { return m_maxPassUs; }
+  void resetStats() { m_maxPassUs = 0; }
+
+ private:
+  struct Task {
+    TaskFn fn;
+    uint16_t periodMs;
+    unsigned long lastRun;
+  };
+
+  Task m_tasks[SCHEDULER_MAX_TASKS];
+  uint8_t m_count = 0;
+  unsigned long m_maxPassUs = 0;
+};
+
+#endif // SCHEDULER_H
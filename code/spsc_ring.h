@@ -0,0 +1,98 @@
+// spsc_ring.h - Lock-free single-producer / single-consumer ring buffer
+//
+// One context (an ISR or a task) pushes, one other context pops; neither ever
+// blocks or disables interrupts. Capacity N must be a power of two. Head and
+// tail are free-running counters, so all N slots are usable.
+//
+// On AVR the indices are single bytes (naturally atomic) with a compiler
+// barrier around the slot access; elsewhere std::atomic with acquire/release
+// ordering publishes the slot contents across cores.
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVR__)
+#define SPSC_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#include <atomic>
+#endif
+
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+#if defined(__AVR__)
+  static_assert(N <= 128, "SpscRing on AVR uses 8-bit indices");
+  typedef uint8_t index_t;
+#else
+  typedef uint32_t index_t;
+#endif
+
+ public:
+  static constexpr size_t capacity() { return N; }
+
+  // Producer side. Returns false (and drops `item`) when the ring is full.
+  bool push(const T &item) {
+    index_t head = loadHead(false);
+    if ((index_t)(head - loadTail(true)) >= N) return false;
+    m_slots[head & (N - 1)] = item;
+    storeHead((index_t)(head + 1));
+    return true;
+  }
+
+  // Consumer side. Returns false when the ring is empty.
+  bool pop(T &item) {
+    index_t tail = loadTail(false);
+    if (tail == loadHead(true)) return false;
+    item = m_slots[tail & (N - 1)];
+    storeTail((index_t)(tail + 1));
+    return true;
+  }
+
+  // Consumer side: the oldest item, or nullptr, read in place. The slot stays
+  // owned by the consumer until consume() releases it to the producer.
+  T *peek() {
+    index_t tail = loadTail(false);
+    if (tail == loadHead(true)) return nullptr;
+    return &m_slots[tail & (N - 1)];
+  }
+  void consume() { storeTail((index_t)(loadTail(false) + 1)); }
+
+  // Producer side: the slot the next push() would fill, or nullptr when full.
+  // Fill it in place and publish it with commit(); avoids copying large items.
+  T *reserve() {
+    index_t head = loadHead(false);
+    if ((index_t)(head - loadTail(true)) >= N) return nullptr;
+    return &m_slots[head & (N - 1)];
+  }
+  void commit() { storeHead((index_t)(loadHead(false) + 1)); }
+
+  // Approximate when called while the other side is active.
+  size_t size() const { return (index_t)(loadHead(true) - loadTail(true)); }
+  bool empty() const { return size() == 0; }
+
+ private:
+#if defined(__AVR__)
+  index_t loadHead(bool) const { index_t v = m_head; SPSC_BARRIER(); return v; }
+  index_t loadTail(bool) const { index_t v = m_tail; SPSC_BARRIER(); return v; }
+  void storeHead(index_t v) { SPSC_BARRIER(); m_head = v; }
+  void storeTail(index_t v) { SPSC_BARRIER(); m_tail = v; }
+
+  volatile index_t m_head = 0;
+  volatile index_t m_tail = 0;
+#else
+  // `other` = reading the index owned by the opposite side (needs acquire).
+  index_t loadHead(bool other) const { return m_head.load(other ? std::memory_order_acquire : std::memory_order_relaxed); }
+  index_t loadTail(bool other) const { return m_tail.load(other ? std::memory_order_acquire : std::memory_order_relaxed); }
+  void storeHead(index_t v) { m_head.store(v, std::memory_order_release); }
+  void storeTail(index_t v) { m_tail.store(v, std::memory_order_release); }
+
+  // Separate cache lines so producer and consumer cores do not false-share.
+  alignas(64) std::atomic<index_t> m_head{0};
+  alignas(64) std::atomic<index_t> m_tail{0};
+#endif
+  T m_slots[N];
+};
+
+#endif // SPSC_RING_H
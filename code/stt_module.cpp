@@ -2,20 +2,55 @@
 #include "stt_module.h"
 #include "config.h"
 
+// Line being assembled across loop passes; no heap, no Stream timeout.
+static char g_line[STT_LINE_MAX + 1];
+static size_t g_lineLen = 0;
+static bool g_lineReady = false;
+static unsigned long g_lastByte = 0;
+
 void STTModule::begin() {
+	g_lineLen = 0;
+	g_lineReady = false;
 	if (DEBUG_MODE) {
 		Serial.println(F("[STT] Module ready (simulated)"));
 	}
 }
 
 bool STTModule::available() {
-	return Serial.available() > 0;
+	while (!g_lineReady && Serial.available() > 0) {
+		int c = Serial.read();
+		if (c < 0) break;
+		g_lastByte = millis();
+		if (c == '\n' || c == '\r') {
+			// Blank lines and the second half of CRLF end nothing.
+			g_lineReady = g_lineLen > 0;
+		} else if (g_lineLen < STT_LINE_MAX) {
+			g_line[g_lineLen++] = (char)c;
+		}
+	}
+	if (!g_lineReady && g_lineLen > 0 && millis() - g_lastByte >= STT_LINE_IDLE_MS) {
+		g_lineReady = true;
+	}
+	return g_lineReady;
 }
 
-String STTModule::readUtterance() {
-	if (!Serial.available()) return "";
-	String line = Serial.readString();
-	line.trim();
-	return line;
+size_t STTModule::readUtterance(char *buf, size_t size) {
+	if (size == 0) return 0;
+	buf[0] = '\0';
+	if (!g_lineReady && !available()) return 0;
+	size_t start = 0, end = g_lineLen;
+	while (start < end && isspace((unsigned char)g_line[start])) ++start;
+	while (end > start && isspace((unsigned char)g_line[end - 1])) --end;
+	size_t len = end - start < size - 1 ? end - start : size - 1;
+	memcpy(buf, g_line + start, len);
+	buf[len] = '\0';
+	g_lineLen = 0;
+	g_lineReady = false;
+	return len;
 }
 
+String STTModule::readUtterance() {
+	char line[STT_LINE_MAX + 1];
+	readUtterance(line, sizeof(line));
+	return String(line);
+}
@@ -4,11 +4,28 @@
 
 #include <Arduino.h>
 
+// Longest utterance kept; the rest of a longer line is dropped.
+#ifndef STT_LINE_MAX
+#define STT_LINE_MAX 128
+#endif
+// A line with no terminator (serial monitors set to "No line ending") ends
+// after this long without another byte.
+#ifndef STT_LINE_IDLE_MS
+#define STT_LINE_IDLE_MS 250
+#endif
+
 class STTModule {
  public:
   void begin();
-  // For now we simulate by reading Serial input
+  // For now we simulate by reading Serial input. available() takes whatever
+  // bytes have arrived, never waiting for more, and is true once a whole line
+  // is assembled; call it on every loop pass.
   bool available();
+  // Copy the assembled line, trimmed and NUL-terminated, into `buf` (at most
+  // size - 1 bytes; STT_LINE_MAX + 1 always fits) and return its length; 0 if
+  // none is ready. No heap allocation.
+  size_t readUtterance(char *buf, size_t size);
+  // The same as a String; "" if none is ready.
   String readUtterance();
 };
 
@@ -2,7 +2,11 @@
 #include "tts_module.h"
 #include "config.h"
 
+static const unsigned long PULSE_MS = 40;
+
 static int g_speakerPin = -1;
+static bool g_pulseActive = false;
+static unsigned long g_pulseStart = 0;
 
 void TTSModule::begin(int speakerPin) {
 	g_speakerPin = speakerPin;
@@ -12,14 +16,35 @@ void TTSModule::begin(int speakerPin) {
 	}
 }
 
-void TTSModule::speak(const String &text) {
-	// In a real system convert text -> phonemes -> audio synthesis or send to external module
-	Serial.println("\n🔊 Response: " + text);
-	// Simple activity pulse
+// Simple activity pulse; update() ends it so speak() never blocks.
+static void activityPulse() {
 	if (g_speakerPin >= 0) {
 		digitalWrite(g_speakerPin, HIGH);
-		delay(40);
+		g_pulseActive = true;
+		g_pulseStart = millis();
+	}
+}
+
+void TTSModule::speak(const String &text) {
+	// In a real system convert text -> phonemes -> audio synthesis or send to external module
+	Serial.print(F("\n🔊 Response: "));
+	Serial.println(text);
+	activityPulse();
+}
+
+void TTSModule::speak(const __FlashStringHelper *text) {
+	Serial.print(F("\n🔊 Response: "));
+	Serial.println(text);
+	activityPulse();
+}
+
+void TTSModule::update() {
+	if (g_pulseActive && millis() - g_pulseStart >= PULSE_MS) {
 		digitalWrite(g_speakerPin, LOW);
+		g_pulseActive = false;
 	}
 }
 
+bool TTSModule::busy() const {
+	return g_pulseActive;
+}
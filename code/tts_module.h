@@ -8,6 +8,11 @@ class TTSModule {
  public:
   void begin(int speakerPin);
   void speak(const String &text);
+  // Flash-resident text (FAQ answers) is streamed, never copied to RAM.
+  void speak(const __FlashStringHelper *text);
+  // Finishes the speaker activity pulse; call from a scheduler task.
+  void update();
+  bool busy() const;
 };
 
 #endif // TTS_MODULE_H
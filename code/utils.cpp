@@ -14,3 +14,26 @@ void blinkLED(uint8_t ledPin, uint8_t times, uint16_t onMs, uint16_t offMs) {
 	}
 }
 
+void LedBlinker::start(uint8_t ledPin, uint8_t times, uint16_t onMs, uint16_t offMs) {
+	m_pin = ledPin;
+	m_onMs = onMs;
+	m_offMs = offMs;
+	m_remaining = times > 127 ? 254 : times * 2;
+	m_phaseStart = millis();
+	if (m_remaining) digitalWrite(m_pin, LOW);
+}
+
+void LedBlinker::update() {
+	if (!m_remaining) return;
+	unsigned long now = millis();
+	bool on = (m_remaining & 1) == 0; // even count: in the LOW (on) phase
+	if (now - m_phaseStart < (on ? m_onMs : m_offMs)) return;
+	m_phaseStart = now;
+	--m_remaining;
+	if (m_remaining) digitalWrite(m_pin, (m_remaining & 1) ? HIGH : LOW);
+	else digitalWrite(m_pin, HIGH);
+}
+
+void LedBlinker::stop() {
+	m_remaining = 0;
+}
@@ -7,4 +7,21 @@
 String toLowerCopy(const String &s);
 void blinkLED(uint8_t ledPin, uint8_t times, uint16_t onMs = 150, uint16_t offMs = 150);
 
+// Non-blocking version of blinkLED: start() then call update() from a task.
+// The LED is active low like blinkLED and is left HIGH when done.
+class LedBlinker {
+ public:
+  void start(uint8_t ledPin, uint8_t times, uint16_t onMs = 150, uint16_t offMs = 150);
+  void update();
+  void stop();
+  bool active() const { return m_remaining > 0; }
+
+ private:
+  uint8_t m_pin = 0;
+  uint8_t m_remaining = 0; // phases left: two per blink
+  uint16_t m_onMs = 0;
+  uint16_t m_offMs = 0;
+  unsigned long m_phaseStart = 0;
+};
+
 #endif // UTILS_H
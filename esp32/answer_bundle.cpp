@@ -0,0 +1,119 @@
+#include "answer_bundle.h"
+
+#define ANSWER_BUNDLE_MAGIC   0x42535454UL   // "TTSB"
+#define ANSWER_BUNDLE_VERSION 1
+
+#ifdef ARDUINO_ARCH_ESP32
+
+// Written by tools/gen_answer_audio.py; both targets are little-endian.
+struct AnswerBundleHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t codec;
+  uint16_t count;
+  uint32_t sampleRate;
+  uint32_t bytes;     // whole image
+};
+static_assert(sizeof(AnswerBundleHeader) == 16, "header layout is shared with tools/gen_answer_audio.py");
+
+bool AnswerBundle::begin(const char *label) {
+  end();
+  const esp_partition_t *part =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ANSWER_BUNDLE_SUBTYPE, label);
+  AnswerBundleHeader hdr;
+  if (!part || esp_partition_read(part, 0, &hdr, sizeof(hdr)) != ESP_OK) return false;
+  if (hdr.magic != ANSWER_BUNDLE_MAGIC || hdr.version != ANSWER_BUNDLE_VERSION ||
+      hdr.sampleRate != AUDIO_SAMPLE_RATE || hdr.codec > (uint8_t)AudioCodec::ImaAdpcm || hdr.bytes > part->size ||
+      sizeof(hdr) + (uint32_t)hdr.count * sizeof(Entry) > hdr.bytes) {
+    return false;
+  }
+  // Map only what the image uses, not the whole partition.
+  const void *image;
+  if (esp_partition_mmap(part, 0, hdr.bytes, ESP_PARTITION_MMAP_DATA, &image, &m_map) != ESP_OK) return false;
+  m_image = static_cast<const uint8_t *>(image);
+  m_bytes = hdr.bytes;
+  m_index = reinterpret_cast<const Entry *>(m_image + sizeof(hdr));
+  m_codec = (AudioCodec)hdr.codec;
+  // One pass at boot so playback never reads past the image.
+  for (uint16_t i = 0; i < hdr.count; ++i) {
+    const Entry &e = m_index[i];
+    bool sorted = i == 0 || m_index[i - 1].key < e.key;
+    uint32_t full = e.samples / AUDIO_FRAME_SAMPLES, tail = e.samples % AUDIO_FRAME_SAMPLES;
+    uint64_t size = (uint64_t)full * audioEncodedSize(m_codec, AUDIO_FRAME_SAMPLES) +
+                    (tail ? audioEncodedSize(m_codec, tail) : 0);
+    if (!sorted || e.offset < sizeof(hdr) || e.offset + size > m_bytes) {
+      end();
+      return false;
+    }
+  }
+  m_count = hdr.count;
+  return true;
+}
+
+void AnswerBundle::end() {
+  close();
+  if (m_image) esp_partition_munmap(m_map);
+  m_image = nullptr;
+  m_bytes = 0;
+  m_index = nullptr;
+  m_count = 0;
+}
+
+const AnswerBundle::Entry *AnswerBundle::find(uint64_t key) const {
+  uint16_t lo = 0, hi = m_count;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if (m_index[mid].key < key) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo < m_count && m_index[lo].key == key ? &m_index[lo] : nullptr;
+}
+
+bool AnswerBundle::contains(uint64_t key) const {
+  return find(key) != nullptr;
+}
+
+bool AnswerBundle::open(uint64_t key) {
+  close();
+  const Entry *e = find(key);
+  if (!e) {
+    ++m_misses;
+    return false;
+  }
+  m_read = m_image + e->offset;
+  m_readLeft = e->samples;
+  ++m_hits;
+  return true;
+}
+
+size_t AnswerBundle::readFrame(AudioBuffer &out) {
+  out.count = 0;
+  if (!m_read || !m_readLeft) return 0;
+  size_t n = min((uint32_t)AUDIO_FRAME_SAMPLES, m_readLeft);
+  // Decoded from the flash cache into the caller's buffer.
+  audioDecode(m_codec, m_read, n, out.samples);
+  m_read += audioEncodedSize(m_codec, n);
+  m_readLeft -= n;
+  out.count = n;
+  return n;
+}
+
+void AnswerBundle::close() {
+  m_read = nullptr;
+  m_readLeft = 0;
+}
+
+AnswerBundleStats AnswerBundle::stats() const {
+  return AnswerBundleStats{m_count, m_bytes, m_hits, m_misses};
+}
+
+#else
+// Non-ESP32 placeholder implementations
+bool AnswerBundle::begin(const char *) { return false; }
+void AnswerBundle::end() {}
+bool AnswerBundle::contains(uint64_t) const { return false; }
+bool AnswerBundle::open(uint64_t) { return false; }
+size_t AnswerBundle::readFrame(AudioBuffer &out) { out.count = 0; return 0; }
+void AnswerBundle::close() {}
+AnswerBundleStats AnswerBundle::stats() const { return AnswerBundleStats{0, 0, 0, 0}; }
+#endif
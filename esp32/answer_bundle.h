@@ -0,0 +1,71 @@
+#ifndef ESP32_ANSWER_BUNDLE_H
+#define ESP32_ANSWER_BUNDLE_H
+
+#include <Arduino.h>
+#include "audio_codec.h"
+#include "audio_io.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_partition.h>
+#endif
+
+// Data partition holding the image built by tools/gen_answer_audio.py
+// (esp32/partitions.csv).
+#ifndef ANSWER_BUNDLE_PARTITION
+#define ANSWER_BUNDLE_PARTITION "answers"
+#endif
+#define ANSWER_BUNDLE_SUBTYPE 0x40
+
+struct AnswerBundleStats {
+  uint32_t entries;   // answers in the image
+  uint32_t bytes;     // image size, mapped into the data address space
+  uint32_t hits;      // open() found the answer
+  uint32_t misses;    // not pre-rendered (dynamic text, or the image is older)
+};
+
+// Pre-rendered FAQ answers, memory-mapped from flash. The image is a header,
+// an index sorted by TTSCache::key() of each answer, and the answers' frames
+// in the storage codec. begin() maps it once and checks the index; after that
+// a lookup is a binary search over the index and playback decodes straight
+// from the mapped flash, with no file system, no copies and no writes.
+// Not thread-safe: one reader at a time (TTSClient's task).
+class AnswerBundle {
+public:
+  bool begin(const char *label = ANSWER_BUNDLE_PARTITION);
+  void end();
+
+  bool contains(uint64_t key) const;
+
+  // Playback: readFrame() decodes the next frame into out (count 0 at the end).
+  bool open(uint64_t key);
+  size_t readFrame(AudioBuffer &out);
+  void close();
+
+  AnswerBundleStats stats() const;
+
+private:
+#ifdef ARDUINO_ARCH_ESP32
+  struct Entry {
+    uint64_t key;
+    uint32_t offset;   // from the start of the image
+    uint32_t samples;
+  };
+
+  const Entry *find(uint64_t key) const;
+
+  const uint8_t *m_image = nullptr;
+  uint32_t m_bytes = 0;
+  esp_partition_mmap_handle_t m_map = 0;
+  const Entry *m_index = nullptr;
+  uint16_t m_count = 0;
+  AudioCodec m_codec = AudioCodec::ImaAdpcm;
+
+  const uint8_t *m_read = nullptr;
+  uint32_t m_readLeft = 0;   // samples
+
+  uint32_t m_hits = 0;
+  uint32_t m_misses = 0;
+#endif
+};
+
+#endif // ESP32_ANSWER_BUNDLE_H
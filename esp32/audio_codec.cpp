@@ -0,0 +1,173 @@
+#include "audio_codec.h"
+
+static const int16_t IMA_STEP[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+  253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+  3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+  11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+  32767,
+};
+static const int8_t IMA_INDEX_ADJUST[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+const char *audioCodecName(AudioCodec codec) {
+  switch (codec) {
+    case AudioCodec::MuLaw: return "mulaw";
+    case AudioCodec::ImaAdpcm: return "ima_adpcm";
+    default: return "pcm_s16le";
+  }
+}
+
+size_t audioEncodedSize(AudioCodec codec, size_t samples) {
+  switch (codec) {
+    case AudioCodec::MuLaw: return samples;
+    case AudioCodec::ImaAdpcm: return IMA_ADPCM_HEADER_BYTES + (samples + 1) / 2;
+    default: return samples * sizeof(int16_t);
+  }
+}
+
+// G.711 mu-law. The segment is the position of the top bit of the biased
+// magnitude, found with one count-leading-zeros (NSAU on Xtensa).
+static inline uint8_t muLawEncode(int16_t pcm) {
+  int32_t s = pcm;
+  uint8_t sign = 0;
+  if (s < 0) {
+    s = -s;
+    sign = 0x80;
+  }
+  if (s > 32635) s = 32635;
+  s += 0x84;
+  uint8_t exponent = (uint8_t)(31 - __builtin_clz((uint32_t)s) - 7);
+  uint8_t mantissa = (uint8_t)((s >> (exponent + 3)) & 0x0f);
+  return (uint8_t)~(sign | (exponent << 4) | mantissa);
+}
+
+size_t AudioEncoder::encode(const AudioBuffer &in, uint8_t *out) {
+  const size_t n = in.count;
+  switch (m_codec) {
+    case AudioCodec::MuLaw:
+      for (size_t i = 0; i < n; ++i) out[i] = muLawEncode(in.samples[i]);
+      return n;
+
+    case AudioCodec::ImaAdpcm: {
+      int32_t predictor = m_predictor;
+      int32_t index = m_index;
+      out[0] = (uint8_t)predictor;
+      out[1] = (uint8_t)(predictor >> 8);
+      out[2] = (uint8_t)index;
+      out[3] = 0;
+      uint8_t *p = out + IMA_ADPCM_HEADER_BYTES;
+      for (size_t i = 0; i < n; ++i) {
+        int32_t step = IMA_STEP[index];
+        int32_t diff = in.samples[i] - predictor;
+        uint8_t nibble = 0;
+        if (diff < 0) {
+          nibble = 8;
+          diff = -diff;
+        }
+        int32_t delta = step >> 3;
+        if (diff >= step) { nibble |= 4; diff -= step; delta += step; }
+        step >>= 1;
+        if (diff >= step) { nibble |= 2; diff -= step; delta += step; }
+        step >>= 1;
+        if (diff >= step) { nibble |= 1; delta += step; }
+        predictor += (nibble & 8) ? -delta : delta;
+        if (predictor > 32767) predictor = 32767;
+        else if (predictor < -32768) predictor = -32768;
+        index += IMA_INDEX_ADJUST[nibble & 7];
+        if (index < 0) index = 0;
+        else if (index > 88) index = 88;
+        // Low nibble first, as in WAV IMA-ADPCM.
+        if (i & 1) *p++ |= (uint8_t)(nibble << 4);
+        else *p = nibble;
+      }
+      m_predictor = predictor;
+      m_index = (uint8_t)index;
+      return IMA_ADPCM_HEADER_BYTES + (n + 1) / 2;
+    }
+
+    default:
+      memcpy(out, in.samples, n * sizeof(int16_t)); // both targets are little-endian
+      return n * sizeof(int16_t);
+  }
+}
+
+static inline int16_t muLawDecode(uint8_t code) {
+  uint8_t u = (uint8_t)~code;
+  int32_t s = ((((int32_t)u & 0x0f) << 3) + 0x84) << ((u >> 4) & 7);
+  return (int16_t)((u & 0x80) ? 0x84 - s : s - 0x84);
+}
+
+void audioDecode(AudioCodec codec, const uint8_t *in, size_t samples, int16_t *out) {
+  switch (codec) {
+    case AudioCodec::MuLaw:
+      for (size_t i = 0; i < samples; ++i) out[i] = muLawDecode(in[i]);
+      return;
+
+    case AudioCodec::ImaAdpcm: {
+      int32_t predictor = (int16_t)(in[0] | (in[1] << 8));
+      int32_t index = in[2] > 88 ? 88 : in[2];
+      const uint8_t *p = in + IMA_ADPCM_HEADER_BYTES;
+      for (size_t i = 0; i < samples; ++i) {
+        uint8_t nibble = (i & 1) ? (*p++ >> 4) : (*p & 0x0f);
+        int32_t step = IMA_STEP[index];
+        int32_t delta = step >> 3;
+        if (nibble & 4) delta += step;
+        if (nibble & 2) delta += step >> 1;
+        if (nibble & 1) delta += step >> 2;
+        predictor += (nibble & 8) ? -delta : delta;
+        if (predictor > 32767) predictor = 32767;
+        else if (predictor < -32768) predictor = -32768;
+        index += IMA_INDEX_ADJUST[nibble & 7];
+        if (index < 0) index = 0;
+        else if (index > 88) index = 88;
+        out[i] = (int16_t)predictor;
+      }
+      return;
+    }
+
+    default:
+      memcpy(out, in, samples * sizeof(int16_t));
+      return;
+  }
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+void printAudioCodecBenchmark(Print &out, uint16_t frames) {
+  // Two tones plus noise: keeps ADPCM's step size moving like speech does.
+  static AudioBuffer frame;
+  frame.count = AUDIO_FRAME_SAMPLES;
+  uint32_t noise = 12345;
+  for (size_t i = 0; i < AUDIO_FRAME_SAMPLES; ++i) {
+    noise = noise * 1103515245u + 12345u;
+    float t = (float)i / AUDIO_SAMPLE_RATE;
+    frame.samples[i] = (int16_t)(6000.0f * sinf(2 * (float)M_PI * 220.0f * t) +
+                                 2500.0f * sinf(2 * (float)M_PI * 1750.0f * t) +
+                                 (float)((int32_t)(noise >> 16) % 800));
+  }
+  static uint8_t encoded[AUDIO_ENCODED_MAX_BYTES];
+  static const AudioCodec CODECS[] = {AudioCodec::Pcm16, AudioCodec::MuLaw, AudioCodec::ImaAdpcm};
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  for (AudioCodec codec : CODECS) {
+    AudioEncoder enc(codec);
+    uint64_t total = 0;
+    uint32_t best = UINT32_MAX;
+    for (uint16_t f = 0; f < frames; ++f) {
+      uint32_t t0 = ESP.getCycleCount();
+      enc.encode(frame, encoded);
+      uint32_t cycles = ESP.getCycleCount() - t0;
+      total += cycles;
+      if (cycles < best) best = cycles;
+    }
+    uint32_t avg = (uint32_t)(total / (frames ? frames : 1));
+    size_t bytes = audioEncodedSize(codec, AUDIO_FRAME_SAMPLES);
+    out.printf("[CODEC] %-9s %4u B/frame %6.1f kbit/s  %7u cycles/frame (min %u, %.2f/sample, %.1f us @ %u MHz)\n",
+               audioCodecName(codec), (unsigned)bytes,
+               bytes * 8.0 * AUDIO_SAMPLE_RATE / AUDIO_FRAME_SAMPLES / 1000.0,
+               avg, best, (double)avg / AUDIO_FRAME_SAMPLES, (double)avg / mhz, mhz);
+  }
+}
+#else
+void printAudioCodecBenchmark(Print &, uint16_t) {}
+#endif
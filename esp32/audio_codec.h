@@ -0,0 +1,53 @@
+#ifndef ESP32_AUDIO_CODEC_H
+#define ESP32_AUDIO_CODEC_H
+
+#include <Arduino.h>
+#include "audio_io.h"
+
+// STT uplink and TTS cache encodings. Raw 16 kHz PCM is 256 kbit/s; G.711 mu-law halves
+// that, IMA-ADPCM quarters it.
+enum class AudioCodec : uint8_t { Pcm16, MuLaw, ImaAdpcm };
+
+// Codec the STT transports start with; setCodec() overrides it.
+#ifndef STT_AUDIO_CODEC
+#define STT_AUDIO_CODEC AudioCodec::Pcm16
+#endif
+
+// Each IMA-ADPCM frame starts with the encoder state before its first sample
+// (predictor, int16 LE; step index; 0), so every frame decodes on its own.
+#define IMA_ADPCM_HEADER_BYTES 4
+// Largest encoded frame (PCM).
+#define AUDIO_ENCODED_MAX_BYTES (AUDIO_FRAME_SAMPLES * sizeof(int16_t))
+
+// Name sent in X-Audio-Format ("pcm_s16le", "mulaw", "ima_adpcm").
+const char *audioCodecName(AudioCodec codec);
+// Encoded bytes for one frame of `samples` samples.
+size_t audioEncodedSize(AudioCodec codec, size_t samples);
+
+class AudioEncoder {
+public:
+  explicit AudioEncoder(AudioCodec codec = STT_AUDIO_CODEC) : m_codec(codec) {}
+
+  void setCodec(AudioCodec codec) { m_codec = codec; reset(); }
+  AudioCodec codec() const { return m_codec; }
+  // Forget ADPCM history; call at the start of each utterance.
+  void reset() { m_predictor = 0; m_index = 0; }
+
+  // Encode one frame into out (AUDIO_ENCODED_MAX_BYTES); returns bytes written.
+  size_t encode(const AudioBuffer &in, uint8_t *out);
+
+private:
+  AudioCodec m_codec;
+  int32_t m_predictor = 0;
+  uint8_t m_index = 0;
+};
+
+// Decode one frame of `samples` samples written by AudioEncoder::encode()
+// (audioEncodedSize(codec, samples) bytes) into out.
+void audioDecode(AudioCodec codec, const uint8_t *in, size_t samples, int16_t *out);
+
+// Encode a synthetic speech-band frame repeatedly with every codec and print
+// CPU cycles per frame (ESP.getCycleCount()). Call from setup() on the device.
+void printAudioCodecBenchmark(Print &out, uint16_t frames = 200);
+
+#endif // ESP32_AUDIO_CODEC_H
@@ -55,6 +55,8 @@ bool AudioIO::begin(bool enableOutput) {
   if (g_outputEnabled) {
     i2s_config_t i2s_config_tx = i2s_config_rx;
     i2s_config_tx.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
+    // On an underrun play silence, not the last DMA buffer over and over.
+    i2s_config_tx.tx_desc_auto_clear = true;
     i2s_pin_config_t pin_config_tx = {
       .bck_io_num = I2S_SPK_SCK,
       .ws_io_num = I2S_SPK_WS,
@@ -81,20 +83,17 @@ void AudioIO::playSamples(const int16_t *data, size_t count) {
   i2s_write(I2S_NUM_1, (const void*)data, count * sizeof(int16_t), &written, portMAX_DELAY);
 }
 
-float AudioIO::rms(const AudioBuffer &buf) const {
-  if (buf.count == 0) return 0.f;
-  double acc = 0.0;
-  for (size_t i = 0; i < buf.count; ++i) {
-    double s = buf.samples[i];
-    acc += s * s;
-  }
-  return sqrt(acc / (double)buf.count) / 32768.0; // normalized
-}
-
 #else
 // Non-ESP32 placeholder implementations
 bool AudioIO::begin(bool) { return false; }
 size_t AudioIO::readSamples(AudioBuffer &, uint32_t) { return 0; }
 void AudioIO::playSamples(const int16_t *, size_t) {}
-float AudioIO::rms(const AudioBuffer &) const { return 0.f; }
 #endif
+
+float AudioIO::rms(const AudioBuffer &buf) const {
+  return computeFrameStats(buf.samples, buf.count).rms;
+}
+
+FrameStats AudioIO::stats(const AudioBuffer &buf) const {
+  return computeFrameStats(buf.samples, buf.count);
+}
@@ -2,6 +2,7 @@
 #define ESP32_AUDIO_IO_H
 
 #include <Arduino.h>
+#include "frame_stats.h"
 
 // Configure I2S sample format
 #define AUDIO_SAMPLE_RATE   16000
@@ -19,7 +20,8 @@ public:
   bool begin(bool enableOutput = true);
   size_t readSamples(AudioBuffer &buf, uint32_t timeoutMs = 20);
   void playSamples(const int16_t *data, size_t count);
-  float rms(const AudioBuffer &buf) const;
+  float rms(const AudioBuffer &buf) const;          // normalized 0..1
+  FrameStats stats(const AudioBuffer &buf) const;  // rms, peak, ZCR, DC in one pass
 };
 
 #endif // ESP32_AUDIO_IO_H
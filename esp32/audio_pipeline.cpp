@@ -0,0 +1,183 @@
+#include "audio_pipeline.h"
+#include "stt_client.h"
+#include "stt_ws_client.h"
+#include "vad.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#define CAPTURE_TASK_PRIORITY 5
+#define UPLOAD_TASK_PRIORITY  3
+#define CAPTURE_TASK_STACK    3072
+#define UPLOAD_TASK_STACK     8192
+
+static bool uploadToStt(const AudioBuffer &frame, void *ctx) {
+  return static_cast<STTClient *>(ctx)->pushAudio(frame);
+}
+
+bool AudioPipeline::begin(AudioIO &io, STTClient &stt) {
+  return begin(io, uploadToStt, &stt);
+}
+
+static bool uploadToSttWebSocket(const AudioBuffer &frame, void *ctx) {
+  return static_cast<STTWebSocketClient *>(ctx)->pushAudio(frame);
+}
+
+bool AudioPipeline::begin(AudioIO &io, STTWebSocketClient &stt) {
+  return begin(io, uploadToSttWebSocket, &stt);
+}
+
+bool AudioPipeline::begin(AudioIO &io, UploadFn upload, void *ctx) {
+  if (m_running || !upload) return false;
+  m_io = &io;
+  m_upload = upload;
+  m_ctx = ctx;
+  m_running = true;
+  m_tasksAlive = 2;
+  if (xTaskCreatePinnedToCore(uploadTask, "audio_up", UPLOAD_TASK_STACK, this,
+                              UPLOAD_TASK_PRIORITY, &m_uploadTask, AUDIO_UPLOAD_CORE) != pdPASS) {
+    m_running = false;
+    m_tasksAlive = 0;
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(captureTask, "audio_cap", CAPTURE_TASK_STACK, this,
+                              CAPTURE_TASK_PRIORITY, nullptr, AUDIO_CAPTURE_CORE) != pdPASS) {
+    m_tasksAlive = 1;
+    end();
+    return false;
+  }
+  return true;
+}
+
+void AudioPipeline::end() {
+  m_streaming = false;
+  m_running = false;
+  if (m_uploadTask) xTaskNotifyGive(m_uploadTask);
+  while (m_tasksAlive > 0) vTaskDelay(1);
+  m_uploadTask = nullptr;
+}
+
+void AudioPipeline::setVad(VoiceActivityDetector *vad) {
+  m_vad = vad;
+}
+
+void AudioPipeline::start() {
+  if (m_vad) m_vad->reset();
+  m_ended = false;
+  m_heardSpeech = false;
+  m_streaming = true;
+}
+
+void AudioPipeline::stop() {
+  m_streaming = false;
+  // Let the frame being read finish and reach the ring, then drain it.
+  while (m_running && (m_capturing || !m_ring.empty())) {
+    if (m_uploadTask) xTaskNotifyGive(m_uploadTask);
+    vTaskDelay(1);
+  }
+}
+
+bool AudioPipeline::streaming() const {
+  return m_streaming;
+}
+
+bool AudioPipeline::utteranceEnded() const {
+  return m_ended;
+}
+
+bool AudioPipeline::heardSpeech() const {
+  return m_heardSpeech;
+}
+
+AudioPipelineStats AudioPipeline::stats() const {
+  return AudioPipelineStats{m_framesCaptured, m_framesUploaded, m_ringOverruns, m_uploadErrors, m_maxFill,
+                            m_framesSilent};
+}
+
+void AudioPipeline::resetStats() {
+  m_framesCaptured = 0;
+  m_framesUploaded = 0;
+  m_ringOverruns = 0;
+  m_uploadErrors = 0;
+  m_maxFill = 0;
+  m_framesSilent = 0;
+}
+
+// Run the VAD on a streamed frame; true if it should be uploaded.
+bool AudioPipeline::gate(const AudioBuffer &frame) {
+  if (!m_vad) return true;
+  VadEvent ev = m_vad->update(m_io->rms(frame));
+  if (ev == VadEvent::SpeechStart) m_heardSpeech = true;
+  if (ev == VadEvent::SpeechEnd || ev == VadEvent::NoSpeech) {
+    m_streaming = false;
+    m_ended = true;
+  }
+  return m_vad->voiced();
+}
+
+void AudioPipeline::captureTask(void *arg) {
+  AudioPipeline *self = static_cast<AudioPipeline *>(arg);
+  while (self->m_running) {
+    // Always keep reading so the I2S DMA ring never overflows.
+    // Announce the read before sampling m_streaming (both seq_cst): stop()
+    // clears m_streaming and then checks m_capturing, so either it sees this
+    // frame in flight and waits for it, or this frame sees the stop and is
+    // discarded. Never both missed.
+    self->m_capturing = true;
+    bool streaming = self->m_streaming;
+    AudioBuffer *slot = streaming ? self->m_ring.reserve() : nullptr;
+    if (streaming && !slot) {
+      self->m_ringOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!slot) self->m_capturing = false;
+    AudioBuffer &dst = slot ? *slot : self->m_discard;
+    if (self->m_io->readSamples(dst, 100) > 0 && streaming) {
+      if (!self->gate(dst)) {
+        self->m_framesSilent.fetch_add(1, std::memory_order_relaxed);
+      } else if (slot) {
+        self->m_ring.commit();
+        self->m_framesCaptured.fetch_add(1, std::memory_order_relaxed);
+        uint32_t fill = self->m_ring.size();
+        if (fill > self->m_maxFill) self->m_maxFill = fill;
+        xTaskNotifyGive(self->m_uploadTask);
+      }
+    }
+    self->m_capturing = false;
+  }
+  --self->m_tasksAlive;
+  vTaskDelete(nullptr);
+}
+
+void AudioPipeline::uploadTask(void *arg) {
+  AudioPipeline *self = static_cast<AudioPipeline *>(arg);
+  while (self->m_running) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+    // Upload in place, then release the slot, so the ring only empties once
+    // the last frame has actually gone out.
+    while (AudioBuffer *frame = self->m_ring.peek()) {
+      if (self->m_upload(*frame, self->m_ctx)) {
+        self->m_framesUploaded.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        self->m_uploadErrors.fetch_add(1, std::memory_order_relaxed);
+      }
+      self->m_ring.consume();
+    }
+  }
+  --self->m_tasksAlive;
+  vTaskDelete(nullptr);
+}
+
+#else
+// Non-ESP32 placeholder implementations
+bool AudioPipeline::begin(AudioIO &, UploadFn, void *) { return false; }
+bool AudioPipeline::begin(AudioIO &, STTClient &) { return false; }
+bool AudioPipeline::begin(AudioIO &, STTWebSocketClient &) { return false; }
+void AudioPipeline::end() {}
+void AudioPipeline::start() {}
+void AudioPipeline::stop() {}
+bool AudioPipeline::streaming() const { return false; }
+bool AudioPipeline::utteranceEnded() const { return false; }
+bool AudioPipeline::heardSpeech() const { return false; }
+void AudioPipeline::setVad(VoiceActivityDetector *) {}
+AudioPipelineStats AudioPipeline::stats() const { return AudioPipelineStats{0, 0, 0, 0, 0, 0}; }
+void AudioPipeline::resetStats() {}
+#endif
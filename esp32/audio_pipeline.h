@@ -0,0 +1,103 @@
+#ifndef ESP32_AUDIO_PIPELINE_H
+#define ESP32_AUDIO_PIPELINE_H
+
+#include <Arduino.h>
+#include "audio_io.h"
+#include "spsc_ring.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <atomic>
+#include <freertos/task.h>
+#endif
+
+class STTClient;
+class STTWebSocketClient;
+class VoiceActivityDetector;
+
+// Frames buffered between capture and upload: 16 x 32 ms = 512 ms of audio,
+// the longest upload stall (WiFi retry, TCP backoff) ridden out without loss.
+#ifndef AUDIO_RING_FRAMES
+#define AUDIO_RING_FRAMES 16
+#endif
+// Capture shares core 1 with the Arduino loop; WiFi and lwIP live on core 0,
+// so the uploader runs there.
+#ifndef AUDIO_CAPTURE_CORE
+#define AUDIO_CAPTURE_CORE 1
+#endif
+#ifndef AUDIO_UPLOAD_CORE
+#define AUDIO_UPLOAD_CORE 0
+#endif
+
+struct AudioPipelineStats {
+  uint32_t framesCaptured;  // frames read from I2S and queued while streaming
+  uint32_t framesUploaded;  // frames handed to the upload function
+  uint32_t ringOverruns;    // frames dropped because the ring was full
+  uint32_t uploadErrors;    // upload function returned false
+  uint32_t maxFill;         // ring high-water mark, in frames
+  uint32_t framesSilent;    // frames the VAD classified as silence (not uploaded)
+};
+
+// Decouples I2S capture from network upload. A capture task (high priority)
+// reads the microphone continuously into an SPSC ring of AudioBuffer frames,
+// so the DMA ring never overflows while an HTTP request is in flight; an
+// uploader task on the other core drains the ring into the upload function.
+class AudioPipeline {
+public:
+  typedef bool (*UploadFn)(const AudioBuffer &frame, void *ctx);
+
+  bool begin(AudioIO &io, UploadFn upload, void *ctx);
+  bool begin(AudioIO &io, STTClient &stt);   // uploads with STTClient::pushAudio
+  bool begin(AudioIO &io, STTWebSocketClient &stt);
+  void end();                                 // stop both tasks
+
+  // Gate capture with a VAD (nullptr: upload every frame). The capture task
+  // runs it on each streamed frame: silent frames are never queued, and once
+  // the utterance ends (or no speech came) streaming stops by itself.
+  // Set it before start().
+  void setVad(VoiceActivityDetector *vad);
+
+  // Frames are queued for upload only between start() and stop(); otherwise
+  // capture keeps the I2S DMA drained and discards audio.
+  void start();
+  // Stop queueing and wait until every queued frame has been uploaded.
+  void stop();
+
+  bool streaming() const;
+  // The VAD ended the utterance started by start(); call stop() to flush it.
+  // heardSpeech() tells a finished utterance from a no-speech timeout.
+  bool utteranceEnded() const;
+  bool heardSpeech() const;
+  AudioPipelineStats stats() const;
+  void resetStats();
+
+private:
+#ifdef ARDUINO_ARCH_ESP32
+  static void captureTask(void *self);
+  static void uploadTask(void *self);
+  bool gate(const AudioBuffer &frame);
+
+  AudioIO *m_io = nullptr;
+  VoiceActivityDetector *m_vad = nullptr;
+  UploadFn m_upload = nullptr;
+  void *m_ctx = nullptr;
+  TaskHandle_t m_uploadTask = nullptr;
+  std::atomic<bool> m_running{false};
+  std::atomic<bool> m_streaming{false};
+  std::atomic<bool> m_capturing{false};    // a streamed frame is being read
+  std::atomic<bool> m_ended{false};        // set by capture when the VAD ends the utterance
+  std::atomic<bool> m_heardSpeech{false};
+  std::atomic<uint8_t> m_tasksAlive{0};
+  SpscRing<AudioBuffer, AUDIO_RING_FRAMES> m_ring;
+  AudioBuffer m_discard;   // capture target while idle or when the ring is full
+
+  // Each counter has a single writer (capture or uploader task).
+  std::atomic<uint32_t> m_framesCaptured{0};
+  std::atomic<uint32_t> m_framesUploaded{0};
+  std::atomic<uint32_t> m_ringOverruns{0};
+  std::atomic<uint32_t> m_uploadErrors{0};
+  std::atomic<uint32_t> m_maxFill{0};
+  std::atomic<uint32_t> m_framesSilent{0};
+#endif
+};
+
+#endif // ESP32_AUDIO_PIPELINE_H
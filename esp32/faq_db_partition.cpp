@@ -0,0 +1,37 @@
+#include "faq_db_partition.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+// Offset of the image size in the header (see code/faq_db.cpp).
+#define FAQ_DB_HEADER_BYTES 32
+#define FAQ_DB_SIZE_OFFSET  24
+
+bool FaqDbPartition::begin(const char *label) {
+  end();
+  const esp_partition_t *part =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FAQ_DB_SUBTYPE, label);
+  uint32_t bytes;
+  if (!part || esp_partition_read(part, FAQ_DB_SIZE_OFFSET, &bytes, sizeof(bytes)) != ESP_OK) return false;
+  if (bytes < FAQ_DB_HEADER_BYTES || bytes > part->size) return false;
+  // Map only what the image uses, not the whole partition.
+  const void *image;
+  if (esp_partition_mmap(part, 0, bytes, ESP_PARTITION_MMAP_DATA, &image, &m_map) != ESP_OK) return false;
+  m_mapped = true;
+  if (!m_db.attach(image, bytes)) {
+    end();
+    return false;
+  }
+  return true;
+}
+
+void FaqDbPartition::end() {
+  m_db.detach();
+  if (m_mapped) esp_partition_munmap(m_map);
+  m_mapped = false;
+}
+
+#else
+// Non-ESP32 placeholder implementations
+bool FaqDbPartition::begin(const char *) { return false; }
+void FaqDbPartition::end() { m_db.detach(); }
+#endif
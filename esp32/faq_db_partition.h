@@ -0,0 +1,41 @@
+#ifndef ESP32_FAQ_DB_PARTITION_H
+#define ESP32_FAQ_DB_PARTITION_H
+
+#include <Arduino.h>
+#include "faq_db.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_partition.h>
+#endif
+
+// Data partition holding the image built by tools/gen_faq_db.py
+// (esp32/partitions.csv).
+#ifndef FAQ_DB_PARTITION
+#define FAQ_DB_PARTITION "faqdb"
+#endif
+#define FAQ_DB_SUBTYPE 0x41
+
+// Maps the binary FAQ image from flash and attaches a FaqDb to it. begin()
+// reads the 32-byte header to learn the image size, maps that much into the
+// data address space with esp_partition_mmap() and checks the header: the
+// cost does not grow with the number of FAQs, and answers are then read
+// through the flash cache in place. Typical use:
+//
+//   static FaqDbPartition faqs;
+//   if (faqs.begin()) faqSetDatabase(&faqs.db());
+class FaqDbPartition {
+public:
+  bool begin(const char *label = FAQ_DB_PARTITION);
+  void end();   // faqSetDatabase(nullptr) first if it was installed
+
+  const FaqDb &db() const { return m_db; }
+
+private:
+  FaqDb m_db;
+#ifdef ARDUINO_ARCH_ESP32
+  esp_partition_mmap_handle_t m_map = 0;
+  bool m_mapped = false;
+#endif
+};
+
+#endif // ESP32_FAQ_DB_PARTITION_H
@@ -0,0 +1,176 @@
+#include "frame_stats.h"
+
+#include <math.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FRAME_STATS_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define FRAME_STATS_SSE2 1
+#elif defined(__XTENSA__)
+#include <xtensa/config/core-isa.h>
+#if XCHAL_HAVE_MAC16
+#define FRAME_STATS_MAC16 1
+#endif
+#endif
+
+namespace {
+
+struct Acc {
+  uint64_t sq = 0;
+  int32_t sum = 0;
+  int32_t max = -32768;
+  int32_t min = 32767;
+  uint32_t zc = 0;
+};
+
+// Samples [i, n); s[i - 1] exists (crossings are counted against it).
+inline void scalarStats(const int16_t *s, size_t i, size_t n, Acc &a) {
+  for (; i < n; ++i) {
+    int32_t v = s[i];
+    a.sum += v;
+    a.sq += (uint32_t)(v * v);
+    if (v > a.max) a.max = v;
+    if (v < a.min) a.min = v;
+    a.zc += (uint32_t)((v ^ s[i - 1]) < 0);
+  }
+}
+
+#if FRAME_STATS_AVX2 || FRAME_STATS_SSE2
+#if FRAME_STATS_AVX2
+typedef __m256i Vec;
+#define V_LANES 16
+#define V_LOADU(p) _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))
+#define V_SET1_16 _mm256_set1_epi16
+#define V_ZERO _mm256_setzero_si256
+#define V_MADD _mm256_madd_epi16
+#define V_ADD32 _mm256_add_epi32
+#define V_SUB32 _mm256_sub_epi32
+#define V_ADD64 _mm256_add_epi64
+#define V_UNPACKLO32 _mm256_unpacklo_epi32
+#define V_UNPACKHI32 _mm256_unpackhi_epi32
+#define V_MAX16 _mm256_max_epi16
+#define V_MIN16 _mm256_min_epi16
+#define V_XOR _mm256_xor_si256
+#define V_SRAI16 _mm256_srai_epi16
+#define V_STORE(p, v) _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v)
+#else
+typedef __m128i Vec;
+#define V_LANES 8
+#define V_LOADU(p) _mm_loadu_si128(reinterpret_cast<const __m128i *>(p))
+#define V_SET1_16 _mm_set1_epi16
+#define V_ZERO _mm_setzero_si128
+#define V_MADD _mm_madd_epi16
+#define V_ADD32 _mm_add_epi32
+#define V_SUB32 _mm_sub_epi32
+#define V_ADD64 _mm_add_epi64
+#define V_UNPACKLO32 _mm_unpacklo_epi32
+#define V_UNPACKHI32 _mm_unpackhi_epi32
+#define V_MAX16 _mm_max_epi16
+#define V_MIN16 _mm_min_epi16
+#define V_XOR _mm_xor_si128
+#define V_SRAI16 _mm_srai_epi16
+#define V_STORE(p, v) _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v)
+#endif
+
+// Returns the first sample not processed.
+size_t simdStats(const int16_t *s, size_t i, size_t n, Acc &a) {
+  const Vec ones = V_SET1_16(1);
+  const Vec zero = V_ZERO();
+  Vec sum = zero, sq = zero, zc = zero;
+  Vec hi = V_SET1_16(-32768), lo = V_SET1_16(32767);
+  for (; i + V_LANES <= n; i += V_LANES) {
+    Vec cur = V_LOADU(s + i);
+    Vec prev = V_LOADU(s + i - 1);
+    sum = V_ADD32(sum, V_MADD(cur, ones));
+    // Pairwise a*a + b*b <= 2^31: exact as unsigned 32-bit, widened to 64.
+    Vec pairs = V_MADD(cur, cur);
+    sq = V_ADD64(sq, V_UNPACKLO32(pairs, zero));
+    sq = V_ADD64(sq, V_UNPACKHI32(pairs, zero));
+    hi = V_MAX16(hi, cur);
+    lo = V_MIN16(lo, cur);
+    // -1 per lane whose sign differs from the previous sample.
+    zc = V_SUB32(zc, V_MADD(V_SRAI16(V_XOR(cur, prev), 15), ones));
+  }
+  int32_t sums[V_LANES / 2], crossings[V_LANES / 2];
+  uint64_t squares[V_LANES / 4];
+  int16_t highs[V_LANES], lows[V_LANES];
+  V_STORE(sums, sum);
+  V_STORE(crossings, zc);
+  V_STORE(squares, sq);
+  V_STORE(highs, hi);
+  V_STORE(lows, lo);
+  for (int k = 0; k < V_LANES / 2; ++k) {
+    a.sum += sums[k];
+    a.zc += (uint32_t)crossings[k];
+  }
+  for (int k = 0; k < V_LANES / 4; ++k) a.sq += squares[k];
+  for (int k = 0; k < V_LANES; ++k) {
+    if (highs[k] > a.max) a.max = highs[k];
+    if (lows[k] < a.min) a.min = lows[k];
+  }
+  return i;
+}
+#endif
+
+#if FRAME_STATS_MAC16
+// Squares go through the MAC16 unit: MULA.AA.LL / .HH add both 16-bit halves
+// of a word, squared, to the 40-bit accumulator in one cycle each. Blocks of
+// 256 samples (<= 2^38) cannot overflow it. The rest stays in integer ALU ops.
+size_t mac16Stats(const int16_t *s, size_t i, size_t n, Acc &a) {
+  if ((reinterpret_cast<uintptr_t>(s + i) & 2) && i < n) {
+    scalarStats(s, i, i + 1, a);
+    ++i;
+  }
+  while (i + 2 <= n) {
+    size_t end = i + min((size_t)256, (n - i) & ~(size_t)1);
+    uint32_t accLo, accHi;
+    __asm__ volatile("wsr.acclo %0\n\twsr.acchi %0" : : "r"(0));
+    int32_t prev = s[i - 1];
+    for (; i < end; i += 2) {
+      uint32_t w = *reinterpret_cast<const uint32_t *>(s + i);
+      __asm__ volatile("mula.aa.ll %0, %0\n\tmula.aa.hh %0, %0" : : "r"(w));
+      int32_t v0 = (int16_t)w, v1 = (int32_t)w >> 16;
+      a.sum += v0 + v1;
+      a.max = max(a.max, max(v0, v1));
+      a.min = min(a.min, min(v0, v1));
+      a.zc += (uint32_t)((v0 ^ prev) < 0) + (uint32_t)((v1 ^ v0) < 0);
+      prev = v1;
+    }
+    __asm__ volatile("rsr.acclo %0\n\trsr.acchi %1" : "=r"(accLo), "=r"(accHi));
+    a.sq += ((uint64_t)(accHi & 0xff) << 32) | accLo;
+  }
+  return i;
+}
+#endif
+
+} // namespace
+
+FrameStats computeFrameStats(const int16_t *samples, size_t count) {
+  FrameStats st = {};
+  if (count == 0) return st;
+  Acc a;
+  int32_t first = samples[0];
+  a.sum = first;
+  a.sq = (uint32_t)(first * first);
+  a.max = a.min = first;
+  size_t i = 1;
+#if FRAME_STATS_AVX2 || FRAME_STATS_SSE2
+  i = simdStats(samples, i, count, a);
+#elif FRAME_STATS_MAC16
+  i = mac16Stats(samples, i, count, a);
+#endif
+  scalarStats(samples, i, count, a);
+
+  st.sumSquares = a.sq;
+  st.sum = a.sum;
+  st.count = (uint16_t)count;
+  st.peak = (uint16_t)max(a.max, -a.min);
+  st.zeroCrossings = (uint16_t)a.zc;
+  // Round to nearest; count is positive.
+  st.dc = (int16_t)(a.sum >= 0 ? (a.sum + (int32_t)count / 2) / (int32_t)count
+                                : -((-a.sum + (int32_t)count / 2) / (int32_t)count));
+  st.rms = sqrtf((float)a.sq / (float)count) / 32768.f;
+  return st;
+}
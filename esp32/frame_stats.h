@@ -0,0 +1,25 @@
+#ifndef ESP32_FRAME_STATS_H
+#define ESP32_FRAME_STATS_H
+
+#include <Arduino.h>
+
+// Per-frame level statistics for VAD and AGC, from one integer pass over the
+// samples: no floating point until the final square root.
+struct FrameStats {
+  uint64_t sumSquares;    // sum of sample^2
+  int32_t sum;            // sum of samples
+  uint16_t count;         // samples
+  uint16_t peak;          // max |sample|, 0..32768
+  uint16_t zeroCrossings; // sign changes between consecutive samples
+  int16_t dc;             // mean sample value (DC offset)
+  float rms;              // sqrt(sumSquares / count) / 32768, as AudioIO::rms
+
+  // Zero crossings per sample interval, 0..1.
+  float zcr() const { return count > 1 ? (float)zeroCrossings / (float)(count - 1) : 0.f; }
+};
+
+// count <= 65535. Uses AVX2 or SSE2 on the host, the MAC16 multiply-
+// accumulate unit on Xtensa ESP32 / ESP32-S3, and plain integers elsewhere.
+FrameStats computeFrameStats(const int16_t *samples, size_t count);
+
+#endif // ESP32_FRAME_STATS_H
@@ -0,0 +1,159 @@
+#include "playback_pipeline.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#define PLAY_TASK_PRIORITY 5
+#define PLAY_TASK_STACK    3072
+
+static_assert(PLAYBACK_PREFILL_FRAMES >= 1 && PLAYBACK_PREFILL_FRAMES <= PLAYBACK_RING_FRAMES,
+              "prefill must fit in the playback ring");
+
+bool PlaybackPipeline::begin(AudioIO &io) {
+  if (m_running) return false;
+  m_io = &io;
+  m_running = true;
+  m_taskAlive = true;
+  if (xTaskCreatePinnedToCore(playTask, "tts_play", PLAY_TASK_STACK, this,
+                              PLAY_TASK_PRIORITY, &m_playTask, PLAYBACK_CORE) != pdPASS) {
+    m_running = false;
+    m_taskAlive = false;
+    return false;
+  }
+  return true;
+}
+
+void PlaybackPipeline::end() {
+  m_running = false;
+  if (m_playTask) xTaskNotifyGive(m_playTask);
+  while (m_taskAlive) vTaskDelay(1);
+  m_playTask = nullptr;
+  // The consumer is gone; release whatever it left queued.
+  while (m_ring.peek()) m_ring.consume();
+}
+
+bool PlaybackPipeline::running() const {
+  return m_running;
+}
+
+void PlaybackPipeline::start(uint8_t prefillFrames) {
+  m_finished = false;
+  m_prefill = prefillFrames < 1 ? 1 : min(prefillFrames, (uint8_t)PLAYBACK_RING_FRAMES);
+  m_maxFill = 0;
+  m_producerWaits = 0;
+  m_startUs = micros();
+  // Published before the stream's first submit(); the player resets the rest.
+  m_generation.fetch_add(1);
+}
+
+AudioBuffer *PlaybackPipeline::acquire(uint32_t timeoutMs) {
+  if (!m_running) return nullptr;
+  // Register before looking, so a slot freed in between still wakes us.
+  m_producer = xTaskGetCurrentTaskHandle();
+  AudioBuffer *slot = m_ring.reserve();
+  if (slot) return slot;
+  m_producerWaits.fetch_add(1, std::memory_order_relaxed);
+  uint32_t t0 = millis();
+  while (!(slot = m_ring.reserve()) && m_running) {
+    uint32_t waited = millis() - t0;
+    if (waited >= timeoutMs) break;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs - waited));
+  }
+  return slot;
+}
+
+void PlaybackPipeline::submit() {
+  m_ring.commit();
+  uint32_t fill = m_ring.size();
+  if (fill > m_maxFill) m_maxFill = fill;
+  xTaskNotifyGive(m_playTask);
+}
+
+void PlaybackPipeline::finish() {
+  m_finished = true;
+  if (m_playTask) xTaskNotifyGive(m_playTask);
+}
+
+bool PlaybackPipeline::wait(uint32_t timeoutMs) {
+  uint32_t t0 = millis();
+  while (m_running && !m_ring.empty()) {
+    if (millis() - t0 >= timeoutMs) return false;
+    xTaskNotifyGive(m_playTask);
+    vTaskDelay(1);
+  }
+  if (!m_ring.empty()) return false;
+  // The last frame is in the DMA ring; let it reach the speaker.
+  int32_t left = (int32_t)(m_queuedUntil - micros());
+  if (left > 0) delay((uint32_t)left / 1000 + 1);
+  return true;
+}
+
+PlaybackStats PlaybackPipeline::stats() const {
+  // Until the player has seen the latest start(), its counters are stale.
+  if (m_seenGeneration != m_generation) return PlaybackStats{0, 0, 0, m_maxFill, m_producerWaits, 0};
+  return PlaybackStats{m_framesPlayed, m_underruns, m_underrunMs, m_maxFill, m_producerWaits, m_firstAudioMs};
+}
+
+void PlaybackPipeline::drain() {
+  for (;;) {
+    AudioBuffer *frame = m_ring.peek();
+    // Read after peek(): a frame of a new stream implies its start() is visible.
+    uint32_t generation = m_generation;
+    if (generation != m_seenGeneration) {
+      m_framesPlayed = 0;
+      m_underruns = 0;
+      m_underrunMs = 0;
+      m_firstAudioMs = 0;
+      m_seenGeneration = generation;
+    }
+    if (!m_playing) {
+      if (!frame || (m_ring.size() < m_prefill && !m_finished)) return;
+      m_playing = true;
+    }
+    uint32_t now = micros();
+    int32_t late = (int32_t)(now - m_queuedUntil);
+    if (!frame) {
+      // The DMA ring keeps the speaker going for a while. Once it has run dry
+      // as well, prefill again rather than stutter frame by frame.
+      if (m_finished || late > 0) m_playing = false;
+      return;
+    }
+    bool first = m_framesPlayed == 0;
+    if (first) {
+      m_firstAudioMs = (now - m_startUs) / 1000;
+    } else if (late > 0) {
+      m_underruns.fetch_add(1, std::memory_order_relaxed);
+      m_underrunMs.fetch_add(((uint32_t)late + 500) / 1000, std::memory_order_relaxed);
+    }
+    // Straight from the ring slot the network read landed in; the slot goes
+    // back to the producer once I2S has taken the samples.
+    m_io->playSamples(frame->samples, frame->count);
+    uint32_t from = first || late > 0 ? now : (uint32_t)m_queuedUntil;
+    m_queuedUntil = from + (uint32_t)((uint64_t)frame->count * 1000000ULL / AUDIO_SAMPLE_RATE);
+    m_ring.consume();
+    m_framesPlayed.fetch_add(1, std::memory_order_relaxed);
+    if (TaskHandle_t producer = m_producer) xTaskNotifyGive(producer);
+  }
+}
+
+void PlaybackPipeline::playTask(void *arg) {
+  PlaybackPipeline *self = static_cast<PlaybackPipeline *>(arg);
+  while (self->m_running) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+    self->drain();
+  }
+  self->m_taskAlive = false;
+  vTaskDelete(nullptr);
+}
+
+#else
+// Non-ESP32 placeholder implementations
+bool PlaybackPipeline::begin(AudioIO &) { return false; }
+void PlaybackPipeline::end() {}
+bool PlaybackPipeline::running() const { return false; }
+void PlaybackPipeline::start(uint8_t) {}
+AudioBuffer *PlaybackPipeline::acquire(uint32_t) { return nullptr; }
+void PlaybackPipeline::submit() {}
+void PlaybackPipeline::finish() {}
+bool PlaybackPipeline::wait(uint32_t) { return true; }
+PlaybackStats PlaybackPipeline::stats() const { return PlaybackStats{0, 0, 0, 0, 0, 0}; }
+#endif
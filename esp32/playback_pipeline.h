@@ -0,0 +1,95 @@
+#ifndef ESP32_PLAYBACK_PIPELINE_H
+#define ESP32_PLAYBACK_PIPELINE_H
+
+#include <Arduino.h>
+#include "audio_io.h"
+#include "spsc_ring.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <atomic>
+#include <freertos/task.h>
+#endif
+
+// Frames buffered between the network and the speaker: 8 x 32 ms = 256 ms.
+#ifndef PLAYBACK_RING_FRAMES
+#define PLAYBACK_RING_FRAMES 8
+#endif
+// Jitter buffer: frames queued before playback starts (and restarts after an
+// underrun). 128 ms rides out a WiFi power-save wakeup (one 102.4 ms DTIM
+// beacon interval) plus ordinary TCP jitter.
+#ifndef PLAYBACK_PREFILL_FRAMES
+#define PLAYBACK_PREFILL_FRAMES 4
+#endif
+// Playback and capture never overlap, so the I2S writer reuses the capture core.
+#ifndef PLAYBACK_CORE
+#define PLAYBACK_CORE 1
+#endif
+
+struct PlaybackStats {
+  uint32_t framesPlayed;   // frames handed to I2S
+  uint32_t underruns;      // times the speaker ran dry mid-stream
+  uint32_t underrunMs;     // silence those underruns inserted
+  uint32_t maxFill;        // ring high-water mark, in frames
+  uint32_t producerWaits;  // acquire() calls that had to wait for a free slot
+  uint32_t firstAudioMs;   // start() to the first frame handed to I2S
+};
+
+// Decouples network reads from I2S writes for streamed playback. The caller
+// (the network task) fills ring slots in place -- socket reads land directly
+// in the AudioBuffer the player task later passes to AudioIO::playSamples, so
+// nothing is copied between the two. The player holds back until
+// PLAYBACK_PREFILL_FRAMES are queued, then keeps the I2S DMA fed; if the
+// network falls behind far enough that the DMA runs dry, it counts an underrun
+// and prefills again.
+class PlaybackPipeline {
+public:
+  bool begin(AudioIO &io);
+  void end();                // stop the player task; queued audio is dropped
+  bool running() const;
+
+  // Producer side, all from one task. start() begins a stream and resets the
+  // stats (a local source such as flash can use a smaller prefill); acquire()
+  // returns a free slot to fill (set count), or nullptr if none frees up
+  // within timeoutMs; submit() queues it. finish() marks the end of the
+  // stream so a tail shorter than the prefill still plays.
+  void start(uint8_t prefillFrames = PLAYBACK_PREFILL_FRAMES);
+  AudioBuffer *acquire(uint32_t timeoutMs);
+  void submit();
+  void finish();
+  // Block until every submitted sample has left the speaker, DMA included.
+  bool wait(uint32_t timeoutMs);
+
+  PlaybackStats stats() const;
+
+private:
+#ifdef ARDUINO_ARCH_ESP32
+  static void playTask(void *self);
+  void drain();
+
+  AudioIO *m_io = nullptr;
+  TaskHandle_t m_playTask = nullptr;
+  std::atomic<TaskHandle_t> m_producer{nullptr};
+  std::atomic<bool> m_running{false};
+  std::atomic<bool> m_taskAlive{false};
+  std::atomic<bool> m_finished{false};
+  std::atomic<uint8_t> m_prefill{PLAYBACK_PREFILL_FRAMES};
+  bool m_playing = false;        // player task only
+  std::atomic<uint32_t> m_startUs{0};
+  // start() bumps the generation; the player zeroes its own counters when it
+  // sees a new one, so each counter keeps a single writer.
+  std::atomic<uint32_t> m_generation{0};
+  std::atomic<uint32_t> m_seenGeneration{0};
+  std::atomic<uint32_t> m_queuedUntil{0};  // micros() when the DMA runs dry
+  SpscRing<AudioBuffer, PLAYBACK_RING_FRAMES> m_ring;
+
+  // Each counter has a single writer (producer or player task).
+  std::atomic<uint32_t> m_framesPlayed{0};
+  std::atomic<uint32_t> m_underruns{0};
+  std::atomic<uint32_t> m_underrunMs{0};
+  std::atomic<uint32_t> m_maxFill{0};
+  std::atomic<uint32_t> m_producerWaits{0};
+  std::atomic<uint32_t> m_firstAudioMs{0};
+#endif
+};
+
+#endif // ESP32_PLAYBACK_PIPELINE_H
@@ -1,50 +1,152 @@
 #include "stt_client.h"
 
+bool sttParseEndpoint(const String &url, String &host, uint16_t &port, String &prefix) {
+  int scheme = url.indexOf("://");
+  String rest = scheme >= 0 ? url.substring(scheme + 3) : url;
+  int slash = rest.indexOf('/');
+  String authority = slash >= 0 ? rest.substring(0, slash) : rest;
+  prefix = slash >= 0 ? rest.substring(slash) : String("");
+  if (prefix.endsWith("/")) prefix.remove(prefix.length() - 1);
+  int colon = authority.indexOf(':');
+  host = colon >= 0 ? authority.substring(0, colon) : authority;
+  port = colon >= 0 ? (uint16_t)authority.substring(colon + 1).toInt() : 80;
+  return host.length() > 0 && port != 0;
+}
+
+String sttJsonString(const String &json, const char *key) {
+  String quoted = String("\"") + key + "\"";
+  int at = json.indexOf(quoted);
+  if (at < 0) return String();
+  int colon = json.indexOf(':', at + quoted.length());
+  int quote = colon >= 0 ? json.indexOf('"', colon + 1) : -1;
+  if (quote < 0) return String();
+  String out;
+  for (unsigned int i = quote + 1; i < json.length(); ++i) {
+    char c = json[i];
+    if (c == '"') break;
+    if (c == '\\' && i + 1 < json.length()) {
+      c = json[++i];
+      if (c == 'n') c = ' ';
+    }
+    out += c;
+  }
+  return out;
+}
+
 #ifdef ARDUINO_ARCH_ESP32
 #include <WiFi.h>
-#include <HTTPClient.h>
+
+#define STT_CONNECT_TIMEOUT_MS 3000
+#define STT_RESPONSE_TIMEOUT_MS 5000
 
 bool STTClient::begin(const String &endpointUrl) {
+  // TLS is not used for the local STT bridge.
   m_endpoint = endpointUrl;
-  return true;
+  return endpointUrl.startsWith("http://") && sttParseEndpoint(endpointUrl, m_host, m_port, m_prefix);
 }
 
 bool STTClient::beginStream() {
   if (m_state != STTState::Idle) return false;
-  // Could initiate a session via POST /stt/start to get a session id
+  if (!m_client.connected() && !m_client.connect(m_host.c_str(), m_port, STT_CONNECT_TIMEOUT_MS)) {
+    return false;
+  }
+  m_client.setNoDelay(true); // each chunk is a whole 32 ms frame; do not let Nagle hold it
+  m_client.setTimeout(STT_RESPONSE_TIMEOUT_MS);
+  String head = "POST " + m_prefix + "/stt/stream HTTP/1.1\r\n";
+  head += "Host: " + m_host + "\r\n";
+  head += "Content-Type: application/octet-stream\r\n";
+  head += "X-Audio-Format: " + String(audioCodecName(m_encoder.codec())) + ";rate=" + String(AUDIO_SAMPLE_RATE) + "\r\n";
+  head += "Transfer-Encoding: chunked\r\n";
+  head += "Connection: keep-alive\r\n\r\n";
+  if (m_client.print(head) != head.length()) {
+    abortStream();
+    return false;
+  }
+  m_encoder.reset();
+  m_bytesSent = 0;
+  m_chunksSent = 0;
   m_state = STTState::Streaming;
   return true;
 }
 
 bool STTClient::pushAudio(const AudioBuffer &buf) {
   if (m_state != STTState::Streaming) return false;
-  // Simplified: send each buffer independently (can be optimized to chunked transfer)
-  HTTPClient http;
-  http.begin(m_endpoint + "/stt/chunk");
-  http.addHeader("Content-Type", "application/octet-stream");
-  int rc = http.POST((uint8_t*)buf.samples, buf.count * sizeof(int16_t));
-  http.end();
-  return rc > 0;
+  if (buf.count == 0) return true; // a zero-size chunk would end the body
+  // Size line, encoded payload and trailing CRLF go out in one write (one segment).
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  uint8_t packet[AUDIO_ENCODED_MAX_BYTES + 12];
+  size_t payload = audioEncodedSize(m_encoder.codec(), buf.count);
+  size_t n = 0;
+  char digits[8];
+  size_t nd = 0;
+  for (size_t v = payload; v || nd == 0; v >>= 4) digits[nd++] = HEX_DIGITS[v & 0xf];
+  while (nd) packet[n++] = (uint8_t)digits[--nd];
+  packet[n++] = '\r';
+  packet[n++] = '\n';
+  n += m_encoder.encode(buf, packet + n);
+  packet[n++] = '\r';
+  packet[n++] = '\n';
+  if (m_client.write(packet, n) != n) {
+    abortStream();
+    return false;
+  }
+  m_bytesSent += payload;
+  ++m_chunksSent;
+  return true;
+}
+
+// Value of "text" in a JSON reply, or the whole body if it is not JSON.
+static String extractText(const String &body) {
+  return body.startsWith("{") ? sttJsonString(body, "text") : body;
 }
 
 bool STTClient::endStream(String &finalText) {
+  finalText = "";
   if (m_state != STTState::Streaming) return false;
-  HTTPClient http;
-  http.begin(m_endpoint + "/stt/finish");
-  int rc = http.GET();
-  if (rc == 200) {
-    finalText = http.getString();
-  } else {
-    finalText = "";
+  if (m_client.print("0\r\n\r\n") != 5) {
+    abortStream();
+    return false;
+  }
+
+  String status = m_client.readStringUntil('\n');
+  int code = status.startsWith("HTTP/1.") ? (int)status.substring(status.indexOf(' ') + 1).toInt() : -1;
+  long contentLength = -1;
+  for (;;) {
+    String line = m_client.readStringUntil('\n');
+    line.trim();
+    if (line.isEmpty()) break;
+    int colon = line.indexOf(':');
+    if (colon > 0 && line.substring(0, colon).equalsIgnoreCase("Content-Length")) {
+      contentLength = line.substring(colon + 1).toInt();
+    }
   }
-  http.end();
+  String body;
+  if (contentLength > 0) {
+    body.reserve((unsigned int)contentLength);
+    char chunk[128];
+    while (contentLength > 0) {
+      size_t got = m_client.readBytes(chunk, min((size_t)contentLength, sizeof(chunk)));
+      if (got == 0) break; // timed out or closed
+      body.concat(chunk, (unsigned int)got);
+      contentLength -= (long)got;
+    }
+  }
+  if (code == 200) finalText = extractText(body);
+  // One connection per utterance: close so the server can release the session.
+  m_client.stop();
   m_state = STTState::Idle;
   return !finalText.isEmpty();
 }
 
+void STTClient::abortStream() {
+  m_client.stop();
+  m_state = STTState::Idle;
+}
+
 #else
 bool STTClient::begin(const String &) { return false; }
 bool STTClient::beginStream() { return false; }
 bool STTClient::pushAudio(const AudioBuffer &) { return false; }
 bool STTClient::endStream(String &) { return false; }
+void STTClient::abortStream() {}
 #endif
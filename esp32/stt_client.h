@@ -2,20 +2,52 @@
 #define ESP32_STT_CLIENT_H
 
 #include <Arduino.h>
+#include "audio_codec.h"
 #include "audio_io.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <WiFiClient.h>
+#endif
+
 enum class STTState { Idle, Streaming };
 
+// Helpers shared by the STT transports.
+// Split scheme://host[:port][/prefix]; the port defaults to 80.
+bool sttParseEndpoint(const String &url, String &host, uint16_t &port, String &prefix);
+// Value of a string field in a flat JSON object, or "" if it is absent.
+String sttJsonString(const String &json, const char *key);
+
 class STTClient {
 public:
-  bool begin(const String &endpointUrl);
+  bool begin(const String &endpointUrl);  // http://host[:port][/prefix]
+  // Open one keep-alive connection and start a chunked POST {prefix}/stt/stream.
   bool beginStream();
-  bool pushAudio(const AudioBuffer &buf); // send chunk
-  bool endStream(String &finalText);      // finalize and get result
+  bool pushAudio(const AudioBuffer &buf); // one HTTP chunk on the open request
+  bool endStream(String &finalText);      // last chunk, read {"text":...}, close
   STTState state() const { return m_state; }
+
+  // Uplink encoding for the next stream (default STT_AUDIO_CODEC).
+  void setCodec(AudioCodec codec) { m_encoder.setCodec(codec); }
+  AudioCodec codec() const { return m_encoder.codec(); }
+
+  // Encoded audio bytes written in the current / last stream.
+  uint32_t bytesSent() const { return m_bytesSent; }
+  uint32_t chunksSent() const { return m_chunksSent; }
+
 private:
+  void abortStream();
+
   String m_endpoint;
   STTState m_state = STTState::Idle;
+#ifdef ARDUINO_ARCH_ESP32
+  WiFiClient m_client;
+  String m_host;
+  uint16_t m_port = 80;
+  String m_prefix;
+#endif
+  AudioEncoder m_encoder;
+  uint32_t m_bytesSent = 0;
+  uint32_t m_chunksSent = 0;
 };
 
 #endif // ESP32_STT_CLIENT_H
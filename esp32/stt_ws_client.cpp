@@ -0,0 +1,234 @@
+#include "stt_ws_client.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <WiFi.h>
+
+#define STT_CONNECT_TIMEOUT_MS 3000
+#define STT_RESPONSE_TIMEOUT_MS 5000
+
+// RFC 6455 opcodes used here.
+#define WS_TEXT   0x1
+#define WS_BINARY 0x2
+#define WS_CLOSE  0x8
+#define WS_PING   0x9
+#define WS_PONG   0xA
+
+// Largest message this client sends: one audio frame.
+#define WS_MAX_PAYLOAD (AUDIO_FRAME_SAMPLES * sizeof(int16_t))
+
+static void base64Encode(const uint8_t *in, size_t len, char *out) {
+  static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t o = 0;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = (uint32_t)in[i] << 16;
+    if (i + 1 < len) v |= (uint32_t)in[i + 1] << 8;
+    if (i + 2 < len) v |= in[i + 2];
+    out[o++] = ALPHABET[(v >> 18) & 0x3f];
+    out[o++] = ALPHABET[(v >> 12) & 0x3f];
+    out[o++] = i + 1 < len ? ALPHABET[(v >> 6) & 0x3f] : '=';
+    out[o++] = i + 2 < len ? ALPHABET[v & 0x3f] : '=';
+  }
+  out[o] = '\0';
+}
+
+bool STTWebSocketClient::begin(const String &endpointUrl) {
+  return endpointUrl.startsWith("ws://") && sttParseEndpoint(endpointUrl, m_host, m_port, m_prefix);
+}
+
+bool STTWebSocketClient::beginStream() {
+  if (m_state != STTState::Idle) return false;
+  if (!m_client.connect(m_host.c_str(), m_port, STT_CONNECT_TIMEOUT_MS)) return false;
+  m_client.setNoDelay(true);
+  m_client.setTimeout(STT_RESPONSE_TIMEOUT_MS);
+
+  uint8_t nonce[16];
+  for (size_t i = 0; i < sizeof(nonce); i += 4) {
+    uint32_t r = esp_random();
+    memcpy(nonce + i, &r, 4);
+  }
+  char key[25];
+  base64Encode(nonce, sizeof(nonce), key);
+  String head = "GET " + m_prefix + "/stt/ws HTTP/1.1\r\n";
+  head += "Host: " + m_host + "\r\n";
+  head += "Upgrade: websocket\r\n";
+  head += "Connection: Upgrade\r\n";
+  head += "Sec-WebSocket-Key: " + String(key) + "\r\n";
+  head += "Sec-WebSocket-Version: 13\r\n";
+  head += "X-Audio-Format: " + String(audioCodecName(m_encoder.codec())) + ";rate=" + String(AUDIO_SAMPLE_RATE) + "\r\n\r\n";
+  if (m_client.print(head) != head.length()) {
+    abortStream();
+    return false;
+  }
+
+  // Sec-WebSocket-Accept is not checked: like the HTTP transport, this talks
+  // to a trusted bridge on the local network, and SHA-1 is not worth the flash.
+  String status = m_client.readStringUntil('\n');
+  bool upgraded = false;
+  for (;;) {
+    String line = m_client.readStringUntil('\n');
+    line.trim();
+    if (line.isEmpty()) break;
+    int colon = line.indexOf(':');
+    if (colon > 0 && line.substring(0, colon).equalsIgnoreCase("Upgrade")) {
+      String value = line.substring(colon + 1);
+      value.trim();
+      upgraded = value.equalsIgnoreCase("websocket");
+    }
+  }
+  if (!status.startsWith("HTTP/1.1 101") || !upgraded) {
+    abortStream();
+    return false;
+  }
+
+  m_encoder.reset();
+  m_rxLen = 0;
+  m_final = "";
+  m_haveFinal = false;
+  m_closed = false;
+  m_bytesSent = 0;
+  m_chunksSent = 0;
+  m_partials = 0;
+  m_state = STTState::Streaming;
+  return true;
+}
+
+bool STTWebSocketClient::sendFrame(uint8_t opcode, const uint8_t *payload, size_t len) {
+  if (len > WS_MAX_PAYLOAD) return false;
+  // Header, masking key and masked payload go out in one write.
+  uint8_t packet[WS_MAX_PAYLOAD + 8];
+  size_t n = 0;
+  packet[n++] = 0x80 | opcode; // FIN: messages are never fragmented
+  if (len < 126) {
+    packet[n++] = 0x80 | (uint8_t)len;
+  } else {
+    packet[n++] = 0x80 | 126;
+    packet[n++] = (uint8_t)(len >> 8);
+    packet[n++] = (uint8_t)len;
+  }
+  uint32_t key = esp_random(); // client frames must be masked
+  uint8_t *mask = packet + n;
+  memcpy(mask, &key, 4);
+  n += 4;
+  for (size_t i = 0; i < len; ++i) packet[n + i] = payload[i] ^ mask[i & 3];
+  n += len;
+  return m_client.write(packet, n) == n;
+}
+
+bool STTWebSocketClient::pushAudio(const AudioBuffer &buf) {
+  if (m_state != STTState::Streaming) return false;
+  if (buf.count == 0) return true;
+  uint8_t encoded[AUDIO_ENCODED_MAX_BYTES];
+  size_t payload = m_encoder.encode(buf, encoded);
+  if (!sendFrame(WS_BINARY, encoded, payload)) {
+    abortStream();
+    return false;
+  }
+  m_bytesSent += payload;
+  ++m_chunksSent;
+  poll();
+  return m_state == STTState::Streaming;
+}
+
+void STTWebSocketClient::poll() {
+  while (m_state == STTState::Streaming && !m_closed) {
+    int avail = m_client.available();
+    if (avail <= 0) return;
+    int got = m_client.read(m_rx + m_rxLen, min((size_t)avail, sizeof(m_rx) - m_rxLen));
+    if (got <= 0) return;
+    m_rxLen += (size_t)got;
+    // A message that still fills the whole buffer can never be completed.
+    if (!parseFrames() || m_rxLen == sizeof(m_rx)) {
+      abortStream();
+      return;
+    }
+  }
+}
+
+// Consume every complete frame in m_rx; false on a protocol error.
+bool STTWebSocketClient::parseFrames() {
+  size_t pos = 0;
+  while (m_rxLen - pos >= 2) {
+    uint8_t *h = m_rx + pos;
+    size_t avail = m_rxLen - pos;
+    size_t len = h[1] & 0x7f;
+    size_t hdr = 2;
+    if (len == 127) return false; // never needed for transcripts
+    if (len == 126) {
+      if (avail < 4) break;
+      len = ((size_t)h[2] << 8) | h[3];
+      hdr = 4;
+    }
+    size_t maskAt = hdr;
+    if (h[1] & 0x80) hdr += 4;
+    if (avail < hdr + len) break;
+    if (!(h[0] & 0x80)) return false; // the bridge does not fragment
+    uint8_t *payload = h + hdr;
+    if (h[1] & 0x80) {
+      for (size_t i = 0; i < len; ++i) payload[i] ^= h[maskAt + (i & 3)];
+    }
+    switch (h[0] & 0x0f) {
+      case WS_TEXT: handleMessage(reinterpret_cast<const char *>(payload), len); break;
+      case WS_CLOSE: m_closed = true; break;
+      case WS_PING: if (!sendFrame(WS_PONG, payload, len)) return false; break;
+      default: break;
+    }
+    pos += hdr + len;
+  }
+  memmove(m_rx, m_rx + pos, m_rxLen - pos);
+  m_rxLen -= pos;
+  return true;
+}
+
+void STTWebSocketClient::handleMessage(const char *text, size_t len) {
+  String msg(text, (unsigned int)len);
+  if (msg.indexOf("\"partial\"") >= 0) {
+    ++m_partials;
+    if (m_onTranscript) m_onTranscript(sttJsonString(msg, "partial"), false, m_ctx);
+  } else if (msg.indexOf("\"text\"") >= 0) {
+    m_final = sttJsonString(msg, "text");
+    m_haveFinal = true;
+    if (m_onTranscript) m_onTranscript(m_final, true, m_ctx);
+  }
+}
+
+bool STTWebSocketClient::endStream(String &finalText) {
+  finalText = "";
+  if (m_state != STTState::Streaming) return false;
+  static const char END[] = "{\"event\":\"end\"}";
+  if (!sendFrame(WS_TEXT, reinterpret_cast<const uint8_t *>(END), sizeof(END) - 1)) {
+    abortStream();
+    return false;
+  }
+  unsigned long start = millis();
+  while (m_state == STTState::Streaming && !m_haveFinal && !m_closed &&
+         millis() - start < STT_RESPONSE_TIMEOUT_MS) {
+    if (m_client.available() > 0) poll();
+    else if (!m_client.connected()) break;
+    else delay(1);
+  }
+  if (m_haveFinal) finalText = m_final;
+  if (m_state == STTState::Streaming && !m_closed) {
+    static const uint8_t NORMAL_CLOSURE[] = {0x03, 0xe8}; // 1000
+    sendFrame(WS_CLOSE, NORMAL_CLOSURE, sizeof(NORMAL_CLOSURE));
+  }
+  m_client.stop();
+  m_state = STTState::Idle;
+  return !finalText.isEmpty();
+}
+
+void STTWebSocketClient::abortStream() {
+  m_client.stop();
+  m_state = STTState::Idle;
+}
+
+#else
+bool STTWebSocketClient::begin(const String &) { return false; }
+bool STTWebSocketClient::beginStream() { return false; }
+bool STTWebSocketClient::pushAudio(const AudioBuffer &) { return false; }
+void STTWebSocketClient::poll() {}
+bool STTWebSocketClient::endStream(String &) { return false; }
+bool STTWebSocketClient::sendFrame(uint8_t, const uint8_t *, size_t) { return false; }
+bool STTWebSocketClient::parseFrames() { return false; }
+void STTWebSocketClient::handleMessage(const char *, size_t) {}
+void STTWebSocketClient::abortStream() {}
+#endif
@@ -0,0 +1,78 @@
+#ifndef ESP32_STT_WS_CLIENT_H
+#define ESP32_STT_WS_CLIENT_H
+
+#include <Arduino.h>
+#include "audio_codec.h"
+#include "audio_io.h"
+#include "stt_client.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <WiFiClient.h>
+#endif
+
+// Largest server message kept; partials are a sentence at most.
+#ifndef STT_WS_RX_BUFFER
+#define STT_WS_RX_BUFFER 512
+#endif
+
+// Called for every transcript the server sends: partials while audio is still
+// streaming (final == false), then once with the final text.
+typedef void (*STTTranscriptFn)(const String &text, bool final, void *ctx);
+
+// WebSocket transport for STT. Audio goes up as one binary message per frame
+// and the server answers on the same connection with {"partial":"..."}
+// messages during the utterance and {"text":"..."} after it, so intent
+// classification can start before the speaker has finished.
+//
+// Same interface as STTClient, so AudioPipeline can drive either transport.
+// The transcript callback runs on the task that calls pushAudio(), poll() or
+// endStream() (the uploader task under AudioPipeline); keep it short.
+class STTWebSocketClient {
+public:
+  bool begin(const String &endpointUrl);  // ws://host[:port][/prefix]
+  void onTranscript(STTTranscriptFn fn, void *ctx) { m_onTranscript = fn; m_ctx = ctx; }
+
+  // Connect and upgrade GET {prefix}/stt/ws.
+  bool beginStream();
+  bool pushAudio(const AudioBuffer &buf); // one binary message, then poll()
+  // Dispatch transcripts that have already arrived; never blocks.
+  void poll();
+  // Send {"event":"end"}, wait for the final text, close the connection.
+  bool endStream(String &finalText);
+  STTState state() const { return m_state; }
+
+  // Uplink encoding for the next stream (default STT_AUDIO_CODEC).
+  void setCodec(AudioCodec codec) { m_encoder.setCodec(codec); }
+  AudioCodec codec() const { return m_encoder.codec(); }
+
+  uint32_t bytesSent() const { return m_bytesSent; }
+  uint32_t chunksSent() const { return m_chunksSent; }
+  uint32_t partialsReceived() const { return m_partials; }
+
+private:
+  bool sendFrame(uint8_t opcode, const uint8_t *payload, size_t len);
+  bool parseFrames();
+  void handleMessage(const char *text, size_t len);
+  void abortStream();
+
+  STTState m_state = STTState::Idle;
+  STTTranscriptFn m_onTranscript = nullptr;
+  void *m_ctx = nullptr;
+#ifdef ARDUINO_ARCH_ESP32
+  WiFiClient m_client;
+  String m_host;
+  uint16_t m_port = 80;
+  String m_prefix;
+  uint8_t m_rx[STT_WS_RX_BUFFER];
+  size_t m_rxLen = 0;
+  String m_final;
+  bool m_haveFinal = false;
+  bool m_closed = false;
+#endif
+  AudioEncoder m_encoder;
+  uint32_t m_bytesSent = 0;
+  uint32_t m_chunksSent = 0;
+  uint32_t m_partials = 0;
+};
+
+#endif // ESP32_STT_WS_CLIENT_H
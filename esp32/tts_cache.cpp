@@ -0,0 +1,308 @@
+#include "tts_cache.h"
+
+#define TTS_FILE_MAGIC  0x41535454UL   // "TTSA"
+#define TTS_INDEX_MAGIC 0x49535454UL   // "TTSI"
+#define TTS_CACHE_VERSION 1
+#define TTS_INDEX_PATH TTS_CACHE_DIR "/index"
+
+uint64_t TTSCache::key(const String &text, const String &voice) {
+  // FNV-1a over voice, a separator, the sample rate and the text.
+  uint64_t h = 0xcbf29ce484222325ULL;
+  auto mix = [&h](const uint8_t *p, size_t n) {
+    for (size_t i = 0; i < n; ++i) h = (h ^ p[i]) * 0x100000001b3ULL;
+  };
+  mix(reinterpret_cast<const uint8_t *>(voice.c_str()), voice.length() + 1);
+  uint32_t rate = AUDIO_SAMPLE_RATE;
+  mix(reinterpret_cast<const uint8_t *>(&rate), sizeof(rate));
+  mix(reinterpret_cast<const uint8_t *>(text.c_str()), text.length());
+  return h;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+
+// Both targets are little-endian; headers are written as laid out here.
+struct TTSFileHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t codec;
+  uint16_t reserved;
+  uint32_t sampleRate;
+  uint32_t samples;
+};
+
+struct TTSIndexHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t count;
+  uint16_t reserved;
+  uint32_t clock;
+};
+
+bool TTSCache::begin(fs::FS &fs, uint32_t maxBytes, AudioCodec codec) {
+  m_fs = &fs;
+  m_maxBytes = maxBytes;
+  m_codec = codec;
+  if (!fs.exists(TTS_CACHE_DIR) && !fs.mkdir(TTS_CACHE_DIR)) return false;
+  loadIndex();
+  removeOrphans();
+  // The budget may have shrunk since the index was written.
+  if (makeRoom(0, 0)) saveIndex();
+  return true;
+}
+
+void TTSCache::end() {
+  if (!m_fs) return;
+  close();
+  abortStore();
+  flush();
+  m_fs = nullptr;
+}
+
+bool TTSCache::flush() {
+  return !m_indexDirty || saveIndex();
+}
+
+void TTSCache::clear() {
+  close();
+  abortStore();
+  while (m_count) remove(m_count - 1);
+  saveIndex();
+}
+
+String TTSCache::pathFor(uint64_t key, bool temporary) {
+  char name[40];
+  snprintf(name, sizeof(name), TTS_CACHE_DIR "/%08lx%08lx.%s", (unsigned long)(key >> 32),
+           (unsigned long)(key & 0xffffffffUL), temporary ? "tmp" : "tts");
+  return String(name);
+}
+
+int TTSCache::find(uint64_t key) const {
+  for (int i = 0; i < m_count; ++i) {
+    if (m_entries[i].key == key) return i;
+  }
+  return -1;
+}
+
+bool TTSCache::contains(uint64_t key) const {
+  return find(key) >= 0;
+}
+
+void TTSCache::remove(int index) {
+  m_fs->remove(pathFor(m_entries[index].key));
+  m_bytes -= m_entries[index].bytes;
+  m_entries[index] = m_entries[--m_count];
+}
+
+// Evict least recently used answers until `entries` more answers of `bytes`
+// in total fit; true if any went.
+bool TTSCache::makeRoom(uint8_t entries, uint32_t bytes) {
+  bool evicted = false;
+  while (m_count && (m_count + entries > TTS_CACHE_MAX_ENTRIES || m_bytes + bytes > m_maxBytes)) {
+    int lru = 0;
+    for (int i = 1; i < m_count; ++i) {
+      if (m_entries[i].lastUse < m_entries[lru].lastUse) lru = i;
+    }
+    remove(lru);
+    ++m_evictions;
+    evicted = true;
+  }
+  return evicted;
+}
+
+bool TTSCache::loadIndex() {
+  m_count = 0;
+  m_bytes = 0;
+  m_clock = 0;
+  File f = m_fs->open(TTS_INDEX_PATH, "r");
+  if (!f) return false;
+  TTSIndexHeader hdr;
+  if (f.read(reinterpret_cast<uint8_t *>(&hdr), sizeof(hdr)) != sizeof(hdr) || hdr.magic != TTS_INDEX_MAGIC ||
+      hdr.version != TTS_CACHE_VERSION) {
+    return false;
+  }
+  m_clock = hdr.clock;
+  for (uint8_t i = 0; i < hdr.count && m_count < TTS_CACHE_MAX_ENTRIES; ++i) {
+    Entry e;
+    if (f.read(reinterpret_cast<uint8_t *>(&e), sizeof(e)) != sizeof(e)) break;
+    // Trust the file system over the index for what is actually there.
+    File audio = m_fs->open(pathFor(e.key), "r");
+    if (!audio) continue;
+    e.bytes = audio.size();
+    m_entries[m_count++] = e;
+    m_bytes += e.bytes;
+  }
+  return true;
+}
+
+bool TTSCache::saveIndex() {
+  File f = m_fs->open(TTS_INDEX_PATH, "w", true);
+  if (!f) return false;
+  TTSIndexHeader hdr = {TTS_INDEX_MAGIC, TTS_CACHE_VERSION, m_count, 0, m_clock};
+  bool ok = f.write(reinterpret_cast<const uint8_t *>(&hdr), sizeof(hdr)) == sizeof(hdr);
+  for (int i = 0; i < m_count && ok; ++i) {
+    ok = f.write(reinterpret_cast<const uint8_t *>(&m_entries[i]), sizeof(Entry)) == sizeof(Entry);
+  }
+  if (ok) m_indexDirty = false;
+  return ok;
+}
+
+// Answers left behind by a reset between writing a file and the index, and
+// unfinished stores.
+void TTSCache::removeOrphans() {
+  File dir = m_fs->open(TTS_CACHE_DIR);
+  if (!dir || !dir.isDirectory()) return;
+  String stale[8];
+  int staleCount = 0;
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    String name = f.name();
+    name = name.substring(name.lastIndexOf('/') + 1);
+    String path = String(TTS_CACHE_DIR "/") + name;
+    if (path == TTS_INDEX_PATH) continue;
+    bool known = false;
+    for (int i = 0; i < m_count && !known; ++i) known = path == pathFor(m_entries[i].key);
+    if (!known && staleCount < 8) stale[staleCount++] = path;
+  }
+  dir.close();
+  // Remove outside the listing; any beyond the first eight go on the next boot.
+  for (int i = 0; i < staleCount; ++i) m_fs->remove(stale[i]);
+}
+
+bool TTSCache::open(uint64_t key) {
+  close();
+  int i = m_fs ? find(key) : -1;
+  if (i >= 0) {
+    m_read = m_fs->open(pathFor(key), "r");
+    TTSFileHeader hdr;
+    if (m_read && m_read.read(reinterpret_cast<uint8_t *>(&hdr), sizeof(hdr)) == sizeof(hdr) &&
+        hdr.magic == TTS_FILE_MAGIC && hdr.version == TTS_CACHE_VERSION && hdr.sampleRate == AUDIO_SAMPLE_RATE &&
+        hdr.codec <= (uint8_t)AudioCodec::ImaAdpcm) {
+      m_readCodec = (AudioCodec)hdr.codec;
+      m_readLeft = hdr.samples;
+      // Recency stays in RAM until the next index write: a hit touches no flash.
+      m_entries[i].lastUse = ++m_clock;
+      m_indexDirty = true;
+      ++m_hits;
+      return true;
+    }
+    // Unreadable: drop it so the next request re-synthesizes it.
+    close();
+    remove(i);
+    saveIndex();
+  }
+  ++m_misses;
+  return false;
+}
+
+size_t TTSCache::readFrame(AudioBuffer &out) {
+  out.count = 0;
+  if (!m_read || !m_readLeft) return 0;
+  size_t n = min((uint32_t)AUDIO_FRAME_SAMPLES, m_readLeft);
+  size_t bytes = audioEncodedSize(m_readCodec, n);
+  if (m_readCodec == AudioCodec::Pcm16) {
+    // Straight into the caller's buffer.
+    if (m_read.read(reinterpret_cast<uint8_t *>(out.samples), bytes) != bytes) return 0;
+  } else {
+    uint8_t encoded[AUDIO_ENCODED_MAX_BYTES];
+    if (m_read.read(encoded, bytes) != bytes) return 0;
+    audioDecode(m_readCodec, encoded, n, out.samples);
+  }
+  m_readLeft -= n;
+  out.count = n;
+  return n;
+}
+
+void TTSCache::close() {
+  m_read.close();
+  m_readLeft = 0;
+}
+
+bool TTSCache::beginStore(uint64_t key) {
+  abortStore();
+  if (!m_fs || contains(key)) return false;
+  m_write = m_fs->open(pathFor(key, true), "w", true);
+  if (!m_write) {
+    ++m_storeErrors;
+    return false;
+  }
+  m_writeKey = key;
+  m_writeSamples = 0;
+  m_writeBytes = sizeof(TTSFileHeader);
+  m_writeFailed = false;
+  m_encoder.setCodec(m_codec);
+  // Placeholder; commitStore() fills in the length.
+  TTSFileHeader hdr = {TTS_FILE_MAGIC, TTS_CACHE_VERSION, (uint8_t)m_codec, 0, AUDIO_SAMPLE_RATE, 0};
+  m_writeFailed = m_write.write(reinterpret_cast<const uint8_t *>(&hdr), sizeof(hdr)) != sizeof(hdr);
+  return !m_writeFailed;
+}
+
+bool TTSCache::storeFrame(const AudioBuffer &frame) {
+  if (!m_write || m_writeFailed) return false;
+  uint8_t encoded[AUDIO_ENCODED_MAX_BYTES];
+  size_t bytes = m_encoder.encode(frame, encoded);
+  // An answer larger than the whole budget is not worth the flash wear.
+  if (m_writeBytes + bytes > m_maxBytes || m_write.write(encoded, bytes) != bytes) {
+    m_writeFailed = true;
+    return false;
+  }
+  m_writeSamples += frame.count;
+  m_writeBytes += bytes;
+  return true;
+}
+
+bool TTSCache::commitStore() {
+  if (!m_write) return false;
+  bool ok = !m_writeFailed && m_writeSamples > 0;
+  if (ok) {
+    TTSFileHeader hdr = {TTS_FILE_MAGIC, TTS_CACHE_VERSION, (uint8_t)m_codec, 0, AUDIO_SAMPLE_RATE, m_writeSamples};
+    ok = m_write.seek(0) && m_write.write(reinterpret_cast<const uint8_t *>(&hdr), sizeof(hdr)) == sizeof(hdr);
+  }
+  uint32_t bytes = m_writeBytes;
+  m_write.close();
+  String tmp = pathFor(m_writeKey, true);
+  if (!ok) {
+    m_fs->remove(tmp);
+    ++m_storeErrors;
+    return false;
+  }
+  makeRoom(1, bytes);
+  String path = pathFor(m_writeKey);
+  m_fs->remove(path);
+  if (!m_fs->rename(tmp, path)) {
+    m_fs->remove(tmp);
+    ++m_storeErrors;
+    saveIndex();
+    return false;
+  }
+  m_entries[m_count++] = Entry{m_writeKey, bytes, ++m_clock};
+  m_bytes += bytes;
+  ++m_stores;
+  saveIndex();
+  return true;
+}
+
+void TTSCache::abortStore() {
+  if (!m_write) return;
+  m_write.close();
+  m_fs->remove(pathFor(m_writeKey, true));
+}
+
+TTSCacheStats TTSCache::stats() const {
+  return TTSCacheStats{m_count, m_bytes, m_hits, m_misses, m_stores, m_evictions, m_storeErrors};
+}
+
+#else
+// Non-ESP32 placeholder implementations
+bool TTSCache::begin(fs::FS &, uint32_t, AudioCodec) { return false; }
+void TTSCache::end() {}
+bool TTSCache::flush() { return true; }
+void TTSCache::clear() {}
+bool TTSCache::contains(uint64_t) const { return false; }
+bool TTSCache::open(uint64_t) { return false; }
+size_t TTSCache::readFrame(AudioBuffer &out) { out.count = 0; return 0; }
+void TTSCache::close() {}
+bool TTSCache::beginStore(uint64_t) { return false; }
+bool TTSCache::storeFrame(const AudioBuffer &) { return false; }
+bool TTSCache::commitStore() { return false; }
+void TTSCache::abortStore() {}
+TTSCacheStats TTSCache::stats() const { return TTSCacheStats{0, 0, 0, 0, 0, 0, 0}; }
+#endif
@@ -0,0 +1,119 @@
+#ifndef ESP32_TTS_CACHE_H
+#define ESP32_TTS_CACHE_H
+
+#include <Arduino.h>
+#include "audio_codec.h"
+#include "audio_io.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <FS.h>
+#else
+namespace fs { class FS; }
+#endif
+
+// Flash budget for cached answers: 512 KB is ~64 s of IMA-ADPCM speech, or
+// every FAQ answer several times over.
+#ifndef TTS_CACHE_MAX_BYTES
+#define TTS_CACHE_MAX_BYTES (512UL * 1024)
+#endif
+#ifndef TTS_CACHE_MAX_ENTRIES
+#define TTS_CACHE_MAX_ENTRIES 48
+#endif
+// Storage encoding; ADPCM fits four times as many answers as PCM.
+#ifndef TTS_CACHE_CODEC
+#define TTS_CACHE_CODEC AudioCodec::ImaAdpcm
+#endif
+#define TTS_CACHE_DIR "/tts"
+
+struct TTSCacheStats {
+  uint32_t entries;     // answers stored
+  uint32_t bytes;       // flash they occupy, headers included
+  uint32_t hits;        // open() found the answer
+  uint32_t misses;
+  uint32_t stores;      // answers added by commitStore()
+  uint32_t evictions;   // least recently used answers removed to make room
+  uint32_t storeErrors; // flash writes that failed; the answer was not kept
+};
+
+// Synthesized answers on SPIFFS / LittleFS, one file per answer, named by a
+// 64-bit hash of the text and voice settings. Files hold one frame after
+// another in the storage codec (IMA-ADPCM frames carry their own decoder
+// state); a small index file keeps the size and last use of every answer for
+// LRU eviction and survives reboots. Hits only update recency in RAM; the
+// index is written when answers are added or evicted, and by flush() / end(),
+// so a hit never writes flash. A reset loses at most the recency of hits
+// since the last write. A store goes to a temporary file that
+// only replaces the real one, and enters the index, once complete.
+// Not thread-safe: one reader or writer at a time (TTSClient's task).
+class TTSCache {
+public:
+  bool begin(fs::FS &fs, uint32_t maxBytes = TTS_CACHE_MAX_BYTES, AudioCodec codec = TTS_CACHE_CODEC);
+  void end();     // flush(), then let go of the file system
+  // Persist recency from hits since the last index write; call when idle.
+  bool flush();
+  // Drop every cached answer.
+  void clear();
+
+  static uint64_t key(const String &text, const String &voice);
+  bool contains(uint64_t key) const;
+
+  // Playback: open() marks the answer most recently used (in RAM); readFrame() decodes
+  // the next frame into out (count 0 at the end).
+  bool open(uint64_t key);
+  size_t readFrame(AudioBuffer &out);
+  void close();
+
+  // Recording: frames in playback order, then commitStore() (evicting as
+  // needed) or abortStore().
+  bool beginStore(uint64_t key);
+  bool storeFrame(const AudioBuffer &frame);
+  bool commitStore();
+  void abortStore();
+
+  TTSCacheStats stats() const;
+
+private:
+#ifdef ARDUINO_ARCH_ESP32
+  struct Entry {
+    uint64_t key;
+    uint32_t bytes;
+    uint32_t lastUse;
+  };
+
+  int find(uint64_t key) const;
+  void remove(int index);
+  bool makeRoom(uint8_t entries, uint32_t bytes);
+  bool loadIndex();
+  bool saveIndex();
+  void removeOrphans();
+  static String pathFor(uint64_t key, bool temporary = false);
+
+  fs::FS *m_fs = nullptr;
+  uint32_t m_maxBytes = 0;
+  AudioCodec m_codec = TTS_CACHE_CODEC;
+  Entry m_entries[TTS_CACHE_MAX_ENTRIES];
+  uint8_t m_count = 0;
+  uint32_t m_bytes = 0;
+  uint32_t m_clock = 0;          // LRU timestamp source, persisted with the index
+  bool m_indexDirty = false;     // recency changed since the index was written
+
+  File m_read;
+  AudioCodec m_readCodec = AudioCodec::Pcm16;
+  uint32_t m_readLeft = 0;       // samples
+
+  File m_write;
+  uint64_t m_writeKey = 0;
+  uint32_t m_writeSamples = 0;
+  uint32_t m_writeBytes = 0;
+  bool m_writeFailed = false;
+  AudioEncoder m_encoder;
+
+  uint32_t m_hits = 0;
+  uint32_t m_misses = 0;
+  uint32_t m_stores = 0;
+  uint32_t m_evictions = 0;
+  uint32_t m_storeErrors = 0;
+#endif
+};
+
+#endif // ESP32_TTS_CACHE_H
@@ -1,41 +1,140 @@
 #include "tts_client.h"
+#include "answer_bundle.h"
+#include "tts_cache.h"
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <WiFi.h>
 #include <HTTPClient.h>
 
+#define TTS_RESPONSE_TIMEOUT_MS 5000
+// Flash reads never stall like the network, so bundled and cached answers
+// start after one frame instead of the full jitter-buffer prefill.
+#define TTS_LOCAL_PREFILL_FRAMES 1
+
 bool TTSClient::begin(const String &endpointUrl) {
   m_endpoint = endpointUrl;
   return true;
 }
 
+void TTSClient::end() {
+  m_player.end();
+  if (m_cache) m_cache->flush();
+}
+
 bool TTSClient::requestAndPlay(const String &text, AudioIO &audio) {
+  if (!m_player.running() && !m_player.begin(audio)) return false;
+  uint64_t key = TTSCache::key(text, m_voice);
+  if (m_bundle && m_bundle->open(key)) {
+    bool ok = playLocal(*m_bundle);
+    record(m_metrics.bundled);
+    return ok;
+  }
+  if (m_cache && m_cache->open(key)) {
+    bool ok = playLocal(*m_cache);
+    record(m_metrics.hit);
+    return ok;
+  }
+  bool ok = playStream(text, key);
+  record(m_metrics.miss);
+  return ok;
+}
+
+void TTSClient::record(TTSLatency &latency) {
+  PlaybackStats st = m_player.stats();
+  if (!st.framesPlayed) return;
+  ++latency.count;
+  latency.lastMs = st.firstAudioMs;
+  latency.totalMs += st.firstAudioMs;
+  if (st.firstAudioMs > latency.maxMs) latency.maxMs = st.firstAudioMs;
+}
+
+// Source: AnswerBundle or TTSCache, already open().
+template <class Source> bool TTSClient::playLocal(Source &source) {
+  m_player.start(TTS_LOCAL_PREFILL_FRAMES);
+  bool ok = true;
+  for (;;) {
+    AudioBuffer *slot = m_player.acquire(TTS_RESPONSE_TIMEOUT_MS);
+    if (!slot) { ok = false; break; }
+    // Decoded straight into the ring slot.
+    if (!source.readFrame(*slot)) break;
+    m_player.submit();
+  }
+  source.close();
+  m_player.finish();
+  return m_player.wait(TTS_RESPONSE_TIMEOUT_MS) && ok;
+}
+
+bool TTSClient::playStream(const String &text, uint64_t key) {
+  // Started before the request so firstAudioMs includes the round trip.
+  m_player.start();
   HTTPClient http;
   http.begin(m_endpoint + "/tts");
   http.addHeader("Content-Type", "application/json");
-  String body = String("{\"text\":\"") + text + "\"}";
+  String body = String("{\"text\":\"") + text + "\",\"voice\":\"" + m_voice + "\"}";
   int rc = http.POST(body);
   if (rc != 200) {
     http.end();
     return false;
   }
-  // Expect raw PCM 16-bit 16kHz mono in response (this is a simplification)
-  WiFiClient * stream = http.getStreamPtr();
-  const size_t CHUNK = 512;
-  int16_t buf[CHUNK];
-  while (http.connected()) {
-    size_t avail = stream->available();
-    if (!avail) { delay(5); continue; }
-    size_t toRead = min(avail, CHUNK * sizeof(int16_t));
-    int readBytes = stream->readBytes((char*)buf, toRead);
-    if (readBytes <= 0) break;
-    audio.playSamples(buf, readBytes / sizeof(int16_t));
+  // Raw PCM 16-bit 16kHz mono, until Content-Length or the server closes.
+  WiFiClient *stream = http.getStreamPtr();
+  int remaining = http.getSize();
+  bool storing = m_cache && m_cache->beginStore(key);
+  const size_t FRAME_BYTES = AUDIO_FRAME_SAMPLES * sizeof(int16_t);
+  AudioBuffer *slot = nullptr;
+  size_t filled = 0;   // bytes already in *slot
+  bool ok = true;
+  unsigned long lastData = millis();
+  while (remaining != 0) {
+    if (!slot) {
+      // Waits only when the ring is full, i.e. we are well ahead of the speaker.
+      slot = m_player.acquire(TTS_RESPONSE_TIMEOUT_MS);
+      if (!slot) { ok = false; break; }
+      filled = 0;
+    }
+    int avail = stream->available();
+    if (avail <= 0) {
+      if (!http.connected()) break;
+      if (millis() - lastData >= TTS_RESPONSE_TIMEOUT_MS) { ok = false; break; }
+      delay(1);
+      continue;
+    }
+    // Read straight into the ring slot; the player hands it to I2S as is.
+    size_t want = min((size_t)avail, FRAME_BYTES - filled);
+    if (remaining > 0) want = min(want, (size_t)remaining);
+    int got = stream->read(reinterpret_cast<uint8_t *>(slot->samples) + filled, want);
+    if (got <= 0) break;
+    lastData = millis();
+    filled += (size_t)got;
+    if (remaining > 0) remaining -= got;
+    if (filled == FRAME_BYTES) {
+      slot->count = AUDIO_FRAME_SAMPLES;
+      // Encode for flash before the player owns the slot; the ring absorbs
+      // the occasional slow flash write.
+      if (storing) m_cache->storeFrame(*slot);
+      m_player.submit();
+      slot = nullptr;
+    }
   }
+  if (slot && filled >= sizeof(int16_t)) {
+    slot->count = filled / sizeof(int16_t);
+    if (storing) m_cache->storeFrame(*slot);
+    m_player.submit();
+  }
+  m_player.finish();
+  ok = m_player.wait(TTS_RESPONSE_TIMEOUT_MS + PLAYBACK_RING_FRAMES * AUDIO_FRAME_SAMPLES * 1000 / AUDIO_SAMPLE_RATE) && ok;
   http.end();
-  return true;
+  ok = ok && remaining <= 0;
+  // Only complete answers are kept.
+  if (storing) {
+    if (ok) m_cache->commitStore();
+    else m_cache->abortStore();
+  }
+  return ok;
 }
 
 #else
 bool TTSClient::begin(const String &) { return false; }
 bool TTSClient::requestAndPlay(const String &, AudioIO &) { return false; }
+void TTSClient::end() {}
 #endif
@@ -3,13 +3,62 @@
 
 #include <Arduino.h>
 #include "audio_io.h"
+#include "playback_pipeline.h"
+
+class AnswerBundle;
+class TTSCache;
+
+#ifndef TTS_VOICE
+#define TTS_VOICE "default"
+#endif
+
+// Request-to-speaker latency: from requestAndPlay() to the first sample
+// handed to I2S, over cache hits or misses.
+struct TTSLatency {
+  uint32_t count;
+  uint32_t lastMs;
+  uint32_t maxMs;
+  uint32_t totalMs;
+  uint32_t meanMs() const { return count ? totalMs / count : 0; }
+};
+
+struct TTSMetrics {
+  TTSLatency bundled;  // pre-rendered at build time, memory-mapped from flash
+  TTSLatency hit;      // played from the flash cache, no network
+  TTSLatency miss;     // synthesized by the server (and cached if possible)
+};
 
 class TTSClient {
 public:
   bool begin(const String &endpointUrl);
+  // POST {endpoint}/tts and play the streamed PCM as it arrives. The calling
+  // task reads the socket into the playback ring while a player task feeds
+  // I2S; returns once the last sample has been played. FAQ answers in the
+  // answer bundle play from its partition; with a cache, other known text
+  // plays from flash and new text is stored as it plays.
   bool requestAndPlay(const String &text, AudioIO &audio);
+  void end();   // stop the player task
+
+  void setBundle(AnswerBundle *bundle) { m_bundle = bundle; }   // nullptr: no pre-rendered answers
+  void setCache(TTSCache *cache) { m_cache = cache; }   // nullptr: always synthesize
+  // Voice requested from the server; part of the cache key.
+  void setVoice(const String &voice) { m_voice = voice; }
+
+  // Jitter buffer and underrun counters of the current / last response.
+  PlaybackStats playbackStats() const { return m_player.stats(); }
+  const TTSMetrics &metrics() const { return m_metrics; }
+
 private:
+  template <class Source> bool playLocal(Source &source);
+  bool playStream(const String &text, uint64_t key);
+  void record(TTSLatency &latency);
+
   String m_endpoint;
+  String m_voice = TTS_VOICE;
+  AnswerBundle *m_bundle = nullptr;
+  TTSCache *m_cache = nullptr;
+  PlaybackPipeline m_player;
+  TTSMetrics m_metrics = {};
 };
 
 #endif // ESP32_TTS_CLIENT_H
@@ -0,0 +1,60 @@
+#include "vad.h"
+
+void VoiceActivityDetector::reset() {
+  m_state = State::Silence;
+  m_count = 0;
+  m_silentFrames = 0;
+  m_speechFrames = 0;
+}
+
+VadEvent VoiceActivityDetector::update(float level) {
+  if (m_state == State::Done) return VadEvent::None;
+  if (m_floor < 0.f) m_floor = level;
+
+  float start = max(m_floor * m_cfg.startRatio, m_cfg.minLevel);
+  float stop = max(m_floor * m_cfg.stopRatio, m_cfg.minLevel);
+
+  switch (m_state) {
+    case State::Silence:
+    case State::Attack:
+      if (level > start) {
+        if (++m_count >= m_cfg.attackFrames) {
+          m_state = State::Speech;
+          m_speechFrames = m_count;
+          return VadEvent::SpeechStart;
+        }
+        m_state = State::Attack;
+        return VadEvent::None;
+      }
+      // Only background reaches the floor estimate.
+      m_floor += (level < m_floor ? m_cfg.floorFall : m_cfg.floorRise) * (level - m_floor);
+      m_state = State::Silence;
+      m_count = 0;
+      if (++m_silentFrames >= m_cfg.noSpeechFrames) {
+        m_state = State::Done;
+        return VadEvent::NoSpeech;
+      }
+      return VadEvent::None;
+
+    case State::Speech:
+    case State::Hangover:
+      if (++m_speechFrames >= m_cfg.maxSpeechFrames) {
+        m_state = State::Done;
+        return VadEvent::SpeechEnd;
+      }
+      if (level > stop) {
+        m_state = State::Speech;
+        m_count = 0;
+        return VadEvent::None;
+      }
+      m_state = State::Hangover;
+      if (++m_count >= m_cfg.hangoverFrames) {
+        m_state = State::Done;
+        return VadEvent::SpeechEnd;
+      }
+      return VadEvent::None;
+
+    default:
+      return VadEvent::None;
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef ESP32_VAD_H
+#define ESP32_VAD_H
+
+#include <Arduino.h>
+#include "audio_io.h"
+#include "config.h"
+
+#define VAD_FRAME_MS ((uint32_t)AUDIO_FRAME_SAMPLES * 1000 / AUDIO_SAMPLE_RATE)
+
+struct VadConfig {
+  float startRatio = VAD_START_RATIO;
+  float stopRatio = VAD_STOP_RATIO;
+  float minLevel = VAD_MIN_LEVEL;
+  uint16_t attackFrames = (VAD_ATTACK_MS + VAD_FRAME_MS - 1) / VAD_FRAME_MS;
+  uint16_t hangoverFrames = (VAD_HANGOVER_MS + VAD_FRAME_MS - 1) / VAD_FRAME_MS;
+  uint16_t noSpeechFrames = LISTEN_DURATION / VAD_FRAME_MS;
+  uint16_t maxSpeechFrames = VAD_MAX_UTTERANCE_MS / VAD_FRAME_MS;
+  // Per-frame noise floor smoothing: fast towards quieter backgrounds, slow
+  // (~3 s) towards louder ones so speech onsets do not drag it up.
+  float floorFall = 0.2f;
+  float floorRise = 0.01f;
+};
+
+enum class VadEvent : uint8_t {
+  None,
+  SpeechStart,  // attack window passed: this and the attack frames are speech
+  SpeechEnd,    // hangover expired or the utterance hit maxSpeechFrames
+  NoSpeech,     // noSpeechFrames of silence without any speech
+};
+
+// Energy VAD over per-frame RMS (AudioIO::rms). The noise floor follows the
+// background while nobody speaks; speech needs attackFrames above
+// floor * startRatio and ends after hangoverFrames below floor * stopRatio.
+// One update() per captured frame; not thread-safe.
+class VoiceActivityDetector {
+public:
+  explicit VoiceActivityDetector(const VadConfig &config = VadConfig()) : m_cfg(config) {}
+
+  void setConfig(const VadConfig &config) { m_cfg = config; }
+  const VadConfig &config() const { return m_cfg; }
+
+  // Start a new utterance. The noise floor is kept across utterances.
+  void reset();
+  VadEvent update(float level);
+
+  // The last frame passed to update() belongs to (possible) speech and should
+  // be sent; false for silence and after the utterance ended.
+  bool voiced() const { return m_state != State::Silence && m_state != State::Done; }
+  bool inSpeech() const { return m_state == State::Speech || m_state == State::Hangover; }
+  bool done() const { return m_state == State::Done; }
+  float noiseFloor() const { return m_floor; }
+
+private:
+  enum class State : uint8_t { Silence, Attack, Speech, Hangover, Done };
+
+  VadConfig m_cfg;
+  State m_state = State::Silence;
+  float m_floor = -1.f;        // < 0 until the first frame
+  uint16_t m_count = 0;        // frames in the current attack / hangover
+  uint16_t m_silentFrames = 0; // before any speech
+  uint16_t m_speechFrames = 0;
+};
+
+#endif // ESP32_VAD_H
@@ -0,0 +1,553 @@
+// Arduino.cpp - Host implementation of the Arduino core shim
+#include "Arduino.h"
+#include "Esp.h"
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <poll.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// String
+// ---------------------------------------------------------------------------
+static std::string formatInteger(unsigned long v, unsigned char base, bool negative) {
+  if (base < 2) base = 10;
+  char buf[8 * sizeof(long) + 2];
+  char *p = buf + sizeof(buf);
+  *--p = '\0';
+  do {
+    unsigned long d = v % base;
+    *--p = (char)(d < 10 ? '0' + d : 'A' + d - 10);
+    v /= base;
+  } while (v);
+  if (negative) *--p = '-';
+  return p;
+}
+
+static std::string formatFloat(double v, unsigned char digits) {
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "%.*f", (int)digits, v);
+  return buf;
+}
+
+namespace {
+std::atomic<uint64_t> g_stringAllocs{0};
+std::atomic<uint64_t> g_stringBytes{0};
+} // namespace
+
+bool String::changeBuffer(unsigned int cap) {
+  char *p = static_cast<char *>(std::realloc(m_buf, cap + 1));
+  if (!p) return false;
+  g_stringAllocs.fetch_add(1, std::memory_order_relaxed);
+  g_stringBytes.fetch_add(cap + 1, std::memory_order_relaxed);
+  m_buf = p;
+  m_cap = cap;
+  return true;
+}
+
+bool String::reserve(unsigned int size) {
+  if (m_buf && m_cap >= size) return true;
+  if (!changeBuffer(size)) return false;
+  if (m_len == 0) m_buf[0] = '\0';
+  return true;
+}
+
+void String::copy(const char *s, unsigned int len) {
+  if (!reserve(len)) {
+    std::free(m_buf);
+    m_buf = nullptr;
+    m_cap = m_len = 0;
+    return;
+  }
+  m_len = len;
+  if (len) std::memmove(m_buf, s, len);
+  m_buf[len] = '\0';
+}
+
+String &String::operator=(String &&s) noexcept {
+  if (this != &s) {
+    std::free(m_buf);
+    m_buf = s.m_buf;
+    m_cap = s.m_cap;
+    m_len = s.m_len;
+    s.m_buf = nullptr;
+    s.m_cap = s.m_len = 0;
+  }
+  return *this;
+}
+
+char &String::operator[](unsigned int i) {
+  static char dummy;
+  if (i >= m_len) {
+    dummy = 0;
+    return dummy;
+  }
+  return m_buf[i];
+}
+
+bool String::concat(const char *s, unsigned int len) {
+  if (!s) return false;
+  if (len == 0) return true;
+  unsigned int newLen = m_len + len;
+  if (!reserve(newLen)) return false;
+  std::memmove(m_buf + m_len, s, len);
+  m_len = newLen;
+  m_buf[m_len] = '\0';
+  return true;
+}
+
+String::String(int v, unsigned char base)
+    : String((long)v, base) {}
+String::String(unsigned int v, unsigned char base)
+    : String((unsigned long)v, base) {}
+String::String(long v, unsigned char base) {
+  std::string s = base == DEC && v < 0 ? formatInteger(0UL - (unsigned long)v, base, true)
+                                       : formatInteger((unsigned long)v, base, false);
+  copy(s.data(), (unsigned int)s.size());
+}
+String::String(unsigned long v, unsigned char base) {
+  std::string s = formatInteger(v, base, false);
+  copy(s.data(), (unsigned int)s.size());
+}
+String::String(float v, unsigned char decimals)
+    : String((double)v, decimals) {}
+String::String(double v, unsigned char decimals) {
+  std::string s = formatFloat(v, decimals);
+  copy(s.data(), (unsigned int)s.size());
+}
+
+bool String::equalsIgnoreCase(const String &s) const {
+  if (m_len != s.m_len) return false;
+  for (unsigned int i = 0; i < m_len; ++i) {
+    if (std::tolower((unsigned char)m_buf[i]) != std::tolower((unsigned char)s.m_buf[i])) return false;
+  }
+  return true;
+}
+
+bool String::startsWith(const String &prefix) const {
+  return prefix.m_len <= m_len && std::memcmp(c_str(), prefix.c_str(), prefix.m_len) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+  return suffix.m_len <= m_len && std::memcmp(c_str() + m_len - suffix.m_len, suffix.c_str(), suffix.m_len) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  if (from >= m_len) return -1;
+  const char *p = static_cast<const char *>(std::memchr(m_buf + from, c, m_len - from));
+  return p ? (int)(p - m_buf) : -1;
+}
+
+int String::indexOf(const char *s, unsigned int from) const {
+  if (!s || from >= m_len) return -1;
+  const char *p = std::strstr(m_buf + from, s);
+  return p ? (int)(p - m_buf) : -1;
+}
+
+int String::lastIndexOf(char c) const {
+  const char *p = m_len ? std::strrchr(m_buf, c) : nullptr;
+  return p ? (int)(p - m_buf) : -1;
+}
+
+int String::lastIndexOf(const String &s) const {
+  if (s.m_len > m_len) return -1;
+  for (int i = (int)(m_len - s.m_len); i >= 0; --i) {
+    if (std::memcmp(m_buf + i, s.c_str(), s.m_len) == 0) return i;
+  }
+  return -1;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= m_len) return String();
+  to = std::min(to, m_len);
+  return String(m_buf + from, to - from);
+}
+
+void String::toLowerCase() {
+  for (unsigned int i = 0; i < m_len; ++i) m_buf[i] = (char)std::tolower((unsigned char)m_buf[i]);
+}
+
+void String::toUpperCase() {
+  for (unsigned int i = 0; i < m_len; ++i) m_buf[i] = (char)std::toupper((unsigned char)m_buf[i]);
+}
+
+void String::trim() {
+  if (!m_len) return;
+  unsigned int b = 0, e = m_len;
+  while (b < e && std::isspace((unsigned char)m_buf[b])) ++b;
+  while (e > b && std::isspace((unsigned char)m_buf[e - 1])) --e;
+  m_len = e - b;
+  if (b) std::memmove(m_buf, m_buf + b, m_len);
+  m_buf[m_len] = '\0';
+}
+
+void String::replace(const String &find, const String &with) {
+  if (find.m_len == 0 || m_len == 0) return;
+  std::string s(m_buf, m_len);
+  size_t pos = 0;
+  while ((pos = s.find(find.c_str(), pos, find.m_len)) != std::string::npos) {
+    s.replace(pos, find.m_len, with.c_str(), with.m_len);
+    pos += with.m_len;
+  }
+  copy(s.data(), (unsigned int)s.size());
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index >= m_len) return;
+  count = std::min(count, m_len - index);
+  std::memmove(m_buf + index, m_buf + index + count, m_len - index - count);
+  m_len -= count;
+  m_buf[m_len] = '\0';
+}
+
+void String::toCharArray(char *buf, unsigned int size, unsigned int index) const {
+  if (!buf || size == 0) return;
+  unsigned int n = index < m_len ? std::min(size - 1, m_len - index) : 0;
+  if (n) std::memcpy(buf, m_buf + index, n);
+  buf[n] = '\0';
+}
+
+String operator+(const String &a, const String &b) { String r(a); r.concat(b); return r; }
+String operator+(const String &a, const char *b) { String r(a); r.concat(b); return r; }
+String operator+(const char *a, const String &b) { String r(a); r.concat(b); return r; }
+String operator+(const String &a, char b) { String r(a); r.concat(b); return r; }
+
+// ---------------------------------------------------------------------------
+// Print / Stream
+// ---------------------------------------------------------------------------
+size_t Print::write(const uint8_t *buf, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buf++);
+  return n;
+}
+
+// Numeric printing formats on the stack so it does not show up as String heap traffic.
+size_t Print::print(long v, int base) {
+  std::string s = base == DEC && v < 0 ? formatInteger(0UL - (unsigned long)v, (unsigned char)base, true)
+                                       : formatInteger((unsigned long)v, (unsigned char)base, false);
+  return write(s.data(), s.size());
+}
+
+size_t Print::print(unsigned long v, int base) {
+  std::string s = formatInteger(v, (unsigned char)base, false);
+  return write(s.data(), s.size());
+}
+
+size_t Print::print(double v, int digits) {
+  std::string s = formatFloat(v, (unsigned char)digits);
+  return write(s.data(), s.size());
+}
+
+size_t Print::printf(const char *fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = std::vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  return write(buf, std::min<size_t>((size_t)n, sizeof(buf) - 1));
+}
+
+int Stream::timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+    if (this == &Serial && host::serialInputClosed()) return -1;
+    yield();
+  } while (millis() - start < m_timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char *buf, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    buf[n++] = (char)c;
+  }
+  return n;
+}
+
+String Stream::readString() {
+  String out;
+  int c;
+  while ((c = timedRead()) >= 0) out += (char)c;
+  return out;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String out;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator) out += (char)c;
+  return out;
+}
+
+// ---------------------------------------------------------------------------
+// Serial (stdin / stdout)
+// ---------------------------------------------------------------------------
+HardwareSerial Serial;
+
+namespace {
+
+std::string g_rx;
+size_t g_rxPos = 0;
+bool g_stdinEof = false;
+bool g_stdinDetached = false;   // input comes from serialFeed()
+bool g_outputEnabled = true;
+bool g_realtimeDelays = true;
+
+void compactRx() {
+  if (g_rxPos == g_rx.size()) {
+    g_rx.clear();
+    g_rxPos = 0;
+  }
+}
+
+void pumpStdin() {
+  if (g_stdinEof || g_stdinDetached) return;
+  struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+  if (poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLIN | POLLHUP))) {
+    char buf[4096];
+    ssize_t n = ::read(STDIN_FILENO, buf, sizeof(buf));
+    if (n <= 0) {
+      g_stdinEof = true;
+      return;
+    }
+    compactRx();
+    g_rx.append(buf, (size_t)n);
+  }
+}
+
+} // namespace
+
+int HardwareSerial::available() {
+  pumpStdin();
+  return (int)(g_rx.size() - g_rxPos);
+}
+
+int HardwareSerial::read() {
+  if (!available()) return -1;
+  return (unsigned char)g_rx[g_rxPos++];
+}
+
+int HardwareSerial::peek() {
+  if (!available()) return -1;
+  return (unsigned char)g_rx[g_rxPos];
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (g_outputEnabled) std::fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t size) {
+  if (g_outputEnabled) std::fwrite(buf, 1, size, stdout);
+  return size;
+}
+
+void HardwareSerial::flush() {
+  std::fflush(stdout);
+}
+
+// ---------------------------------------------------------------------------
+// GPIO, timing, interrupts
+// ---------------------------------------------------------------------------
+namespace {
+
+struct PinState {
+  uint8_t mode = INPUT;
+  int level = LOW;
+  void (*isr)() = nullptr;
+  int isrMode = 0;
+  bool pending = false;
+};
+
+PinState g_pins[HOST_NUM_PINS];
+std::mutex g_pinMutex;
+std::atomic<int> g_irqDisabled{0};
+
+const auto g_epoch = std::chrono::steady_clock::now();
+
+bool edgeMatches(int mode, int from, int to) {
+  if (from == to) return false;
+  if (mode == CHANGE) return true;
+  if (mode == FALLING) return to == LOW;
+  if (mode == RISING) return to == HIGH;
+  return false;
+}
+
+} // namespace
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_NUM_PINS) return;
+  std::lock_guard<std::mutex> lock(g_pinMutex);
+  g_pins[pin].mode = mode;
+  if (mode == INPUT_PULLUP) g_pins[pin].level = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin >= HOST_NUM_PINS) return;
+  std::lock_guard<std::mutex> lock(g_pinMutex);
+  g_pins[pin].level = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= HOST_NUM_PINS) return LOW;
+  std::lock_guard<std::mutex> lock(g_pinMutex);
+  return g_pins[pin].level;
+}
+
+int analogRead(uint8_t pin) {
+  (void)pin;
+  return 512;
+}
+
+unsigned long millis() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - g_epoch).count();
+}
+
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - g_epoch).count();
+}
+
+void delay(unsigned long ms) {
+  if (g_realtimeDelays) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (g_realtimeDelays) std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount() {
+#if defined(__x86_64__) || defined(__i386__)
+  return (uint32_t)__rdtsc();
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+uint32_t EspClass::getCpuFreqMHz() {
+#if defined(__x86_64__) || defined(__i386__)
+  // Calibrate the TSC against the steady clock once.
+  static const uint32_t mhz = [] {
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = __rdtsc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    uint64_t c1 = __rdtsc();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    return (uint32_t)((double)(c1 - c0) / us + 0.5);
+  }();
+  return mhz;
+#else
+  return 1000;
+#endif
+}
+
+uint32_t esp_random() {
+  thread_local std::mt19937 rng{std::random_device{}()};
+  return (uint32_t)rng();
+}
+
+void attachInterrupt(int interruptNum, void (*isr)(), int mode) {
+  if (interruptNum < 0 || interruptNum >= HOST_NUM_PINS) return;
+  std::lock_guard<std::mutex> lock(g_pinMutex);
+  g_pins[interruptNum].isr = isr;
+  g_pins[interruptNum].isrMode = mode;
+}
+
+void detachInterrupt(int interruptNum) {
+  if (interruptNum < 0 || interruptNum >= HOST_NUM_PINS) return;
+  std::lock_guard<std::mutex> lock(g_pinMutex);
+  g_pins[interruptNum].isr = nullptr;
+}
+
+void noInterrupts() {
+  g_irqDisabled.fetch_add(1);
+}
+
+void interrupts() {
+  if (g_irqDisabled.load() > 0 && g_irqDisabled.fetch_sub(1) == 1) {
+    // Deliver edges that arrived while masked, as the hardware would.
+    for (int pin = 0; pin < HOST_NUM_PINS; ++pin) {
+      void (*isr)() = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(g_pinMutex);
+        if (g_pins[pin].pending && g_pins[pin].isr) isr = g_pins[pin].isr;
+        g_pins[pin].pending = false;
+      }
+      if (isr) isr();
+    }
+  }
+}
+
+namespace host {
+
+void setPinLevel(uint8_t pin, int level) {
+  if (pin >= HOST_NUM_PINS) return;
+  void (*isr)() = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(g_pinMutex);
+    PinState &p = g_pins[pin];
+    level = level ? HIGH : LOW;
+    if (p.isr && edgeMatches(p.isrMode, p.level, level)) {
+      if (g_irqDisabled.load() > 0) {
+        p.pending = true;
+      } else {
+        isr = p.isr;
+      }
+    }
+    p.level = level;
+  }
+  if (isr) isr();
+}
+
+int pinLevel(uint8_t pin) {
+  return digitalRead(pin);
+}
+
+bool serialInputClosed() {
+  pumpStdin();
+  return g_stdinEof && g_rxPos == g_rx.size();
+}
+
+void serialFeed(const char *data, size_t len) {
+  g_stdinDetached = true;
+  compactRx();
+  g_rx.append(data, len);
+}
+
+void setSerialOutputEnabled(bool enabled) {
+  g_outputEnabled = enabled;
+}
+
+void setRealtimeDelays(bool enabled) {
+  g_realtimeDelays = enabled;
+}
+
+StringHeapStats stringHeapStats() {
+  return {g_stringAllocs.load(), g_stringBytes.load()};
+}
+
+} // namespace host
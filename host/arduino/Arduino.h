@@ -0,0 +1,284 @@
+// Arduino.h - Host (Linux) shim of the Arduino core API
+//
+// Lets the sketch sources in code/ and esp32/ compile and run natively so the
+// classifier and audio paths can be profiled, fuzzed and load-tested off
+// device. Only the subset of the core actually used by this project is
+// provided; behaviour follows the AVR / ESP32 cores where it matters
+// (Stream timeouts, Print formatting, String semantics).
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include "freertos/FreeRTOS.h"
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+
+#define HOST_NUM_PINS 40
+
+// Flash storage is ordinary memory on the host.
+#define PROGMEM
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_float(addr) (*reinterpret_cast<const float *>(addr))
+#define pgm_read_ptr(addr)   (*reinterpret_cast<const void * const *>(addr))
+#define strlen_P  strlen
+#define strcmp_P  strcmp
+#define strncmp_P strncmp
+#define memcpy_P  memcpy
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+
+using std::min;
+using std::max;
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+// ---------------------------------------------------------------------------
+// String
+// ---------------------------------------------------------------------------
+class String {
+ public:
+  String(const char *s = "") { copy(s, s ? std::strlen(s) : 0); }
+  String(const __FlashStringHelper *s) : String(reinterpret_cast<const char *>(s)) {}
+  String(const String &s) { copy(s.m_buf, s.m_len); }
+  String(String &&s) noexcept : m_buf(s.m_buf), m_cap(s.m_cap), m_len(s.m_len) { s.m_buf = nullptr; s.m_cap = s.m_len = 0; }
+  String(const char *s, unsigned int len) { copy(s, len); }
+  explicit String(char c) { copy(&c, 1); }
+  explicit String(int v, unsigned char base = DEC);
+  explicit String(unsigned int v, unsigned char base = DEC);
+  explicit String(long v, unsigned char base = DEC);
+  explicit String(unsigned long v, unsigned char base = DEC);
+  explicit String(float v, unsigned char decimals = 2);
+  explicit String(double v, unsigned char decimals = 2);
+  ~String() { std::free(m_buf); }
+
+  String &operator=(const String &s) { if (this != &s) copy(s.m_buf, s.m_len); return *this; }
+  String &operator=(String &&s) noexcept;
+  String &operator=(const char *s) { copy(s, s ? std::strlen(s) : 0); return *this; }
+  String &operator=(const __FlashStringHelper *s) { return *this = reinterpret_cast<const char *>(s); }
+
+  unsigned int length() const { return m_len; }
+  bool isEmpty() const { return m_len == 0; }
+  const char *c_str() const { return m_buf ? m_buf : ""; }
+  bool reserve(unsigned int size);
+
+  char charAt(unsigned int i) const { return i < m_len ? m_buf[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i);
+  void setCharAt(unsigned int i, char c) { if (i < m_len) m_buf[i] = c; }
+
+  bool concat(const String &s) { return concat(s.c_str(), s.m_len); }
+  bool concat(const char *s) { return s && concat(s, (unsigned int)std::strlen(s)); }
+  bool concat(const char *s, unsigned int len);
+  bool concat(char c) { return concat(&c, 1); }
+  String &operator+=(const String &s) { concat(s); return *this; }
+  String &operator+=(const char *s) { concat(s); return *this; }
+  String &operator+=(char c) { concat(c); return *this; }
+
+  bool equals(const String &s) const { return m_len == s.m_len && std::memcmp(c_str(), s.c_str(), m_len) == 0; }
+  bool equals(const char *s) const { return s && std::strcmp(c_str(), s) == 0; }
+  bool equalsIgnoreCase(const String &s) const;
+  bool operator==(const String &s) const { return equals(s); }
+  bool operator==(const char *s) const { return equals(s); }
+  bool operator!=(const String &s) const { return !equals(s); }
+  bool operator!=(const char *s) const { return !equals(s); }
+  bool operator<(const String &s) const { return std::strcmp(c_str(), s.c_str()) < 0; }
+  bool startsWith(const String &prefix) const;
+  bool endsWith(const String &suffix) const;
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char *s, unsigned int from = 0) const;
+  int indexOf(const String &s, unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+  int lastIndexOf(char c) const;
+  int lastIndexOf(const String &s) const;
+  String substring(unsigned int from) const { return substring(from, length()); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+  void replace(const String &find, const String &with);
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+  long toInt() const { return std::strtol(c_str(), nullptr, 10); }
+  float toFloat() const { return std::strtof(c_str(), nullptr); }
+  void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const;
+
+ private:
+  // Heap behaviour mirrors the AVR core's WString: every String owns a
+  // malloc'd buffer (no small-string optimisation), grown with realloc.
+  bool changeBuffer(unsigned int cap);
+  void copy(const char *s, unsigned int len);
+
+  char *m_buf = nullptr;
+  unsigned int m_cap = 0;
+  unsigned int m_len = 0;
+};
+
+String operator+(const String &a, const String &b);
+String operator+(const String &a, const char *b);
+String operator+(const char *a, const String &b);
+String operator+(const String &a, char b);
+
+// ---------------------------------------------------------------------------
+// Print / Stream
+// ---------------------------------------------------------------------------
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t size);
+  size_t write(const char *s) { return s ? write(reinterpret_cast<const uint8_t *>(s), std::strlen(s)) : 0; }
+  size_t write(const char *buf, size_t size) { return write(reinterpret_cast<const uint8_t *>(buf), size); }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+  size_t print(const String &s) { return write(s.c_str(), s.length()); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = DEC);
+  size_t print(unsigned long v, int base = DEC);
+  size_t print(long long v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned long long v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(double v, int digits = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T &v) { size_t n = print(v); return n + println(); }
+  template <typename T>
+  size_t println(const T &v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long ms) { m_timeout = ms; }
+  unsigned long getTimeout() const { return m_timeout; }
+
+  size_t readBytes(char *buf, size_t length);
+  size_t readBytes(uint8_t *buf, size_t length) { return readBytes(reinterpret_cast<char *>(buf), length); }
+  String readString();
+  String readStringUntil(char terminator);
+
+ protected:
+  int timedRead();
+  unsigned long m_timeout = 1000;
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  explicit operator bool() const { return true; }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  void flush() override;
+};
+
+extern HardwareSerial Serial;
+
+// ---------------------------------------------------------------------------
+// GPIO, timing, interrupts
+// ---------------------------------------------------------------------------
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+#define digitalPinToInterrupt(p) ((int)(p))
+void attachInterrupt(int interruptNum, void (*isr)(), int mode);
+void detachInterrupt(int interruptNum);
+void noInterrupts();
+void interrupts();
+
+#ifdef ARDUINO_ARCH_ESP32
+// Hardware RNG (esp_system.h in the ESP32 core).
+uint32_t esp_random();
+#include "Esp.h"
+#endif
+
+// ---------------------------------------------------------------------------
+// Host-only hooks used by drivers, benchmarks and tests
+// ---------------------------------------------------------------------------
+namespace host {
+
+// Drive an input pin as if by external hardware (fires attached interrupts).
+void setPinLevel(uint8_t pin, int level);
+// Last level written to (or driven onto) a pin.
+int pinLevel(uint8_t pin);
+// True once stdin has reached EOF and every buffered byte was consumed.
+bool serialInputClosed();
+// Queue bytes as if they had arrived on Serial (replay tools). From the
+// first call on, stdin is no longer read.
+void serialFeed(const char *data, size_t len);
+// Silence Serial output (benchmarks); input is unaffected.
+void setSerialOutputEnabled(bool enabled);
+// When false, delay() returns immediately instead of sleeping.
+void setRealtimeDelays(bool enabled);
+
+// Heap traffic generated by String since start-up.
+struct StringHeapStats {
+  uint64_t allocations; // malloc + growing realloc calls
+  uint64_t bytes;       // bytes requested by those calls
+};
+StringHeapStats stringHeapStats();
+
+} // namespace host
+
+#endif // HOST_ARDUINO_H
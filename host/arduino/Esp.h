@@ -0,0 +1,17 @@
+// Esp.h - Host shim of the ESP32 core's EspClass (ESP.getCycleCount() etc.)
+#ifndef HOST_ESP_H
+#define HOST_ESP_H
+
+#include <cstdint>
+
+class EspClass {
+ public:
+  // CCOUNT on the ESP32. On the host: the x86 TSC, otherwise nanoseconds
+  // (a nominal 1 GHz clock), so cycle counts stay comparable in magnitude.
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz();
+};
+
+extern EspClass ESP;
+
+#endif // HOST_ESP_H
@@ -0,0 +1,226 @@
+// FS.cpp - Host implementation of the fs::FS / LittleFS shim
+#include "FS.h"
+#include "LittleFS.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace stdfs = std::filesystem;
+
+fs::LittleFSFS LittleFS;
+
+namespace {
+
+std::string g_root;
+size_t g_capacity = 0x180000;
+
+} // namespace
+
+namespace fs {
+
+struct File::Impl {
+  std::FILE *fp = nullptr;
+  std::string path;        // inside the file system, starts with '/'
+  std::string name;
+  std::string hostPath;
+  bool directory = false;
+  std::vector<std::string> entries;   // directory listing, for openNextFile()
+  size_t next = 0;
+  const FS *fs = nullptr;
+
+  ~Impl() {
+    if (fp) std::fclose(fp);
+  }
+};
+
+int File::available() {
+  if (!m_impl || !m_impl->fp) return 0;
+  long left = (long)size() - (long)position();
+  return left > 0 ? (int)left : 0;
+}
+
+int File::read() {
+  if (!m_impl || !m_impl->fp) return -1;
+  return std::fgetc(m_impl->fp);
+}
+
+size_t File::read(uint8_t *buf, size_t size) {
+  if (!m_impl || !m_impl->fp) return 0;
+  return std::fread(buf, 1, size, m_impl->fp);
+}
+
+int File::peek() {
+  if (!m_impl || !m_impl->fp) return -1;
+  int c = std::fgetc(m_impl->fp);
+  if (c != EOF) std::ungetc(c, m_impl->fp);
+  return c;
+}
+
+size_t File::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buf, size_t size) {
+  if (!m_impl || !m_impl->fp) return 0;
+  return std::fwrite(buf, 1, size, m_impl->fp);
+}
+
+void File::flush() {
+  if (m_impl && m_impl->fp) std::fflush(m_impl->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!m_impl || !m_impl->fp) return false;
+  int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+  return std::fseek(m_impl->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+  if (!m_impl || !m_impl->fp) return 0;
+  long pos = std::ftell(m_impl->fp);
+  return pos > 0 ? (size_t)pos : 0;
+}
+
+size_t File::size() const {
+  if (!m_impl || !m_impl->fp) return 0;
+  std::fflush(m_impl->fp);
+  std::error_code ec;
+  uintmax_t n = stdfs::file_size(m_impl->hostPath, ec);
+  return ec ? 0 : (size_t)n;
+}
+
+void File::close() {
+  m_impl.reset();
+}
+
+const char *File::name() const {
+  return m_impl ? m_impl->name.c_str() : nullptr;
+}
+
+const char *File::path() const {
+  return m_impl ? m_impl->path.c_str() : nullptr;
+}
+
+bool File::isDirectory() const {
+  return m_impl && m_impl->directory;
+}
+
+File File::openNextFile(const char *mode) {
+  if (!m_impl || !m_impl->directory || m_impl->next >= m_impl->entries.size()) return File();
+  std::string child = m_impl->path == "/" ? "/" + m_impl->entries[m_impl->next] : m_impl->path + "/" + m_impl->entries[m_impl->next];
+  ++m_impl->next;
+  return const_cast<FS *>(m_impl->fs)->open(child.c_str(), mode);
+}
+
+std::string FS::hostPath(const char *path) const {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return m_root + p;
+}
+
+File FS::open(const char *path, const char *mode, bool create) {
+  File f;
+  if (!m_mounted || !path) return f;
+  std::string host = hostPath(path);
+  std::error_code ec;
+  auto impl = std::make_shared<File::Impl>();
+  impl->path = path[0] == '/' ? path : std::string("/") + path;
+  impl->name = stdfs::path(impl->path).filename().string();
+  if (impl->name.empty()) impl->name = "/";
+  impl->hostPath = host;
+  impl->fs = this;
+  if (stdfs::is_directory(host, ec)) {
+    impl->directory = true;
+    for (const auto &entry : stdfs::directory_iterator(host, ec)) impl->entries.push_back(entry.path().filename().string());
+    f.m_impl = impl;
+    return f;
+  }
+  bool writing = mode && (mode[0] == 'w' || mode[0] == 'a');
+  if (writing && create) stdfs::create_directories(stdfs::path(host).parent_path(), ec);
+  if (!writing && !stdfs::exists(host, ec)) return f;
+  std::string m = mode ? mode : "r";
+  if (m.find('b') == std::string::npos) m += 'b';
+  impl->fp = std::fopen(host.c_str(), m.c_str());
+  if (!impl->fp) return f;
+  f.m_impl = impl;
+  return f;
+}
+
+bool FS::exists(const char *path) {
+  std::error_code ec;
+  return m_mounted && path && stdfs::exists(hostPath(path), ec);
+}
+
+bool FS::remove(const char *path) {
+  std::error_code ec;
+  return m_mounted && path && !stdfs::is_directory(hostPath(path), ec) && stdfs::remove(hostPath(path), ec);
+}
+
+bool FS::rename(const char *from, const char *to) {
+  if (!m_mounted || !from || !to) return false;
+  std::error_code ec;
+  stdfs::rename(hostPath(from), hostPath(to), ec);
+  return !ec;
+}
+
+bool FS::mkdir(const char *path) {
+  if (!m_mounted || !path) return false;
+  std::error_code ec;
+  stdfs::create_directory(hostPath(path), ec);
+  return !ec && stdfs::is_directory(hostPath(path), ec);
+}
+
+bool FS::rmdir(const char *path) {
+  std::error_code ec;
+  return m_mounted && path && stdfs::is_directory(hostPath(path), ec) && stdfs::remove(hostPath(path), ec);
+}
+
+} // namespace fs
+
+bool fs::LittleFSFS::begin(bool, const char *, uint8_t, const char *) {
+  if (g_root.empty()) {
+    const char *env = std::getenv("HOST_LITTLEFS_DIR");
+    g_root = env && *env ? env : "littlefs";
+  }
+  std::error_code ec;
+  stdfs::create_directories(g_root, ec);
+  m_root = g_root;
+  m_mounted = stdfs::is_directory(m_root, ec);
+  return m_mounted;
+}
+
+bool fs::LittleFSFS::format() {
+  if (!m_mounted) return false;
+  std::error_code ec;
+  for (const auto &entry : stdfs::directory_iterator(m_root, ec)) stdfs::remove_all(entry.path(), ec);
+  return !ec;
+}
+
+size_t fs::LittleFSFS::totalBytes() {
+  return g_capacity;
+}
+
+size_t fs::LittleFSFS::usedBytes() {
+  if (!m_mounted) return 0;
+  size_t used = 0;
+  std::error_code ec;
+  for (const auto &entry : stdfs::recursive_directory_iterator(m_root, ec)) {
+    if (entry.is_regular_file(ec)) used += (size_t)entry.file_size(ec);
+  }
+  return used;
+}
+
+namespace host {
+
+void littleFsSetRoot(const char *dir) {
+  g_root = dir ? dir : "";
+}
+
+void littleFsSetCapacity(size_t bytes) {
+  g_capacity = bytes;
+}
+
+} // namespace host
@@ -0,0 +1,75 @@
+// FS.h - Host shim of the ESP32 fs::FS / fs::File API over a host directory
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <memory>
+#include <string>
+
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+ public:
+  File() = default;
+
+  int available() override;
+  int read() override;
+  size_t read(uint8_t *buf, size_t size);
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  void flush() override;
+
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  explicit operator bool() const { return m_impl != nullptr; }
+
+  const char *name() const;   // last path component, as on the device
+  const char *path() const;   // absolute path inside the file system
+  bool isDirectory() const;
+  File openNextFile(const char *mode = "r");
+
+ private:
+  friend class FS;
+  struct Impl;
+  std::shared_ptr<Impl> m_impl;   // copies share the handle, as on ESP32
+};
+
+class FS {
+ public:
+  File open(const char *path, const char *mode = "r", bool create = false);
+  File open(const String &path, const char *mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool rmdir(const char *path);
+  bool rmdir(const String &path) { return rmdir(path.c_str()); }
+
+ protected:
+  std::string hostPath(const char *path) const;
+
+  std::string m_root;
+  bool m_mounted = false;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
+
+#endif // HOST_FS_H
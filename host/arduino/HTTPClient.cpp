@@ -0,0 +1,109 @@
+// HTTPClient.cpp - Host implementation of the HTTPClient shim
+#include "HTTPClient.h"
+
+#include <cstdlib>
+
+bool HTTPClient::begin(const String &url) {
+  // Only http://host[:port]/path is supported; TLS is out of scope on the host.
+  String rest = url;
+  if (rest.startsWith("http://")) rest = rest.substring(7);
+  else if (rest.indexOf("://") >= 0) return false;
+  int slash = rest.indexOf('/');
+  String authority = slash >= 0 ? rest.substring(0, slash) : rest;
+  m_path = slash >= 0 ? rest.substring(slash) : String("/");
+  int colon = authority.indexOf(':');
+  if (colon >= 0) {
+    m_host = authority.substring(0, colon);
+    m_port = (uint16_t)authority.substring(colon + 1).toInt();
+  } else {
+    m_host = authority;
+    m_port = 80;
+  }
+  m_headers.clear();
+  m_contentLength = -1;
+  return m_host.length() > 0;
+}
+
+bool HTTPClient::begin(WiFiClient &client, const String &url) {
+  m_client = client;
+  return begin(url);
+}
+
+void HTTPClient::end() {
+  if (!m_reuse) m_client.stop();
+  m_headers.clear();
+}
+
+void HTTPClient::addHeader(const String &name, const String &value) {
+  m_headers.emplace_back(name, value);
+}
+
+int HTTPClient::GET() {
+  return sendRequest("GET", nullptr, 0);
+}
+
+int HTTPClient::POST(const uint8_t *payload, size_t size) {
+  return sendRequest("POST", payload, size);
+}
+
+int HTTPClient::POST(const String &payload) {
+  return sendRequest("POST", reinterpret_cast<const uint8_t *>(payload.c_str()), payload.length());
+}
+
+int HTTPClient::sendRequest(const char *method, const uint8_t *payload, size_t size) {
+  if (!m_client.connected() && !m_client.connect(m_host.c_str(), m_port, m_timeoutMs)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  m_client.setTimeout(m_timeoutMs);
+
+  String head = String(method) + " " + m_path + " HTTP/1.1\r\n";
+  head += "Host: " + m_host + "\r\n";
+  head += m_reuse ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+  for (auto &h : m_headers) head += h.first + ": " + h.second + "\r\n";
+  if (payload || strcmp(method, "POST") == 0) head += "Content-Length: " + String((unsigned long)size) + "\r\n";
+  head += "\r\n";
+  if (m_client.print(head) != head.length()) return HTTPC_ERROR_SEND_HEADER_FAILED;
+  if (size && m_client.write(payload, size) != size) return HTTPC_ERROR_SEND_PAYLOAD_FAILED;
+
+  String status = m_client.readStringUntil('\n');
+  if (!status.startsWith("HTTP/1.")) return HTTPC_ERROR_READ_TIMEOUT;
+  int code = (int)status.substring(status.indexOf(' ') + 1).toInt();
+  if (!readResponseHeaders()) return HTTPC_ERROR_CONNECTION_LOST;
+  return code;
+}
+
+bool HTTPClient::readResponseHeaders() {
+  m_contentLength = -1;
+  for (;;) {
+    String line = m_client.readStringUntil('\n');
+    line.trim();
+    if (line.isEmpty()) return true;
+    int colon = line.indexOf(':');
+    if (colon < 0) continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length")) m_contentLength = (int)value.toInt();
+    if (!m_client.connected()) return false;
+  }
+}
+
+String HTTPClient::getString() {
+  std::string body;
+  if (m_contentLength >= 0) {
+    body.resize((size_t)m_contentLength);
+    body.resize(m_client.readBytes(&body[0], body.size()));
+  } else {
+    // No length: the body runs until the server closes the connection.
+    while (m_client.connected()) {
+      int c = m_client.read();
+      if (c >= 0) body += (char)c;
+      else yield();
+    }
+  }
+  return String(body.data(), (unsigned int)body.size());
+}
+
+bool HTTPClient::connected() {
+  return m_client.connected() || m_client.available() > 0;
+}
@@ -0,0 +1,53 @@
+// HTTPClient.h - Host shim of the ESP32 HTTPClient (HTTP/1.1, plain TCP only)
+#ifndef HOST_HTTP_CLIENT_H
+#define HOST_HTTP_CLIENT_H
+
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+
+class HTTPClient {
+ public:
+  bool begin(const String &url);
+  bool begin(WiFiClient &client, const String &url);
+  void end();
+  void addHeader(const String &name, const String &value);
+  void setReuse(bool reuse) { m_reuse = reuse; }
+  void setTimeout(uint16_t timeoutMs) { m_timeoutMs = timeoutMs; }
+
+  int GET();
+  int POST(const uint8_t *payload, size_t size);
+  int POST(const String &payload);
+  int sendRequest(const char *method, const uint8_t *payload, size_t size);
+
+  int getSize() const { return m_contentLength; }
+  String getString();
+  WiFiClient *getStreamPtr() { return &m_client; }
+  WiFiClient &getStream() { return m_client; }
+  bool connected();
+
+ private:
+  bool readResponseHeaders();
+
+  WiFiClient m_client;
+  String m_host;
+  uint16_t m_port = 80;
+  String m_path;
+  std::vector<std::pair<String, String>> m_headers;
+  bool m_reuse = false;
+  uint16_t m_timeoutMs = 5000;
+  int m_contentLength = -1;
+};
+
+#endif // HOST_HTTP_CLIENT_H
@@ -0,0 +1,34 @@
+// LittleFS.h - Host shim of the ESP32 LittleFS, backed by a host directory
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "FS.h"
+
+namespace fs {
+
+class LittleFSFS : public FS {
+ public:
+  // The partition is a host directory: host::littleFsSetRoot(), else
+  // $HOST_LITTLEFS_DIR, else ./littlefs. It is created if missing.
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = "spiffs");
+  void end() { m_mounted = false; }
+  bool format();
+  size_t totalBytes();
+  size_t usedBytes();
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+namespace host {
+
+// Directory that stands in for the flash partition; call before begin().
+void littleFsSetRoot(const char *dir);
+// Size reported by totalBytes() (default 1.5 MB, the usual Arduino partition).
+void littleFsSetCapacity(size_t bytes);
+
+} // namespace host
+
+#endif // HOST_LITTLEFS_H
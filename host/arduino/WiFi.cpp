@@ -0,0 +1,157 @@
+// WiFi.cpp - Host implementation of WiFi / WiFiClient over POSIX sockets
+#include "WiFi.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <string>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+struct WiFiClient::Socket {
+  int fd = -1;
+  bool peerClosed = false;
+  std::string rx;
+  size_t rxPos = 0;
+
+  ~Socket() {
+    if (fd >= 0) ::close(fd);
+  }
+  size_t buffered() const { return rx.size() - rxPos; }
+};
+
+WiFiClient::WiFiClient() {
+  setTimeout(1000);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) {
+  return connect(host, port, 3000);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+  stop();
+  struct addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *res = nullptr;
+  char service[8];
+  std::snprintf(service, sizeof(service), "%u", (unsigned)port);
+  if (getaddrinfo(host, service, &hints, &res) != 0) return 0;
+
+  int fd = -1;
+  for (struct addrinfo *ai = res; ai; ai = ai->ai_next) {
+    fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0) continue;
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    int rc = ::connect(fd, ai->ai_addr, ai->ai_addrlen);
+    if (rc < 0 && errno == EINPROGRESS) {
+      struct pollfd pfd = {fd, POLLOUT, 0};
+      int err = 0;
+      socklen_t len = sizeof(err);
+      if (poll(&pfd, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) rc = 0;
+    }
+    if (rc == 0) {
+      fcntl(fd, F_SETFL, flags);
+      break;
+    }
+    ::close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(res);
+  if (fd < 0) return 0;
+
+  m_sock = std::make_shared<Socket>();
+  m_sock->fd = fd;
+  return 1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (!m_sock || m_sock->fd < 0) return 0;
+  if (m_sock->buffered()) return 1;
+  fill(0);
+  return !m_sock->peerClosed || m_sock->buffered() ? 1 : 0;
+}
+
+void WiFiClient::stop() {
+  m_sock.reset();
+}
+
+bool WiFiClient::fill(int timeoutMs) {
+  if (!m_sock || m_sock->fd < 0 || m_sock->peerClosed) return false;
+  struct pollfd pfd = {m_sock->fd, POLLIN, 0};
+  if (poll(&pfd, 1, timeoutMs) <= 0) return false;
+  char buf[4096];
+  ssize_t n = ::recv(m_sock->fd, buf, sizeof(buf), 0);
+  if (n <= 0) {
+    m_sock->peerClosed = true;
+    return false;
+  }
+  if (m_sock->rxPos == m_sock->rx.size()) {
+    m_sock->rx.clear();
+    m_sock->rxPos = 0;
+  }
+  m_sock->rx.append(buf, (size_t)n);
+  return true;
+}
+
+int WiFiClient::available() {
+  if (!m_sock) return 0;
+  if (!m_sock->buffered()) fill(0);
+  return (int)m_sock->buffered();
+}
+
+int WiFiClient::read() {
+  if (!available()) return -1;
+  return (unsigned char)m_sock->rx[m_sock->rxPos++];
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size) {
+  int avail = available();
+  if (avail <= 0) return -1;
+  size_t n = std::min(size, (size_t)avail);
+  std::memcpy(buf, m_sock->rx.data() + m_sock->rxPos, n);
+  m_sock->rxPos += n;
+  return (int)n;
+}
+
+int WiFiClient::peek() {
+  if (!available()) return -1;
+  return (unsigned char)m_sock->rx[m_sock->rxPos];
+}
+
+size_t WiFiClient::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size) {
+  if (!m_sock || m_sock->fd < 0) return 0;
+  size_t sent = 0;
+  while (sent < size) {
+    ssize_t n = ::send(m_sock->fd, buf + sent, size - sent, MSG_NOSIGNAL);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) continue;
+      m_sock->peerClosed = true;
+      break;
+    }
+    sent += (size_t)n;
+  }
+  return sent;
+}
+
+int WiFiClient::setNoDelay(bool noDelay) {
+  if (!m_sock || m_sock->fd < 0) return -1;
+  int v = noDelay ? 1 : 0;
+  return setsockopt(m_sock->fd, IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v));
+}
+
+int WiFiClient::fd() const {
+  return m_sock ? m_sock->fd : -1;
+}
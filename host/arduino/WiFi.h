@@ -0,0 +1,30 @@
+// WiFi.h - Host shim of the ESP32 WiFi station API (always "connected")
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6,
+} wl_status_t;
+
+#define WIFI_STA 1
+
+class WiFiClass {
+ public:
+  wl_status_t begin(const char *ssid, const char *password = nullptr) { (void)ssid; (void)password; return WL_CONNECTED; }
+  bool mode(int m) { (void)m; return true; }
+  bool disconnect(bool wifiOff = false) { (void)wifiOff; return true; }
+  wl_status_t status() { return WL_CONNECTED; }
+  bool setSleep(bool enabled) { (void)enabled; return true; }
+  int RSSI() { return -50; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,37 @@
+// WiFiClient.h - Host shim of the ESP32 WiFiClient over POSIX TCP sockets
+#ifndef HOST_WIFI_CLIENT_H
+#define HOST_WIFI_CLIENT_H
+
+#include <memory>
+
+#include "Arduino.h"
+
+class WiFiClient : public Stream {
+ public:
+  WiFiClient();
+
+  int connect(const char *host, uint16_t port);
+  int connect(const char *host, uint16_t port, int32_t timeoutMs);
+  uint8_t connected();
+  void stop();
+  explicit operator bool() { return connected(); }
+
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size);
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  void flush() override {}
+
+  int setNoDelay(bool noDelay);
+  int fd() const;
+
+ private:
+  struct Socket;
+  bool fill(int timeoutMs);
+  std::shared_ptr<Socket> m_sock; // copies share the connection, as on ESP32
+};
+
+#endif // HOST_WIFI_CLIENT_H
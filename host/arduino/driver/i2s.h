@@ -0,0 +1,93 @@
+// i2s.h - Host shim of the legacy ESP-IDF I2S driver
+//
+// RX ports pull samples from a host-provided source (silence by default) and
+// TX ports push into a host sink (discarded by default). In realtime mode both
+// directions are paced by the configured sample rate and RX models the DMA
+// ring: a reader that falls further behind than dma_buf_count * dma_buf_len
+// frames loses the oldest audio, exactly like the hardware does.
+#ifndef HOST_DRIVER_I2S_H
+#define HOST_DRIVER_I2S_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum { I2S_NUM_0 = 0, I2S_NUM_1 = 1, I2S_NUM_MAX } i2s_port_t;
+
+typedef enum {
+  I2S_MODE_MASTER = 1 << 0,
+  I2S_MODE_SLAVE  = 1 << 1,
+  I2S_MODE_TX     = 1 << 2,
+  I2S_MODE_RX     = 1 << 3,
+} i2s_mode_t;
+
+typedef enum {
+  I2S_BITS_PER_SAMPLE_8BIT  = 8,
+  I2S_BITS_PER_SAMPLE_16BIT = 16,
+  I2S_BITS_PER_SAMPLE_24BIT = 24,
+  I2S_BITS_PER_SAMPLE_32BIT = 32,
+} i2s_bits_per_sample_t;
+
+typedef enum {
+  I2S_CHANNEL_FMT_RIGHT_LEFT,
+  I2S_CHANNEL_FMT_ALL_RIGHT,
+  I2S_CHANNEL_FMT_ALL_LEFT,
+  I2S_CHANNEL_FMT_ONLY_RIGHT,
+  I2S_CHANNEL_FMT_ONLY_LEFT,
+} i2s_channel_fmt_t;
+
+typedef enum {
+  I2S_COMM_FORMAT_STAND_I2S = 0x01,
+  I2S_COMM_FORMAT_STAND_MSB = 0x03,
+} i2s_comm_format_t;
+
+typedef struct {
+  i2s_mode_t mode;
+  uint32_t sample_rate;
+  i2s_bits_per_sample_t bits_per_sample;
+  i2s_channel_fmt_t channel_format;
+  i2s_comm_format_t communication_format;
+  int intr_alloc_flags;
+  int dma_buf_count;
+  int dma_buf_len;
+  bool use_apll;
+  bool tx_desc_auto_clear;
+  int fixed_mclk;
+} i2s_config_t;
+
+typedef struct {
+  int bck_io_num;
+  int ws_io_num;
+  int data_out_num;
+  int data_in_num;
+} i2s_pin_config_t;
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t *config, int queue_size, void *queue);
+esp_err_t i2s_driver_uninstall(i2s_port_t port);
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *pins);
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port);
+esp_err_t i2s_read(i2s_port_t port, void *dest, size_t size, size_t *bytes_read, TickType_t ticks_to_wait);
+esp_err_t i2s_write(i2s_port_t port, const void *src, size_t size, size_t *bytes_written, TickType_t ticks_to_wait);
+
+namespace host {
+
+// Fill `dst` with up to `count` mono 16-bit samples; return how many were produced.
+typedef size_t (*I2SSource)(int16_t *dst, size_t count, void *ctx);
+// Consume `count` mono 16-bit samples written to a TX port.
+typedef void (*I2SSink)(const int16_t *src, size_t count, void *ctx);
+
+void i2sSetSource(i2s_port_t port, I2SSource source, void *ctx);
+void i2sSetSink(i2s_port_t port, I2SSink sink, void *ctx);
+// Pace reads/writes by the sample clock (default) or run as fast as possible.
+void i2sSetRealtime(bool enabled);
+// Frames lost on an RX port because the reader fell behind the DMA ring.
+uint64_t i2sDroppedFrames(i2s_port_t port);
+// Silent frames a TX port played because the writer fell behind, not
+// counting the wait for the first write.
+uint64_t i2sUnderrunFrames(i2s_port_t port);
+
+} // namespace host
+
+#endif // HOST_DRIVER_I2S_H
@@ -0,0 +1,119 @@
+// esp_partition.cpp - Host implementation of the flash partition shim
+#include "esp_partition.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct Partition {
+  esp_partition_t info;
+  std::string path;
+};
+
+struct Mapping {
+  void *base;
+  size_t length;
+};
+
+std::mutex g_mutex;
+std::map<std::string, std::unique_ptr<Partition>> g_partitions;
+std::map<esp_partition_mmap_handle_t, Mapping> g_mappings;
+esp_partition_mmap_handle_t g_nextHandle = 1;
+
+const Partition *lookup(const esp_partition_t *partition) {
+  for (auto &p : g_partitions) {
+    if (&p.second->info == partition) return p.second.get();
+  }
+  return nullptr;
+}
+
+} // namespace
+
+namespace host {
+
+bool partitionSetImage(const char *label, uint8_t subtype, const char *path) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (!path) {
+    g_partitions.erase(label);
+    return true;
+  }
+  struct stat st;
+  if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return false;
+  auto p = std::make_unique<Partition>();
+  p->info.type = ESP_PARTITION_TYPE_DATA;
+  p->info.subtype = (esp_partition_subtype_t)subtype;
+  p->info.address = 0;
+  p->info.size = (uint32_t)st.st_size;
+  std::snprintf(p->info.label, sizeof(p->info.label), "%s", label);
+  p->info.encrypted = false;
+  p->path = path;
+  // Pointers handed out earlier stay valid until the label is replaced.
+  g_partitions[label] = std::move(p);
+  return true;
+}
+
+} // namespace host
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  for (auto &p : g_partitions) {
+    const esp_partition_t &info = p.second->info;
+    if (type != ESP_PARTITION_TYPE_ANY && info.type != type) continue;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && info.subtype != subtype) continue;
+    if (label && std::strcmp(label, info.label) != 0) continue;
+    return &info;
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  const Partition *p = lookup(partition);
+  if (!p || !dst) return ESP_ERR_INVALID_ARG;
+  if (src_offset > p->info.size || size > p->info.size - src_offset) return ESP_ERR_INVALID_SIZE;
+  std::FILE *f = std::fopen(p->path.c_str(), "rb");
+  if (!f) return ESP_FAIL;
+  bool ok = std::fseek(f, (long)src_offset, SEEK_SET) == 0 && std::fread(dst, 1, size, f) == size;
+  std::fclose(f);
+  return ok ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  const Partition *p = lookup(partition);
+  if (!p || !out_ptr || !out_handle || memory != ESP_PARTITION_MMAP_DATA) return ESP_ERR_INVALID_ARG;
+  if (offset > p->info.size || size > p->info.size - offset || size == 0) return ESP_ERR_INVALID_SIZE;
+  int fd = open(p->path.c_str(), O_RDONLY);
+  if (fd < 0) return ESP_FAIL;
+  // mmap offsets must be page aligned; the device's MMU pages are 64 KB.
+  size_t page = (size_t)sysconf(_SC_PAGESIZE);
+  size_t lead = offset % page;
+  void *base = mmap(nullptr, size + lead, PROT_READ, MAP_SHARED, fd, (off_t)(offset - lead));
+  close(fd);
+  if (base == MAP_FAILED) return ESP_ERR_NO_MEM;
+  *out_handle = g_nextHandle++;
+  g_mappings[*out_handle] = Mapping{base, size + lead};
+  *out_ptr = static_cast<const uint8_t *>(base) + lead;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto it = g_mappings.find(handle);
+  if (it == g_mappings.end()) return;
+  munmap(it->second.base, it->second.length);
+  g_mappings.erase(it);
+}
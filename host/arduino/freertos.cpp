@@ -0,0 +1,107 @@
+// freertos.cpp - Host implementation of the FreeRTOS task shim
+#include "freertos/task.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct HostTask {
+  TaskFunction_t fn = nullptr;
+  void *param = nullptr;
+  BaseType_t core = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint32_t notifications = 0;
+  bool finished = false;
+};
+
+namespace {
+
+thread_local HostTask *t_current = nullptr;
+const auto g_epoch = std::chrono::steady_clock::now();
+
+// On the device even setup()/loop() run in a task; give threads the shim did
+// not start (main, test harnesses) a task record on first use so they can
+// take notifications too.
+HostTask *currentTask() {
+  if (!t_current) t_current = new HostTask;
+  return t_current;
+}
+
+void runTask(HostTask *task) {
+  t_current = task;
+  task->fn(task->param);
+  // Tasks live as long as the process, like ones that never delete on device.
+  std::lock_guard<std::mutex> lock(task->mutex);
+  task->finished = true;
+}
+
+} // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *, uint32_t, void *param,
+                                   UBaseType_t, TaskHandle_t *handle, BaseType_t coreId) {
+  if (!fn) return pdFAIL;
+  HostTask *task = new HostTask;
+  task->fn = fn;
+  task->param = param;
+  task->core = coreId == tskNO_AFFINITY ? 0 : coreId;
+  if (handle) *handle = task;
+  std::thread(runTask, task).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  // Only self-deletion is supported; see task.h.
+  if (task && task != t_current) return;
+  if (t_current) {
+    std::lock_guard<std::mutex> lock(t_current->mutex);
+    t_current->finished = true;
+  }
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)(std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - g_epoch).count() / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return currentTask();
+}
+
+BaseType_t xPortGetCoreID() {
+  return t_current ? t_current->core : 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (!task) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    ++task->notifications;
+  }
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  HostTask *task = currentTask();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  auto ready = [task] { return task->notifications > 0; };
+  if (ticksToWait == portMAX_DELAY) {
+    task->cv.wait(lock, ready);
+  } else {
+    task->cv.wait_for(lock, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS), ready);
+  }
+  uint32_t value = task->notifications;
+  if (value) task->notifications = clearOnExit ? 0 : value - 1;
+  return value;
+}
@@ -0,0 +1,20 @@
+// FreeRTOS.h - Host shim of the FreeRTOS types used by the ESP32 sources
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#endif // HOST_FREERTOS_H
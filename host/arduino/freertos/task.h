@@ -0,0 +1,38 @@
+// task.h - Host shim of the FreeRTOS task API used by the ESP32 sources
+//
+// Each task is a std::thread. Core affinity and priority are recorded but not
+// enforced (the host scheduler decides). Differences from FreeRTOS:
+//   * vTaskDelete(NULL) only marks the task finished; the task function must
+//     return right after calling it (which FreeRTOS code does anyway, since
+//     vTaskDelete(NULL) never returns on the device).
+//   * Deleting another task is not supported.
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+
+struct HostTask;
+typedef HostTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *handle, BaseType_t coreId);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+// Core the calling task was pinned to (0 for the main thread / unpinned tasks).
+BaseType_t xPortGetCoreID();
+
+// Direct-to-task notifications used as a lightweight counting semaphore.
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+
+#endif // HOST_FREERTOS_TASK_H
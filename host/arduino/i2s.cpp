@@ -0,0 +1,172 @@
+// i2s.cpp - Host implementation of the I2S driver shim
+#include "driver/i2s.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Port {
+  bool installed = false;
+  i2s_config_t config{};
+  host::I2SSource source = nullptr;
+  void *sourceCtx = nullptr;
+  host::I2SSink sink = nullptr;
+  void *sinkCtx = nullptr;
+  Clock::time_point start;
+  uint64_t framesDone = 0;   // frames delivered to / accepted from the caller
+  std::atomic<uint64_t> dropped{0};
+  std::atomic<uint64_t> underrun{0};
+  std::mutex mutex;
+};
+
+Port g_ports[I2S_NUM_MAX];
+std::atomic<bool> g_realtime{true};
+
+bool valid(i2s_port_t port) {
+  return port >= I2S_NUM_0 && port < I2S_NUM_MAX && g_ports[port].installed;
+}
+
+// Frames the sample clock has produced since the port was installed.
+uint64_t clockFrames(const Port &p) {
+  auto us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - p.start).count();
+  return (uint64_t)us * p.config.sample_rate / 1000000ULL;
+}
+
+// Block until `frames` have elapsed on the sample clock, or `ticks` ms pass.
+// Returns the number of frames that are actually due.
+uint64_t waitForFrames(const Port &p, uint64_t frames, TickType_t ticks) {
+  uint64_t due = clockFrames(p);
+  if (due >= frames) return frames;
+  auto deadline = p.start + std::chrono::microseconds(frames * 1000000ULL / p.config.sample_rate);
+  if (ticks != portMAX_DELAY) {
+    auto limit = Clock::now() + std::chrono::milliseconds(ticks);
+    if (limit < deadline) deadline = limit;
+  }
+  std::this_thread::sleep_until(deadline);
+  due = clockFrames(p);
+  return due < frames ? due : frames;
+}
+
+} // namespace
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t *config, int, void *) {
+  if (port < I2S_NUM_0 || port >= I2S_NUM_MAX || !config) return ESP_ERR_INVALID_ARG;
+  if (config->sample_rate == 0) return ESP_ERR_INVALID_ARG;
+  Port &p = g_ports[port];
+  std::lock_guard<std::mutex> lock(p.mutex);
+  if (p.installed) return ESP_ERR_INVALID_STATE;
+  p.config = *config;
+  p.start = Clock::now();
+  p.framesDone = 0;
+  p.dropped = 0;
+  p.underrun = 0;
+  p.installed = true;
+  return ESP_OK;
+}
+
+esp_err_t i2s_driver_uninstall(i2s_port_t port) {
+  if (!valid(port)) return ESP_ERR_INVALID_STATE;
+  std::lock_guard<std::mutex> lock(g_ports[port].mutex);
+  g_ports[port].installed = false;
+  return ESP_OK;
+}
+
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *) {
+  return valid(port) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port) {
+  return valid(port) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t i2s_read(i2s_port_t port, void *dest, size_t size, size_t *bytes_read, TickType_t ticks_to_wait) {
+  if (bytes_read) *bytes_read = 0;
+  if (!valid(port) || !dest) return ESP_ERR_INVALID_ARG;
+  Port &p = g_ports[port];
+  std::lock_guard<std::mutex> lock(p.mutex);
+  size_t want = size / sizeof(int16_t);
+
+  if (g_realtime) {
+    // Anything older than the DMA ring has been overwritten by the hardware.
+    uint64_t ring = (uint64_t)p.config.dma_buf_count * (uint64_t)p.config.dma_buf_len;
+    uint64_t due = clockFrames(p);
+    if (ring && due > p.framesDone + ring) {
+      p.dropped += due - ring - p.framesDone;
+      p.framesDone = due - ring;
+    }
+    uint64_t ready = waitForFrames(p, p.framesDone + want, ticks_to_wait);
+    want = ready > p.framesDone ? (size_t)(ready - p.framesDone) : 0;
+  }
+
+  int16_t *out = static_cast<int16_t *>(dest);
+  size_t got = p.source ? p.source(out, want, p.sourceCtx) : 0;
+  if (got < want) std::memset(out + got, 0, (want - got) * sizeof(int16_t));
+  p.framesDone += want;
+  if (bytes_read) *bytes_read = want * sizeof(int16_t);
+  return want ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t i2s_write(i2s_port_t port, const void *src, size_t size, size_t *bytes_written, TickType_t ticks_to_wait) {
+  if (bytes_written) *bytes_written = 0;
+  if (!valid(port) || !src) return ESP_ERR_INVALID_ARG;
+  Port &p = g_ports[port];
+  std::lock_guard<std::mutex> lock(p.mutex);
+  size_t count = size / sizeof(int16_t);
+
+  if (g_realtime) {
+    // The DMA ring absorbs up to its capacity ahead of the sample clock.
+    uint64_t ring = (uint64_t)p.config.dma_buf_count * (uint64_t)p.config.dma_buf_len;
+    uint64_t now = clockFrames(p);
+    if (now > p.framesDone) { // underrun: the ring ran dry
+      if (p.framesDone) p.underrun += now - p.framesDone;
+      p.framesDone = now;
+    }
+    uint64_t target = p.framesDone + count;
+    uint64_t ready = waitForFrames(p, target > ring ? target - ring : 0, ticks_to_wait);
+    uint64_t room = ready + ring > p.framesDone ? ready + ring - p.framesDone : 0;
+    if (room < count) count = (size_t)room;
+  }
+
+  if (p.sink && count) p.sink(static_cast<const int16_t *>(src), count, p.sinkCtx);
+  p.framesDone += count;
+  if (bytes_written) *bytes_written = count * sizeof(int16_t);
+  return count ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+namespace host {
+
+void i2sSetSource(i2s_port_t port, I2SSource source, void *ctx) {
+  if (port < I2S_NUM_0 || port >= I2S_NUM_MAX) return;
+  std::lock_guard<std::mutex> lock(g_ports[port].mutex);
+  g_ports[port].source = source;
+  g_ports[port].sourceCtx = ctx;
+}
+
+void i2sSetSink(i2s_port_t port, I2SSink sink, void *ctx) {
+  if (port < I2S_NUM_0 || port >= I2S_NUM_MAX) return;
+  std::lock_guard<std::mutex> lock(g_ports[port].mutex);
+  g_ports[port].sink = sink;
+  g_ports[port].sinkCtx = ctx;
+}
+
+void i2sSetRealtime(bool enabled) {
+  g_realtime = enabled;
+}
+
+uint64_t i2sDroppedFrames(i2s_port_t port) {
+  if (port < I2S_NUM_0 || port >= I2S_NUM_MAX) return 0;
+  return g_ports[port].dropped;
+}
+
+uint64_t i2sUnderrunFrames(i2s_port_t port) {
+  if (port < I2S_NUM_0 || port >= I2S_NUM_MAX) return 0;
+  return g_ports[port].underrun;
+}
+
+} // namespace host
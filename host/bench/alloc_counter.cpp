@@ -0,0 +1,33 @@
+// alloc_counter.cpp - Replaces global operator new/delete to count allocations
+#include "alloc_counter.h"
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> g_newCalls{0};
+
+void *operator new(std::size_t size) {
+  g_newCalls.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace alloc_counter {
+
+uint64_t allocations() {
+  return g_newCalls.load(std::memory_order_relaxed) + host::stringHeapStats().allocations;
+}
+
+} // namespace alloc_counter
@@ -0,0 +1,17 @@
+// alloc_counter.h - Heap allocation accounting for host benchmarks
+//
+// Counts every global operator new plus the malloc/realloc traffic of the
+// Arduino String shim (which, like the AVR core, bypasses operator new).
+#ifndef HOST_ALLOC_COUNTER_H
+#define HOST_ALLOC_COUNTER_H
+
+#include <cstdint>
+
+namespace alloc_counter {
+
+// Total heap allocations made by this process so far.
+uint64_t allocations();
+
+} // namespace alloc_counter
+
+#endif // HOST_ALLOC_COUNTER_H
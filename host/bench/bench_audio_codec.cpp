@@ -0,0 +1,60 @@
+// bench_audio_codec.cpp - Encode cost of the STT uplink codecs per 32 ms frame
+//
+// Times AudioEncoder::encode on a speech-band frame for each codec and
+// reports ns/frame plus CPU cycles/frame from ESP.getCycleCount() (the TSC on
+// x86 hosts), the same counter printAudioCodecBenchmark() reads on the ESP32.
+// BM_PrintBenchmark runs that on-device routine itself once.
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <Arduino.h>
+
+#include "audio_codec.h"
+
+namespace {
+
+const AudioBuffer &speechFrame() {
+  static AudioBuffer frame;
+  if (frame.count == 0) {
+    uint32_t noise = 12345;
+    for (size_t i = 0; i < AUDIO_FRAME_SAMPLES; ++i) {
+      noise = noise * 1103515245u + 12345u;
+      double t = (double)i / AUDIO_SAMPLE_RATE;
+      frame.samples[i] = (int16_t)(6000 * std::sin(2 * M_PI * 220 * t) + 2500 * std::sin(2 * M_PI * 1750 * t) +
+                                   (double)((int32_t)(noise >> 16) % 800));
+    }
+    frame.count = AUDIO_FRAME_SAMPLES;
+  }
+  return frame;
+}
+
+void BM_Encode(benchmark::State &state, AudioCodec codec) {
+  const AudioBuffer &frame = speechFrame();
+  AudioEncoder enc(codec);
+  uint8_t out[AUDIO_ENCODED_MAX_BYTES];
+  uint64_t cycles = 0;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    uint32_t t0 = ESP.getCycleCount();
+    bytes = enc.encode(frame, out);
+    cycles += ESP.getCycleCount() - t0;
+    benchmark::DoNotOptimize(out);
+  }
+  state.counters["cycles/frame"] = (double)cycles / (double)state.iterations();
+  state.counters["bytes/frame"] = (double)bytes;
+  state.SetBytesProcessed((int64_t)state.iterations() * AUDIO_FRAME_SAMPLES * (int64_t)sizeof(int16_t));
+}
+
+void BM_PrintBenchmark(benchmark::State &state) {
+  for (auto _ : state) printAudioCodecBenchmark(Serial, 200);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Encode, pcm_s16le, AudioCodec::Pcm16);
+BENCHMARK_CAPTURE(BM_Encode, mulaw, AudioCodec::MuLaw);
+BENCHMARK_CAPTURE(BM_Encode, ima_adpcm, AudioCodec::ImaAdpcm);
+BENCHMARK(BM_PrintBenchmark)->Iterations(1);
+
+BENCHMARK_MAIN();
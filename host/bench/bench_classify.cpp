@@ -0,0 +1,185 @@
+// bench_classify.cpp - Throughput and latency of AdmissionModel::classify
+//
+// Replays three corpora through the real classifier:
+//   faq_csv    - the canonical questions in database/faq.csv
+//   augmented  - the training set in ml_model/training/artifacts/processed_dataset.json
+//   long       - synthetic 80-word utterances with keywords scattered through filler
+// and reports ns/query, heap allocations/query and per-query p50/p99 latency.
+// BM_LinearLogits times the exported TF-IDF model alone on the same corpora.
+// BM_PerCall / BM_Batch classify batches of 1, 16, 256 and 4096 augmented
+// queries one classify() at a time and with one classifyBatch().
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "linear_model.h"
+#include "ml_model.h"
+#include "ns_counter.h"
+#include "query_corpus.h"
+
+namespace {
+
+enum class Corpus { FaqCsv, Augmented, Long };
+
+const std::vector<String> &corpus(Corpus which) {
+  static std::vector<String> sets[3];
+  std::vector<String> &set = sets[(int)which];
+  if (set.empty()) {
+    std::vector<LabeledQuery> queries;
+    switch (which) {
+      case Corpus::FaqCsv: queries = loadFaqCsv(repoPath("database/faq.csv")); break;
+      case Corpus::Augmented: queries = loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json")); break;
+      case Corpus::Long: queries = syntheticLongUtterances(64, 80); break;
+    }
+    for (const LabeledQuery &q : queries) set.emplace_back(q.text.c_str());
+  }
+  return set;
+}
+
+AdmissionModel &model() {
+  static AdmissionModel m;
+  static bool ready = m.begin();
+  (void)ready;
+  return m;
+}
+
+void BM_Classify(benchmark::State &state, Corpus which) {
+  const std::vector<String> &queries = corpus(which);
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  AdmissionModel &m = model();
+  size_t i = 0;
+  uint64_t allocsBefore = alloc_counter::allocations();
+  NsPerItem perItem;
+  for (auto _ : state) {
+    ClassificationResult r = m.classify(queries[i]);
+    benchmark::DoNotOptimize(r);
+    if (++i == queries.size()) i = 0;
+  }
+  uint64_t allocs = alloc_counter::allocations() - allocsBefore;
+  state.SetItemsProcessed(state.iterations());
+  state.counters["ns/query"] = perItem((double)state.iterations());
+  state.counters["allocs/query"] = (double)allocs / (double)state.iterations();
+}
+
+void BM_ClassifyLatency(benchmark::State &state, Corpus which) {
+  using Clock = std::chrono::steady_clock;
+  const std::vector<String> &queries = corpus(which);
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  AdmissionModel &m = model();
+  std::vector<double> samples;
+  size_t i = 0;
+  for (auto _ : state) {
+    auto t0 = Clock::now();
+    ClassificationResult r = m.classify(queries[i]);
+    benchmark::DoNotOptimize(r);
+    auto t1 = Clock::now();
+    samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+    if (++i == queries.size()) i = 0;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto pct = [&samples](double p) { return samples[(size_t)(p * (double)(samples.size() - 1))]; };
+  state.counters["p50_ns"] = pct(0.50);
+  state.counters["p99_ns"] = pct(0.99);
+}
+
+void BM_LinearLogits(benchmark::State &state, Corpus which) {
+  const std::vector<String> &queries = corpus(which);
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  float logits[LINEAR_NUM_LABELS];
+  size_t i = 0;
+  NsPerItem perItem;
+  for (auto _ : state) {
+    LinearClassifier::logits(queries[i].c_str(), queries[i].length(), logits);
+    benchmark::DoNotOptimize(logits);
+    if (++i == queries.size()) i = 0;
+  }
+  state.counters["ns/query"] = perItem((double)state.iterations());
+}
+
+// The augmented corpus cycled into `size` pointer/length pairs.
+struct BatchInput {
+  std::vector<const char *> texts;
+  std::vector<size_t> lens;
+  std::vector<ClassificationResult> out;
+};
+
+bool makeBatch(benchmark::State &state, BatchInput &in) {
+  const std::vector<String> &queries = corpus(Corpus::Augmented);
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return false;
+  }
+  size_t size = (size_t)state.range(0);
+  for (size_t i = 0; i < size; ++i) {
+    const String &q = queries[i % queries.size()];
+    in.texts.push_back(q.c_str());
+    in.lens.push_back(q.length());
+  }
+  in.out.resize(size);
+  return true;
+}
+
+void reportBatch(benchmark::State &state, const NsPerItem &perItem) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["ns/query"] = perItem((double)(state.iterations() * state.range(0)));
+}
+
+void BM_PerCall(benchmark::State &state) {
+  BatchInput in;
+  if (!makeBatch(state, in)) return;
+  AdmissionModel &m = model();
+  NsPerItem perItem;
+  for (auto _ : state) {
+    for (size_t i = 0; i < in.out.size(); ++i) in.out[i] = m.classify(in.texts[i], in.lens[i]);
+    benchmark::DoNotOptimize(in.out.data());
+    benchmark::ClobberMemory();
+  }
+  reportBatch(state, perItem);
+}
+
+void BM_Batch(benchmark::State &state) {
+  BatchInput in;
+  if (!makeBatch(state, in)) return;
+  AdmissionModel &m = model();
+  NsPerItem perItem;
+  for (auto _ : state) {
+    m.classifyBatch(in.texts.data(), in.lens.data(), in.out.size(), in.out.data());
+    benchmark::DoNotOptimize(in.out.data());
+    benchmark::ClobberMemory();
+  }
+  reportBatch(state, perItem);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Classify, faq_csv, Corpus::FaqCsv);
+BENCHMARK_CAPTURE(BM_Classify, augmented, Corpus::Augmented);
+BENCHMARK_CAPTURE(BM_Classify, long, Corpus::Long);
+BENCHMARK_CAPTURE(BM_ClassifyLatency, faq_csv, Corpus::FaqCsv);
+BENCHMARK_CAPTURE(BM_ClassifyLatency, augmented, Corpus::Augmented);
+BENCHMARK_CAPTURE(BM_ClassifyLatency, long, Corpus::Long);
+BENCHMARK_CAPTURE(BM_LinearLogits, augmented, Corpus::Augmented);
+BENCHMARK_CAPTURE(BM_LinearLogits, long, Corpus::Long);
+BENCHMARK(BM_PerCall)->Arg(1)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_Batch)->Arg(1)->Arg(16)->Arg(256)->Arg(4096);
+
+int main(int argc, char **argv) {
+  host::setSerialOutputEnabled(false); // keep module debug logging out of the report
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,69 @@
+// bench_frame_stats.cpp - Per-frame level statistics: fixed-point kernel vs the old double loop
+//
+// BM_RmsDouble is the previous AudioIO::rms (int16 -> double, double
+// accumulate), which the ESP32 runs in software floating point.
+// BM_FrameStats computes RMS, peak, zero crossings and DC in one integer pass.
+// Both report CPU cycles per 512-sample frame (ESP.getCycleCount()).
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <Arduino.h>
+
+#include "audio_io.h"
+#include "frame_stats.h"
+
+namespace {
+
+const AudioBuffer &speechFrame() {
+  static AudioBuffer frame;
+  if (frame.count == 0) {
+    uint32_t noise = 99;
+    for (size_t i = 0; i < AUDIO_FRAME_SAMPLES; ++i) {
+      noise = noise * 1103515245u + 12345u;
+      frame.samples[i] = (int16_t)(5000 * std::sin(2 * M_PI * 200 * (double)i / AUDIO_SAMPLE_RATE) +
+                                   (double)((int32_t)(noise >> 16) % 600));
+    }
+    frame.count = AUDIO_FRAME_SAMPLES;
+  }
+  return frame;
+}
+
+float rmsDouble(const AudioBuffer &buf) {
+  if (buf.count == 0) return 0.f;
+  double acc = 0.0;
+  for (size_t i = 0; i < buf.count; ++i) {
+    double s = buf.samples[i];
+    acc += s * s;
+  }
+  return sqrt(acc / (double)buf.count) / 32768.0;
+}
+
+template <typename Fn>
+void run(benchmark::State &state, Fn fn) {
+  const AudioBuffer &frame = speechFrame();
+  uint64_t cycles = 0;
+  for (auto _ : state) {
+    uint32_t t0 = ESP.getCycleCount();
+    auto r = fn(frame);
+    cycles += ESP.getCycleCount() - t0;
+    benchmark::DoNotOptimize(r);
+  }
+  state.counters["cycles/frame"] = (double)cycles / (double)state.iterations();
+  state.SetItemsProcessed((int64_t)state.iterations() * AUDIO_FRAME_SAMPLES);
+}
+
+void BM_RmsDouble(benchmark::State &state) {
+  run(state, [](const AudioBuffer &f) { return rmsDouble(f); });
+}
+
+void BM_FrameStats(benchmark::State &state) {
+  run(state, [](const AudioBuffer &f) { return computeFrameStats(f.samples, f.count); });
+}
+
+} // namespace
+
+BENCHMARK(BM_RmsDouble);
+BENCHMARK(BM_FrameStats);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+// bench_neural.cpp - The int8 neural model vs. the keyword classifier
+//
+// Replays the augmented training set (processed_dataset.json) through:
+//   BM_NeuralInvoke    - NeuralClassifier::logits() on precomputed features
+//   BM_NeuralClassify  - AdmissionModel::classifyNeural(): featurizer + network
+//   BM_KeywordClassify - AdmissionModel::classify(), the keyword automaton path
+// and reports ns/query, heap allocations/query and per-query p50/p99. The
+// neural runs also report the arena high-water mark against the static arena
+// reserved in config.h.
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "featurizer.h"
+#include "ml_model.h"
+#include "neural_model.h"
+#include "ns_counter.h"
+#include "query_corpus.h"
+
+namespace {
+
+const std::vector<LabeledQuery> &corpus() {
+  static std::vector<LabeledQuery> queries =
+      loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json"));
+  return queries;
+}
+
+AdmissionModel &model() {
+  static AdmissionModel m;
+  static bool ready = m.begin();
+  (void)ready;
+  return m;
+}
+
+void reportArena(benchmark::State &state) {
+  state.counters["arena_used_bytes"] = (double)NeuralClassifier::arenaUsedBytes();
+  state.counters["arena_size_bytes"] = (double)NeuralClassifier::arenaSize();
+}
+
+// ns/query, allocs/query and p50/p99 of `run(query)` over the corpus.
+template <typename Run>
+void timeQueries(benchmark::State &state, size_t count, Run run) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<double> samples;
+  samples.reserve((size_t)state.max_iterations); // no allocation inside the loop
+  size_t i = 0;
+  uint64_t allocsBefore = alloc_counter::allocations();
+  NsPerItem perItem;
+  for (auto _ : state) {
+    auto t0 = Clock::now();
+    run(i);
+    auto t1 = Clock::now();
+    samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+    if (++i == count) i = 0;
+  }
+  state.counters["ns/query"] = perItem((double)state.iterations());
+  uint64_t allocs = alloc_counter::allocations() - allocsBefore;
+  state.counters["allocs/query"] = (double)allocs / (double)state.iterations();
+  std::sort(samples.begin(), samples.end());
+  auto pct = [&samples](double p) { return samples[(size_t)(p * (double)(samples.size() - 1))]; };
+  state.counters["p50_ns"] = pct(0.50);
+  state.counters["p99_ns"] = pct(0.99);
+}
+
+void BM_NeuralInvoke(benchmark::State &state) {
+  const std::vector<LabeledQuery> &queries = corpus();
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  std::vector<std::vector<float>> features(queries.size(), std::vector<float>(MODEL_INPUT_SIZE));
+  for (size_t i = 0; i < queries.size(); ++i) {
+    HashedFeaturizer::featurize(queries[i].text.data(), queries[i].text.size(), features[i].data());
+  }
+  int8_t logits[NEURAL_NUM_LABELS];
+  timeQueries(state, queries.size(), [&](size_t i) {
+    NeuralClassifier::logits(features[i].data(), logits);
+    benchmark::DoNotOptimize(logits);
+  });
+  reportArena(state);
+}
+
+void BM_NeuralClassify(benchmark::State &state) {
+  const std::vector<LabeledQuery> &queries = corpus();
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  AdmissionModel &m = model();
+  timeQueries(state, queries.size(), [&](size_t i) {
+    ClassificationResult r = m.classifyNeural(queries[i].text.data(), queries[i].text.size());
+    benchmark::DoNotOptimize(r);
+  });
+  reportArena(state);
+}
+
+void BM_KeywordClassify(benchmark::State &state) {
+  const std::vector<LabeledQuery> &queries = corpus();
+  if (queries.empty()) {
+    state.SkipWithError("corpus not found (set ADMISSION_REPO_DIR)");
+    return;
+  }
+  AdmissionModel &m = model();
+  timeQueries(state, queries.size(), [&](size_t i) {
+    ClassificationResult r = m.classify(queries[i].text.data(), queries[i].text.size());
+    benchmark::DoNotOptimize(r);
+  });
+}
+
+} // namespace
+
+BENCHMARK(BM_NeuralInvoke);
+BENCHMARK(BM_NeuralClassify);
+BENCHMARK(BM_KeywordClassify);
+
+int main(int argc, char **argv) {
+  host::setSerialOutputEnabled(false); // keep module debug logging out of the report
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
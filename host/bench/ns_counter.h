@@ -0,0 +1,24 @@
+// ns_counter.h - Nanoseconds-per-item counters for Google Benchmark
+#ifndef HOST_NS_COUNTER_H
+#define HOST_NS_COUNTER_H
+
+#include <chrono>
+
+// Wall time over a benchmark's timing loop. Counter(n, kIsRate | kInvert)
+// would store seconds per item (9.6e-08 in JSON, "96ns" only on the
+// console), so the loop is timed here and the counter holds plain
+// nanoseconds. Start it right before `for (auto _ : state)`.
+class NsPerItem {
+ public:
+  NsPerItem() : m_start(std::chrono::steady_clock::now()) {}
+
+  double operator()(double items) const {
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_start).count();
+    return items > 0 ? ns / items : 0.0;
+  }
+
+ private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // HOST_NS_COUNTER_H
@@ -0,0 +1,44 @@
+// main_host.cpp - Runs the code/main.ino sketch natively on Linux
+//
+// Serial is bound to stdin/stdout. While there is unread input the button on
+// BUTTON_PIN is tapped (held for BUTTON_DEBOUNCE_MS, then released for as
+// long), so piping a file of questions through the binary walks the sketch
+// through listen -> classify -> respond for each one. Built for ESP32
+// (admission_host_esp32), ADMISSION_FAQ_DB names an image to serve as the
+// "faqdb" partition.
+#include <Arduino.h>
+
+#include <cstdlib>
+
+#include "config.h"
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_partition.h>
+#include "faq_db_partition.h"
+#endif
+
+void setup();
+void loop();
+
+int main() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (const char *image = std::getenv("ADMISSION_FAQ_DB")) {
+    host::partitionSetImage(FAQ_DB_PARTITION, FAQ_DB_SUBTYPE, image);
+  }
+#endif
+  setup();
+  unsigned long tapStart = millis() - 2 * BUTTON_DEBOUNCE_MS;
+  for (;;) {
+    bool pending = Serial.available() > 0;
+    unsigned long sinceTap = millis() - tapStart;
+    if (pending && sinceTap >= 2 * BUTTON_DEBOUNCE_MS) {
+      host::setPinLevel(BUTTON_PIN, LOW);
+      tapStart = millis();
+    } else if (sinceTap >= BUTTON_DEBOUNCE_MS) {
+      host::setPinLevel(BUTTON_PIN, HIGH);
+    }
+    loop();
+    if (!pending && host::serialInputClosed()) break;
+  }
+  Serial.flush();
+  return 0;
+}
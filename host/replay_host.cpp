@@ -0,0 +1,223 @@
+// replay_host.cpp - Replays query corpora through the code/main.ino pipeline
+//
+// usage: admission_replay [--corpus=NAME|PATH]... [--repeat=N] [--min-agreement=F] [--misses=N]
+//
+//   faq        database/faq.csv questions
+//   augmented  ml_model/training/artifacts/processed_dataset.json
+//   log        conversation_log.json user queries (labels are the Python
+//              prototype's guesses)
+//   long       synthetic 80-word utterances (unlabeled)
+//   PATH       one query per line, optionally TAB + expected category
+//
+// Each query takes the sketch's own path: its bytes are fed to Serial and
+// assembled by STTModule, then processQuery() classifies it with
+// AdmissionModel and provideFeedback() speaks faqResponse() through
+// TTSModule, exactly as taskSTT / taskClassify / taskTTS run them. Serial
+// output is discarded. Per corpus it reports queries/sec, p50/p99/max latency
+// of each stage and of the whole query, and how often the category matches
+// the expected label; a log2 histogram of whole-query latency follows.
+// --min-agreement makes the exit status fail below that fraction (labeled
+// queries over all corpora).
+#include <Arduino.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "faq_responder.h"
+#include "ml_model.h"
+#include "query_corpus.h"
+#include "stt_module.h"
+
+// From code/main.ino.
+void setup();
+void processQuery(const char *query, size_t len);
+void provideFeedback();
+extern STTModule g_stt;
+extern Intent currentIntent;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum Stage { STT, CLASSIFY, RESPOND, TOTAL, STAGES };
+const char *const kStageNames[STAGES] = {"stt", "classify", "respond", "total"};
+
+struct Corpus {
+  std::string name;
+  std::vector<LabeledQuery> queries;
+};
+
+struct Result {
+  std::vector<double> ns[STAGES];
+  double wallNs = 0;
+  size_t labeled = 0;
+  size_t agreed = 0;
+  size_t truncated = 0;   // longer than STT_LINE_MAX; classified as cut
+  std::vector<std::string> misses;
+};
+
+bool loadCorpus(const std::string &spec, Corpus &out) {
+  out.name = spec;
+  if (spec == "faq") out.queries = loadFaqCsv(repoPath("database/faq.csv"));
+  else if (spec == "augmented") out.queries = loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json"));
+  else if (spec == "log") out.queries = loadConversationLog(repoPath("conversation_log.json"));
+  else if (spec == "long") out.queries = syntheticLongUtterances(256, 80);
+  else out.queries = loadQueryLines(spec);
+  // The sketch ignores blank utterances; they would never come out of STT.
+  out.queries.erase(std::remove_if(out.queries.begin(), out.queries.end(),
+                                   [](const LabeledQuery &q) {
+                                     return q.text.find_first_not_of(" \t\r\n") == std::string::npos ||
+                                            q.text.find_first_of("\r\n") != std::string::npos;
+                                   }),
+                    out.queries.end());
+  return !out.queries.empty();
+}
+
+double elapsedNs(Clock::time_point from, Clock::time_point to) {
+  return std::chrono::duration<double, std::nano>(to - from).count();
+}
+
+void replay(const Corpus &corpus, unsigned repeat, size_t maxMisses, Result &res) {
+  auto start = Clock::now();
+  for (unsigned r = 0; r < repeat; ++r) {
+    for (const LabeledQuery &q : corpus.queries) {
+      std::string line = q.text + '\n';
+      auto t0 = Clock::now();
+      host::serialFeed(line.data(), line.size());
+      while (!g_stt.available()) {
+      }
+      char utterance[STT_LINE_MAX + 1];
+      size_t len = g_stt.readUtterance(utterance, sizeof(utterance));
+      auto t1 = Clock::now();
+      processQuery(utterance, len);
+      Intent intent = currentIntent;
+      auto t2 = Clock::now();
+      provideFeedback();
+      auto t3 = Clock::now();
+
+      res.ns[STT].push_back(elapsedNs(t0, t1));
+      res.ns[CLASSIFY].push_back(elapsedNs(t1, t2));
+      res.ns[RESPOND].push_back(elapsedNs(t2, t3));
+      res.ns[TOTAL].push_back(elapsedNs(t0, t3));
+      if (q.text.size() > STT_LINE_MAX) ++res.truncated;
+      if (q.label.empty()) continue;
+      ++res.labeled;
+      String got(intentName(intent));
+      if (q.label == got.c_str()) {
+        ++res.agreed;
+      } else if (r == 0 && res.misses.size() < maxMisses) {
+        res.misses.push_back(q.label + " -> " + got.c_str() + ": " + q.text);
+      }
+    }
+  }
+  res.wallNs = elapsedNs(start, Clock::now());
+}
+
+double percentile(std::vector<double> v, double p) {
+  if (v.empty()) return 0;
+  size_t k = std::min(v.size() - 1, (size_t)(p * (double)(v.size() - 1) + 0.5));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+void printResult(const Corpus &corpus, const Result &res) {
+  size_t n = res.ns[TOTAL].size();
+  std::printf("%s: %zu queries in %.1f ms, %.0f queries/s", corpus.name.c_str(), n, res.wallNs / 1e6,
+              n / (res.wallNs / 1e9));
+  if (res.truncated) std::printf(", %zu cut at %d chars", res.truncated, STT_LINE_MAX);
+  std::printf("\n");
+  for (int s = 0; s < STAGES; ++s) {
+    std::printf("  %-9s p50 %8.2f us  p99 %8.2f us  max %8.2f us\n", kStageNames[s],
+                percentile(res.ns[s], 0.50) / 1e3, percentile(res.ns[s], 0.99) / 1e3,
+                *std::max_element(res.ns[s].begin(), res.ns[s].end()) / 1e3);
+  }
+  if (res.labeled) {
+    std::printf("  agreement %zu/%zu (%.1f%%)\n", res.agreed, res.labeled, 100.0 * res.agreed / res.labeled);
+  } else {
+    std::printf("  agreement n/a (unlabeled)\n");
+  }
+  for (const std::string &m : res.misses) std::printf("    %s\n", m.c_str());
+}
+
+// Whole-query latency in power-of-two microsecond buckets.
+void printHistogram(const std::vector<double> &ns) {
+  const int BUCKETS = 24;
+  size_t counts[BUCKETS] = {};
+  for (double v : ns) {
+    double us = v / 1e3;
+    int b = 0;
+    while (b < BUCKETS - 1 && us >= (double)(1u << b)) ++b;
+    ++counts[b];
+  }
+  int lo = 0, hi = BUCKETS - 1;
+  while (lo < hi && !counts[lo]) ++lo;
+  while (hi > lo && !counts[hi]) --hi;
+  size_t peak = *std::max_element(counts, counts + BUCKETS);
+  std::printf("total latency, all corpora (%zu queries):\n", ns.size());
+  for (int b = lo; b <= hi; ++b) {
+    int bar = peak ? (int)(50 * counts[b] / peak) : 0;
+    if (b == 0) std::printf("  %8s < %6u us  ", "", 1u);
+    else std::printf("  %6u - %6u us  ", 1u << (b - 1), 1u << b);
+    std::printf("%-50s %zu\n", std::string((size_t)bar, '#').c_str(), counts[b]);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::vector<std::string> specs;
+  unsigned repeat = 1;
+  double minAgreement = -1;
+  size_t maxMisses = 5;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--corpus=", 9) == 0) specs.push_back(argv[i] + 9);
+    else if (std::strncmp(argv[i], "--repeat=", 9) == 0) repeat = (unsigned)std::max(1, std::atoi(argv[i] + 9));
+    else if (std::strncmp(argv[i], "--min-agreement=", 16) == 0) minAgreement = std::atof(argv[i] + 16);
+    else if (std::strncmp(argv[i], "--misses=", 9) == 0) maxMisses = (size_t)std::atoi(argv[i] + 9);
+    else {
+      std::fprintf(stderr, "usage: %s [--corpus=faq|augmented|log|long|PATH]... [--repeat=N] "
+                           "[--min-agreement=F] [--misses=N]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (specs.empty()) specs = {"faq", "augmented", "log"};
+
+  std::vector<Corpus> corpora(specs.size());
+  for (size_t i = 0; i < specs.size(); ++i) {
+    if (!loadCorpus(specs[i], corpora[i])) {
+      std::fprintf(stderr, "no queries in corpus %s (set ADMISSION_REPO_DIR)\n", specs[i].c_str());
+      return 2;
+    }
+  }
+
+  host::setSerialOutputEnabled(false);
+  host::setRealtimeDelays(false);
+  setup();
+
+  std::vector<double> all;
+  size_t labeled = 0, agreed = 0;
+  for (const Corpus &corpus : corpora) {
+    Result res;
+    host::setSerialOutputEnabled(false);
+    replay(corpus, repeat, maxMisses, res);
+    host::setSerialOutputEnabled(true);
+    printResult(corpus, res);
+    all.insert(all.end(), res.ns[TOTAL].begin(), res.ns[TOTAL].end());
+    labeled += res.labeled;
+    agreed += res.agreed;
+  }
+  printHistogram(all);
+  std::fflush(stdout);
+
+  if (minAgreement >= 0 && labeled && (double)agreed / labeled < minAgreement) {
+    std::printf("agreement %.3f below --min-agreement=%.3f\n", (double)agreed / labeled, minAgreement);
+    return 1;
+  }
+  return 0;
+}
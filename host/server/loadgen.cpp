@@ -0,0 +1,222 @@
+// loadgen.cpp - Closed-loop load generator for QueryServer
+//
+// usage: admission_loadgen [--connect=ENDPOINT | --listen=ENDPOINT] [--max-threads=N]
+//                          [--clients=C] [--depth=D] [--seconds=S]
+//
+// C client threads (default 2N) each keep D pipelined queries in flight on
+// one connection, cycling through the FAQ questions and the augmented
+// training set, and check every response against an in-process
+// AdmissionModel. Without --connect it starts QueryServer itself, on a Unix
+// socket unless --listen says otherwise, with 1, 2, 4, ... N worker threads
+// in turn (N defaults to the hardware threads) and prints the throughput
+// scaling; with --connect it measures that one server. Exits non-zero on
+// any wrong or missing response.
+#include <Arduino.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "ml_model.h"
+#include "query_corpus.h"
+#include "query_server.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Request {
+  std::string line;       // query + '\n'
+  std::string category;   // what the server must answer
+};
+
+struct ClientResult {
+  uint64_t queries = 0;
+  uint64_t errors = 0;
+  std::vector<double> latencyUs;   // per query: batch send to its response
+};
+
+struct RunResult {
+  double qps = 0;
+  uint64_t queries = 0;
+  uint64_t errors = 0;
+  double p50Us = 0, p99Us = 0;
+};
+
+std::vector<Request> buildRequests() {
+  std::vector<LabeledQuery> queries = loadFaqCsv(repoPath("database/faq.csv"));
+  std::vector<LabeledQuery> augmented = loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json"));
+  queries.insert(queries.end(), augmented.begin(), augmented.end());
+  AdmissionModel model;
+  model.begin();
+  std::vector<Request> out;
+  for (const LabeledQuery &q : queries) {
+    if (q.text.find('\n') != std::string::npos) continue;
+    ClassificationResult r = model.classify(q.text.c_str(), q.text.size());
+    out.push_back({q.text + '\n', String(intentName(r.intent)).c_str()});
+  }
+  return out;
+}
+
+// Reads one '\n'-terminated line, buffering the rest; false on EOF or error.
+bool readLine(int fd, std::string &buf, std::string &line) {
+  size_t nl;
+  while ((nl = buf.find('\n')) == std::string::npos) {
+    char tmp[4096];
+    ssize_t n = recv(fd, tmp, sizeof(tmp), 0);
+    if (n <= 0) return false;
+    buf.append(tmp, (size_t)n);
+  }
+  line.assign(buf, 0, nl);
+  buf.erase(0, nl + 1);
+  return true;
+}
+
+void runClient(const std::string &endpoint, const std::vector<Request> &requests, size_t first, unsigned depth,
+               Clock::time_point deadline, ClientResult &res) {
+  int fd = connectQueryServer(endpoint);
+  if (fd < 0) {
+    ++res.errors;
+    return;
+  }
+  std::string batch, buf, line;
+  size_t next = first;
+  std::vector<size_t> inFlight(depth);
+  while (Clock::now() < deadline) {
+    batch.clear();
+    for (unsigned d = 0; d < depth; ++d) {
+      inFlight[d] = next;
+      batch += requests[next].line;
+      next = (next + 1) % requests.size();
+    }
+    auto sent = Clock::now();
+    if (send(fd, batch.data(), batch.size(), MSG_NOSIGNAL) != (ssize_t)batch.size()) {
+      ++res.errors;
+      break;
+    }
+    for (unsigned d = 0; d < depth; ++d) {
+      if (!readLine(fd, buf, line)) {
+        res.errors += depth - d;
+        close(fd);
+        return;
+      }
+      res.latencyUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - sent).count());
+      if (line.compare(0, line.find('\t'), requests[inFlight[d]].category) != 0) ++res.errors;
+      ++res.queries;
+    }
+  }
+  close(fd);
+}
+
+double percentile(std::vector<double> &v, double p) {
+  if (v.empty()) return 0;
+  size_t k = std::min(v.size() - 1, (size_t)(p * (double)(v.size() - 1) + 0.5));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+RunResult run(const std::string &endpoint, const std::vector<Request> &requests, unsigned clients, unsigned depth,
+              double seconds) {
+  std::vector<ClientResult> results(clients);
+  std::vector<std::thread> threads;
+  auto start = Clock::now();
+  auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+  for (unsigned i = 0; i < clients; ++i) {
+    size_t first = (size_t)i * requests.size() / clients;
+    threads.emplace_back(runClient, std::cref(endpoint), std::cref(requests), first, depth, deadline,
+                         std::ref(results[i]));
+  }
+  for (std::thread &t : threads) t.join();
+  double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+  RunResult rr;
+  std::vector<double> latency;
+  for (ClientResult &r : results) {
+    rr.queries += r.queries;
+    rr.errors += r.errors;
+    latency.insert(latency.end(), r.latencyUs.begin(), r.latencyUs.end());
+  }
+  rr.qps = rr.queries / elapsed;
+  rr.p50Us = percentile(latency, 0.50);
+  rr.p99Us = percentile(latency, 0.99);
+  return rr;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string endpoint, listen;
+  unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  unsigned clients = 0, depth = 8;
+  double seconds = 2.0;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--connect=", 10) == 0) endpoint = argv[i] + 10;
+    else if (std::strncmp(argv[i], "--listen=", 9) == 0) listen = argv[i] + 9;
+    else if (std::strncmp(argv[i], "--max-threads=", 14) == 0) maxThreads = (unsigned)std::max(1, std::atoi(argv[i] + 14));
+    else if (std::strncmp(argv[i], "--clients=", 10) == 0) clients = (unsigned)std::max(1, std::atoi(argv[i] + 10));
+    else if (std::strncmp(argv[i], "--depth=", 8) == 0) depth = (unsigned)std::max(1, std::atoi(argv[i] + 8));
+    else if (std::strncmp(argv[i], "--seconds=", 10) == 0) seconds = std::atof(argv[i] + 10);
+    else {
+      std::fprintf(stderr, "usage: %s [--connect=ENDPOINT | --listen=ENDPOINT] [--max-threads=N] [--clients=C] "
+                           "[--depth=D] [--seconds=S]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (!clients) clients = 2 * maxThreads;
+  host::setSerialOutputEnabled(false);
+  std::vector<Request> requests = buildRequests();
+  if (requests.empty()) {
+    std::fprintf(stderr, "no queries found (set ADMISSION_REPO_DIR)\n");
+    return 2;
+  }
+  std::printf("%zu queries, %u clients x %u in flight, %.1f s per run, %u hardware threads\n",
+              requests.size(), clients, depth, seconds, std::thread::hardware_concurrency());
+
+  uint64_t errors = 0, queries = 0;
+  if (!endpoint.empty()) {
+    RunResult r = run(endpoint, requests, clients, depth, seconds);
+    std::printf("%s: %.0f queries/s, p50 %.1f us, p99 %.1f us, %llu errors\n", endpoint.c_str(), r.qps, r.p50Us,
+                r.p99Us, (unsigned long long)r.errors);
+    errors = r.errors;
+    queries = r.queries;
+  } else {
+    std::vector<unsigned> steps;
+    for (unsigned t = 1; t < maxThreads; t *= 2) steps.push_back(t);
+    steps.push_back(maxThreads);
+    if (listen.empty()) listen = "unix:/tmp/admission_loadgen_" + std::to_string(getpid()) + ".sock";
+    std::printf("%8s %12s %8s %10s %10s %10s\n", "workers", "queries/s", "speedup", "efficiency", "p50 us",
+                "p99 us");
+    double base = 0;
+    for (unsigned t : steps) {
+      QueryServer server;
+      if (!server.start(listen, t)) {
+        std::fprintf(stderr, "cannot listen on %s\n", listen.c_str());
+        return 1;
+      }
+      RunResult r = run(server.endpoint(), requests, clients, depth, seconds);
+      QueryServerStats st = server.stats();
+      server.stop();
+      if (!base) base = r.qps;
+      std::printf("%8u %12.0f %7.2fx %9.0f%% %10.1f %10.1f\n", t, r.qps, r.qps / base, 100 * r.qps / base / t,
+                  r.p50Us, r.p99Us);
+      // Every answer the clients counted was produced by some worker.
+      if (st.queries < r.queries) ++r.errors;
+      errors += r.errors;
+      queries += r.queries;
+    }
+  }
+  if (errors || !queries) {
+    std::printf("FAIL: %llu wrong or missing responses\n", (unsigned long long)errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,341 @@
+// query_server.cpp - epoll thread pool around AdmissionModel and faqResponse()
+#include "query_server.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "faq_responder.h"
+#include "ml_model.h"
+
+// Bytes read per wakeup before the connection goes back to the pool, so one
+// busy client cannot hold a worker indefinitely.
+#define QUERY_SERVER_READ_BUDGET 65536
+
+struct QueryServer::Connection {
+  int fd;
+  std::string in;
+  std::string out;
+  size_t outPos = 0;
+  bool done = false;   // peer shut down or line too long: read no more, drain out
+
+  size_t pending() const { return out.size() - outPos; }
+  bool reading() const { return !done && pending() < QUERY_SERVER_OUT_HIGH_WATER; }
+};
+
+// Per-worker scratch for classifyBatch(), reused across wakeups.
+struct QueryServer::Batch {
+  std::vector<const char *> texts;
+  std::vector<size_t> lens;
+  std::vector<ClassificationResult> results;
+};
+
+namespace {
+
+// Tags for the two non-connection entries in the epoll set.
+char g_listenTag;
+char g_wakeTag;
+
+struct Endpoint {
+  bool unixSocket = false;
+  std::string host = "127.0.0.1";
+  uint16_t port = 0;
+  std::string path;
+};
+
+bool parseEndpoint(const std::string &spec, Endpoint &ep) {
+  if (spec.compare(0, 5, "unix:") == 0) {
+    ep.unixSocket = true;
+    ep.path = spec.substr(5);
+    return !ep.path.empty() && ep.path.size() < sizeof(sockaddr_un::sun_path);
+  }
+  if (spec.compare(0, 4, "tcp:") != 0) return false;
+  std::string rest = spec.substr(4);
+  size_t colon = rest.rfind(':');
+  if (colon != std::string::npos) {
+    ep.host = rest.substr(0, colon);
+    rest = rest.substr(colon + 1);
+  }
+  char *end = nullptr;
+  unsigned long port = std::strtoul(rest.c_str(), &end, 10);
+  if (rest.empty() || *end || port > 65535) return false;
+  ep.port = (uint16_t)port;
+  return true;
+}
+
+bool makeAddress(const Endpoint &ep, sockaddr_storage &addr, socklen_t &len) {
+  std::memset(&addr, 0, sizeof(addr));
+  if (ep.unixSocket) {
+    sockaddr_un *un = reinterpret_cast<sockaddr_un *>(&addr);
+    un->sun_family = AF_UNIX;
+    std::memcpy(un->sun_path, ep.path.c_str(), ep.path.size() + 1);
+    len = sizeof(sockaddr_un);
+    return true;
+  }
+  sockaddr_in *in = reinterpret_cast<sockaddr_in *>(&addr);
+  in->sin_family = AF_INET;
+  in->sin_port = htons(ep.port);
+  len = sizeof(sockaddr_in);
+  return inet_pton(AF_INET, ep.host.c_str(), &in->sin_addr) == 1;
+}
+
+bool setNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+void appendResponse(std::string &out, const ClassificationResult &r) {
+  char head[48];
+  int n = std::snprintf(head, sizeof(head), "%s\t%.3f\t", reinterpret_cast<const char *>(intentName(r.intent)),
+                        (double)r.confidence);
+  out.append(head, (size_t)n);
+  out += reinterpret_cast<const char *>(faqResponse(r.intent));
+  out += '\n';
+}
+
+} // namespace
+
+bool QueryServer::start(const std::string &spec, unsigned threads) {
+  if (m_running || threads == 0) return false;
+  Endpoint ep;
+  sockaddr_storage addr;
+  socklen_t len;
+  if (!parseEndpoint(spec, ep) || !makeAddress(ep, addr, len)) return false;
+
+  m_listen = socket(ep.unixSocket ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (m_listen < 0) return false;
+  if (ep.unixSocket) {
+    unlink(ep.path.c_str());
+  } else {
+    int one = 1;
+    setsockopt(m_listen, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  }
+  if (bind(m_listen, reinterpret_cast<sockaddr *>(&addr), len) != 0 || listen(m_listen, SOMAXCONN) != 0 ||
+      !setNonBlocking(m_listen)) {
+    ::close(m_listen);
+    m_listen = -1;
+    return false;
+  }
+  if (ep.unixSocket) {
+    m_unixPath = ep.path;
+    m_endpoint = spec;
+  } else {
+    sockaddr_in bound;
+    socklen_t boundLen = sizeof(bound);
+    getsockname(m_listen, reinterpret_cast<sockaddr *>(&bound), &boundLen);
+    m_endpoint = "tcp:" + ep.host + ":" + std::to_string(ntohs(bound.sin_port));
+  }
+
+  m_epoll = epoll_create1(EPOLL_CLOEXEC);
+  m_wake = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = &g_listenTag;
+  epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_listen, &ev);
+  // Level-triggered and never re-armed: wakes every worker once stopped.
+  ev.events = EPOLLIN;
+  ev.data.ptr = &g_wakeTag;
+  epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake, &ev);
+
+  m_counters.reset(new Counter[threads]);
+  m_connections = 0;
+  m_running = true;
+  for (unsigned i = 0; i < threads; ++i) m_workers.emplace_back(&QueryServer::work, this, i);
+  return true;
+}
+
+void QueryServer::stop() {
+  if (!m_running.exchange(false)) return;
+  uint64_t one = 1;
+  if (write(m_wake, &one, sizeof(one)) < 0) {
+    // The eventfd cannot be full; nothing else to do.
+  }
+  for (std::thread &t : m_workers) t.join();
+  m_workers.clear();
+  for (Connection *c : m_open) {
+    ::close(c->fd);
+    delete c;
+  }
+  m_open.clear();
+  ::close(m_listen);
+  ::close(m_wake);
+  ::close(m_epoll);
+  m_listen = m_wake = m_epoll = -1;
+  if (!m_unixPath.empty()) unlink(m_unixPath.c_str());
+  m_unixPath.clear();
+}
+
+QueryServerStats QueryServer::stats() const {
+  QueryServerStats st{m_connections, 0, {}};
+  for (size_t i = 0; i < m_workers.size() && m_counters; ++i) {
+    st.perThread.push_back(m_counters[i].queries.load(std::memory_order_relaxed));
+    st.queries += st.perThread.back();
+  }
+  return st;
+}
+
+void QueryServer::work(unsigned index) {
+  // AdmissionModel holds no mutable state after begin() (its tables are
+  // static const); one per worker keeps the request path free of sharing.
+  AdmissionModel model;
+  model.begin();
+  Batch batch;
+  Counter &counter = m_counters[index];
+  for (;;) {
+    epoll_event ev;
+    int n = epoll_wait(m_epoll, &ev, 1, -1);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0 || ev.data.ptr == &g_wakeTag) break;
+    if (ev.data.ptr == &g_listenTag) {
+      acceptAll();
+      continue;
+    }
+    Connection *c = static_cast<Connection *>(ev.data.ptr);
+    if (serve(*c, model, batch, counter)) rearm(*c);
+    else close(c);
+  }
+}
+
+void QueryServer::acceptAll() {
+  for (;;) {
+    int fd = accept4(m_listen, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) break;   // EAGAIN, or out of descriptors until a client leaves
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));   // fails harmlessly on Unix sockets
+    Connection *c = new Connection{fd, {}, {}, 0, false};
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_open.insert(c);
+    }
+    ++m_connections;
+    epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    ev.data.ptr = c;
+    epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &ev);
+  }
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = &g_listenTag;
+  epoll_ctl(m_epoll, EPOLL_CTL_MOD, m_listen, &ev);
+}
+
+bool QueryServer::serve(Connection &c, const AdmissionModel &model, Batch &batch, Counter &counter) {
+  // Past the high-water mark only write; rearm() stops asking for input.
+  size_t budget = c.reading() ? QUERY_SERVER_READ_BUDGET : 0;
+  bool eof = false;
+  char buf[4096];
+  while (budget > 0) {
+    ssize_t n = read(c.fd, buf, sizeof(buf));
+    if (n > 0) {
+      c.in.append(buf, (size_t)n);
+      budget -= std::min(budget, (size_t)n);
+    } else if (n == 0) {
+      eof = true;
+      break;
+    } else {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+      break;
+    }
+  }
+
+  // Answer every complete line, in order; at end of input the unterminated
+  // remainder is a line too.
+  batch.texts.clear();
+  batch.lens.clear();
+  size_t start = 0, nl;
+  while ((nl = c.in.find('\n', start)) != std::string::npos) {
+    size_t len = nl - start;
+    if (len && c.in[start + len - 1] == '\r') --len;
+    batch.texts.push_back(c.in.data() + start);
+    batch.lens.push_back(len);
+    start = nl + 1;
+  }
+  bool overlong = c.in.size() - start > QUERY_SERVER_MAX_LINE;
+  if (eof && !overlong && start < c.in.size()) {
+    size_t len = c.in.size() - start;
+    if (c.in.back() == '\r') --len;
+    batch.texts.push_back(c.in.data() + start);
+    batch.lens.push_back(len);
+    start = c.in.size();
+  }
+  uint64_t answered = batch.texts.size();
+  batch.results.resize(answered);
+  model.classifyBatch(batch.texts.data(), batch.lens.data(), answered, batch.results.data());
+  for (const ClassificationResult &r : batch.results) appendResponse(c.out, r);
+  c.in.erase(0, start);
+  counter.queries.fetch_add(answered, std::memory_order_relaxed);
+  if (overlong) c.out += "error\t0.000\tline too long\n";
+  if (eof || overlong) {
+    c.done = true;
+    c.in.clear();
+  }
+
+  while (c.outPos < c.out.size()) {
+    ssize_t n = send(c.fd, c.out.data() + c.outPos, c.out.size() - c.outPos, MSG_NOSIGNAL);
+    if (n > 0) {
+      c.outPos += (size_t)n;
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      break;   // rearm() waits for room
+    } else {
+      return false;
+    }
+  }
+  if (c.outPos == c.out.size()) {
+    c.out.clear();
+    c.outPos = 0;
+  } else if (c.outPos >= c.out.size() / 2) {
+    c.out.erase(0, c.outPos);   // keep the buffer near what is still unsent
+    c.outPos = 0;
+  }
+  return !c.done || c.pending() > 0;
+}
+
+void QueryServer::rearm(Connection &c) {
+  epoll_event ev = {};
+  ev.events = EPOLLONESHOT | (c.reading() ? (uint32_t)(EPOLLIN | EPOLLRDHUP) : 0u) |
+              (c.pending() ? (uint32_t)EPOLLOUT : 0u);
+  ev.data.ptr = &c;
+  epoll_ctl(m_epoll, EPOLL_CTL_MOD, c.fd, &ev);
+}
+
+void QueryServer::close(Connection *c) {
+  epoll_ctl(m_epoll, EPOLL_CTL_DEL, c->fd, nullptr);
+  ::close(c->fd);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_open.erase(c);
+  }
+  delete c;
+}
+
+int connectQueryServer(const std::string &spec) {
+  Endpoint ep;
+  sockaddr_storage addr;
+  socklen_t len;
+  if (!parseEndpoint(spec, ep) || !makeAddress(ep, addr, len)) return -1;
+  int fd = socket(ep.unixSocket ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) return -1;
+  if (connect(fd, reinterpret_cast<sockaddr *>(&addr), len) != 0) {
+    ::close(fd);
+    return -1;
+  }
+  if (!ep.unixSocket) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  }
+  return fd;
+}
@@ -0,0 +1,94 @@
+// query_server.h - Multi-threaded classifier/responder service for kiosk back-ends
+//
+// Serves the code/ classifier and FAQ responder over TCP or a Unix domain
+// socket. The protocol is line based: each request is one query terminated by
+// LF (CRLF accepted), each response one line
+//
+//   <category> TAB <confidence> TAB <answer> LF
+//
+// in request order, so clients may pipeline. A last query without its LF is
+// answered when the client shuts down its sending side; the connection is
+// closed once every response has been written. Worker threads share one epoll
+// set with one-shot connections: whichever worker wakes owns that connection
+// until it has answered every complete line read, so no connection is ever
+// served by two threads at once and there is no central request queue. Each
+// worker has its own AdmissionModel, read-only after begin(), and classifies
+// all the lines one read produced with a single classifyBatch(); nothing on
+// the request path is shared between workers except the epoll set.
+#ifndef HOST_QUERY_SERVER_H
+#define HOST_QUERY_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Longest request line; longer ones get an error response and the
+// connection is closed.
+#define QUERY_SERVER_MAX_LINE 4096
+// Unsent response bytes above which a connection is not read until the
+// client catches up, so a client that pipelines without reading cannot grow
+// the server's buffers without bound.
+#define QUERY_SERVER_OUT_HIGH_WATER (256 * 1024)
+
+class AdmissionModel;
+
+struct QueryServerStats {
+  uint64_t connections;               // accepted since start()
+  uint64_t queries;                   // answered, all workers
+  std::vector<uint64_t> perThread;    // answered by each worker
+};
+
+class QueryServer {
+ public:
+  ~QueryServer() { stop(); }
+
+  // Endpoints: "tcp:PORT" (loopback), "tcp:HOST:PORT", "unix:PATH". Port 0
+  // picks a free one; endpoint() reports it. Returns false if the socket
+  // cannot be bound.
+  bool start(const std::string &endpoint, unsigned threads);
+  void stop();   // closes every connection; idempotent
+  bool running() const { return m_running; }
+
+  std::string endpoint() const { return m_endpoint; }
+  unsigned threads() const { return (unsigned)m_workers.size(); }
+  QueryServerStats stats() const;
+
+ private:
+  struct Connection;
+  struct Batch;
+  struct alignas(64) Counter {
+    std::atomic<uint64_t> queries{0};
+  };
+
+  void work(unsigned index);
+  void acceptAll();
+  // Read, answer and write what is ready; false once the connection is done
+  // and every response has been sent.
+  bool serve(Connection &c, const AdmissionModel &model, Batch &batch, Counter &counter);
+  void rearm(Connection &c);
+  void close(Connection *c);
+
+  int m_listen = -1;
+  int m_epoll = -1;
+  int m_wake = -1;          // eventfd; readable once stop() is called
+  std::string m_endpoint;
+  std::string m_unixPath;   // removed on stop()
+  std::atomic<bool> m_running{false};
+  std::vector<std::thread> m_workers;
+  std::unique_ptr<Counter[]> m_counters;
+  std::atomic<uint64_t> m_connections{0};
+
+  std::mutex m_mutex;       // guards m_open (accept / close only)
+  std::unordered_set<Connection *> m_open;
+};
+
+// Connect to a QueryServer endpoint (same syntax as start()); -1 on failure.
+// The socket is blocking, with Nagle disabled for TCP.
+int connectQueryServer(const std::string &endpoint);
+
+#endif // HOST_QUERY_SERVER_H
@@ -0,0 +1,82 @@
+// server_main.cpp - Runs QueryServer until SIGINT / SIGTERM
+//
+// usage: admission_server [--listen=tcp:PORT|tcp:HOST:PORT|unix:PATH] [--threads=N] [--faq-db=PATH]
+//
+// Defaults: tcp:8090 on loopback, one worker per hardware thread. Prints the
+// bound endpoint once ready, and per-worker query counts on exit. --faq-db
+// maps an image from tools/gen_faq_db.py and answers from it instead of the
+// compiled-in table, so answers can change without rebuilding the server.
+#include <Arduino.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include <unistd.h>
+
+#include "faq_db.h"
+#include "faq_responder.h"
+#include "mapped_file.h"
+#include "query_server.h"
+
+namespace {
+
+volatile std::sig_atomic_t g_stop = 0;
+
+void onSignal(int) {
+  g_stop = 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string endpoint = "tcp:8090";
+  std::string faqDbPath;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--listen=", 9) == 0) endpoint = argv[i] + 9;
+    else if (std::strncmp(argv[i], "--threads=", 10) == 0) threads = (unsigned)std::max(1, std::atoi(argv[i] + 10));
+    else if (std::strncmp(argv[i], "--faq-db=", 9) == 0) faqDbPath = argv[i] + 9;
+    else {
+      std::fprintf(stderr, "usage: %s [--listen=tcp:PORT|tcp:HOST:PORT|unix:PATH] [--threads=N] [--faq-db=PATH]\n",
+                   argv[0]);
+      return 2;
+    }
+  }
+  // AdmissionModel::begin() logs to Serial; keep stdout for the server.
+  host::setSerialOutputEnabled(false);
+  MappedFile faqImage;
+  FaqDb faqDb;
+  if (!faqDbPath.empty()) {
+    if (!faqImage.open(faqDbPath) || !faqDb.attach(faqImage.data(), faqImage.size()) || !faqSetDatabase(&faqDb)) {
+      std::fprintf(stderr, "%s is not a FAQ image for these categories\n", faqDbPath.c_str());
+      return 1;
+    }
+    std::printf("answering from %s (%u FAQs, %u bytes)\n", faqDbPath.c_str(), (unsigned)faqDb.faqCount(),
+                (unsigned)faqDb.bytes());
+  }
+  std::signal(SIGINT, onSignal);
+  std::signal(SIGTERM, onSignal);
+
+  QueryServer server;
+  if (!server.start(endpoint, threads)) {
+    std::fprintf(stderr, "cannot listen on %s\n", endpoint.c_str());
+    return 1;
+  }
+  std::printf("listening on %s with %u worker threads\n", server.endpoint().c_str(), server.threads());
+  std::fflush(stdout);
+  while (!g_stop) pause();
+
+  QueryServerStats st = server.stats();
+  server.stop();
+  faqSetDatabase(nullptr);
+  std::printf("%llu queries on %llu connections\n", (unsigned long long)st.queries,
+              (unsigned long long)st.connections);
+  for (size_t i = 0; i < st.perThread.size(); ++i) {
+    std::printf("  worker %zu: %llu\n", i, (unsigned long long)st.perThread[i]);
+  }
+  return 0;
+}
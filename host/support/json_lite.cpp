@@ -0,0 +1,202 @@
+// json_lite.cpp - Minimal recursive-descent JSON reader
+#include "json_lite.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace jsonlite {
+
+const Value &Value::operator[](const std::string &key) const {
+  static const Value null;
+  if (type != Type::Object) return null;
+  auto it = object.find(key);
+  return it == object.end() ? null : it->second;
+}
+
+namespace {
+
+class Parser {
+ public:
+  explicit Parser(const std::string &text) : m_s(text) {}
+
+  bool document(Value &out) {
+    if (!value(out, 0)) return false;
+    skipWs();
+    return m_pos == m_s.size() || fail("trailing characters");
+  }
+
+  std::string error;
+
+ private:
+  static constexpr int kMaxDepth = 64;
+
+  bool fail(const char *what) {
+    if (error.empty()) error = std::string(what) + " at offset " + std::to_string(m_pos);
+    return false;
+  }
+
+  void skipWs() {
+    while (m_pos < m_s.size() && (m_s[m_pos] == ' ' || m_s[m_pos] == '\t' || m_s[m_pos] == '\n' || m_s[m_pos] == '\r')) ++m_pos;
+  }
+
+  bool literal(const char *word) {
+    size_t n = std::char_traits<char>::length(word);
+    if (m_s.compare(m_pos, n, word) != 0) return fail("invalid literal");
+    m_pos += n;
+    return true;
+  }
+
+  bool value(Value &out, int depth) {
+    if (depth > kMaxDepth) return fail("nesting too deep");
+    skipWs();
+    if (m_pos >= m_s.size()) return fail("unexpected end of input");
+    char c = m_s[m_pos];
+    if (c == '{') return object(out, depth);
+    if (c == '[') return array(out, depth);
+    if (c == '"') {
+      out.type = Value::Type::String;
+      return string(out.string);
+    }
+    if (c == 't') { out.type = Value::Type::Bool; out.boolean = true; return literal("true"); }
+    if (c == 'f') { out.type = Value::Type::Bool; out.boolean = false; return literal("false"); }
+    if (c == 'n') { out.type = Value::Type::Null; return literal("null"); }
+    return number(out);
+  }
+
+  bool number(Value &out) {
+    const char *begin = m_s.c_str() + m_pos;
+    char *end = nullptr;
+    out.number = std::strtod(begin, &end);
+    if (end == begin) return fail("invalid number");
+    out.type = Value::Type::Number;
+    m_pos += (size_t)(end - begin);
+    return true;
+  }
+
+  static void appendUtf8(std::string &out, unsigned cp) {
+    if (cp < 0x80) {
+      out += (char)cp;
+    } else if (cp < 0x800) {
+      out += (char)(0xC0 | (cp >> 6));
+      out += (char)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      out += (char)(0xE0 | (cp >> 12));
+      out += (char)(0x80 | ((cp >> 6) & 0x3F));
+      out += (char)(0x80 | (cp & 0x3F));
+    } else {
+      out += (char)(0xF0 | (cp >> 18));
+      out += (char)(0x80 | ((cp >> 12) & 0x3F));
+      out += (char)(0x80 | ((cp >> 6) & 0x3F));
+      out += (char)(0x80 | (cp & 0x3F));
+    }
+  }
+
+  bool hex4(unsigned &cp) {
+    if (m_pos + 4 > m_s.size()) return fail("truncated escape");
+    cp = (unsigned)std::strtoul(m_s.substr(m_pos, 4).c_str(), nullptr, 16);
+    m_pos += 4;
+    return true;
+  }
+
+  bool string(std::string &out) {
+    ++m_pos; // opening quote
+    out.clear();
+    while (m_pos < m_s.size()) {
+      char c = m_s[m_pos++];
+      if (c == '"') return true;
+      if (c != '\\') {
+        out += c;
+        continue;
+      }
+      if (m_pos >= m_s.size()) break;
+      char e = m_s[m_pos++];
+      switch (e) {
+        case '"': out += '"'; break;
+        case '\\': out += '\\'; break;
+        case '/': out += '/'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'n': out += '\n'; break;
+        case 'r': out += '\r'; break;
+        case 't': out += '\t'; break;
+        case 'u': {
+          unsigned cp = 0;
+          if (!hex4(cp)) return false;
+          if (cp >= 0xD800 && cp < 0xDC00 && m_s.compare(m_pos, 2, "\\u") == 0) {
+            unsigned lo = 0;
+            m_pos += 2;
+            if (!hex4(lo)) return false;
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+          }
+          appendUtf8(out, cp);
+          break;
+        }
+        default: return fail("invalid escape");
+      }
+    }
+    return fail("unterminated string");
+  }
+
+  bool array(Value &out, int depth) {
+    out.type = Value::Type::Array;
+    ++m_pos;
+    skipWs();
+    if (m_pos < m_s.size() && m_s[m_pos] == ']') { ++m_pos; return true; }
+    for (;;) {
+      out.array.emplace_back();
+      if (!value(out.array.back(), depth + 1)) return false;
+      skipWs();
+      if (m_pos < m_s.size() && m_s[m_pos] == ',') { ++m_pos; continue; }
+      if (m_pos < m_s.size() && m_s[m_pos] == ']') { ++m_pos; return true; }
+      return fail("expected ',' or ']'");
+    }
+  }
+
+  bool object(Value &out, int depth) {
+    out.type = Value::Type::Object;
+    ++m_pos;
+    skipWs();
+    if (m_pos < m_s.size() && m_s[m_pos] == '}') { ++m_pos; return true; }
+    for (;;) {
+      skipWs();
+      if (m_pos >= m_s.size() || m_s[m_pos] != '"') return fail("expected key");
+      std::string key;
+      if (!string(key)) return false;
+      skipWs();
+      if (m_pos >= m_s.size() || m_s[m_pos] != ':') return fail("expected ':'");
+      ++m_pos;
+      if (!value(out.object[key], depth + 1)) return false;
+      skipWs();
+      if (m_pos < m_s.size() && m_s[m_pos] == ',') { ++m_pos; continue; }
+      if (m_pos < m_s.size() && m_s[m_pos] == '}') { ++m_pos; return true; }
+      return fail("expected ',' or '}'");
+    }
+  }
+
+  const std::string &m_s;
+  size_t m_pos = 0;
+};
+
+} // namespace
+
+bool parse(const std::string &text, Value &out, std::string *error) {
+  Parser p(text);
+  out = Value();
+  bool ok = p.document(out);
+  if (!ok && error) *error = p.error;
+  return ok;
+}
+
+bool parseFile(const std::string &path, Value &out, std::string *error) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    if (error) *error = "cannot open " + path;
+    return false;
+  }
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return parse(ss.str(), out, error);
+}
+
+} // namespace jsonlite
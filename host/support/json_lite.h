@@ -0,0 +1,39 @@
+// json_lite.h - Minimal JSON reader for host tools (corpora, FAQ database)
+//
+// Parses a whole document into a small DOM. Intended for trusted, modest-size
+// repository files, not for untrusted input on the request path.
+#ifndef HOST_JSON_LITE_H
+#define HOST_JSON_LITE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace jsonlite {
+
+struct Value {
+  enum class Type { Null, Bool, Number, String, Array, Object };
+
+  Type type = Type::Null;
+  bool boolean = false;
+  double number = 0.0;
+  std::string string;
+  std::vector<Value> array;
+  std::map<std::string, Value> object;
+
+  bool isString() const { return type == Type::String; }
+  bool isArray() const { return type == Type::Array; }
+  bool isObject() const { return type == Type::Object; }
+
+  // Member lookup; returns a shared Null value when absent or not an object.
+  const Value &operator[](const std::string &key) const;
+};
+
+// Parse `text`; on failure returns false and describes the problem in `error`.
+bool parse(const std::string &text, Value &out, std::string *error = nullptr);
+bool parseFile(const std::string &path, Value &out, std::string *error = nullptr);
+
+} // namespace jsonlite
+
+#endif // HOST_JSON_LITE_H
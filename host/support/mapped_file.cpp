@@ -0,0 +1,29 @@
+// mapped_file.cpp - MappedFile over open/fstat/mmap
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MappedFile::open(const std::string &path) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return false;
+  struct stat st;
+  void *data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);   // the mapping keeps the file referenced
+  if (data == MAP_FAILED) return false;
+  m_data = data;
+  m_size = (size_t)st.st_size;
+  return true;
+}
+
+void MappedFile::close() {
+  if (m_data) munmap(m_data, m_size);
+  m_data = nullptr;
+  m_size = 0;
+}
@@ -0,0 +1,28 @@
+// mapped_file.h - Read-only mmap(2) of a whole file
+#ifndef HOST_MAPPED_FILE_H
+#define HOST_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// The host counterpart of a mapped flash partition: pages are read on first
+// touch, so opening costs the same whatever the file size.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile() { close(); }
+
+  bool open(const std::string &path);   // false if missing, empty or unmappable
+  void close();
+
+  const void *data() const { return m_data; }
+  size_t size() const { return m_size; }
+
+ private:
+  void *m_data = nullptr;
+  size_t m_size = 0;
+};
+
+#endif // HOST_MAPPED_FILE_H
@@ -0,0 +1,130 @@
+// query_corpus.cpp - Loaders for the repository's query data sets
+#include "query_corpus.h"
+
+#include <cstdlib>
+#include <fstream>
+
+#include "json_lite.h"
+
+#ifndef ADMISSION_REPO_DIR
+#define ADMISSION_REPO_DIR "."
+#endif
+
+std::string repoPath(const std::string &relative) {
+  const char *env = std::getenv("ADMISSION_REPO_DIR");
+  return std::string(env && *env ? env : ADMISSION_REPO_DIR) + "/" + relative;
+}
+
+// Split one RFC 4180 record (quoted fields, "" escapes, no embedded newlines).
+static std::vector<std::string> splitCsvLine(const std::string &line) {
+  std::vector<std::string> fields(1);
+  bool quoted = false;
+  for (size_t i = 0; i < line.size(); ++i) {
+    char c = line[i];
+    if (quoted) {
+      if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+        fields.back() += '"';
+        ++i;
+      } else if (c == '"') {
+        quoted = false;
+      } else {
+        fields.back() += c;
+      }
+    } else if (c == '"') {
+      quoted = true;
+    } else if (c == ',') {
+      fields.emplace_back();
+    } else if (c != '\r') {
+      fields.back() += c;
+    }
+  }
+  return fields;
+}
+
+std::vector<LabeledQuery> loadFaqCsv(const std::string &path) {
+  std::vector<LabeledQuery> out;
+  std::ifstream in(path);
+  std::string line;
+  if (!std::getline(in, line)) return out;
+  std::vector<std::string> header = splitCsvLine(line);
+  size_t qCol = header.size(), cCol = header.size();
+  for (size_t i = 0; i < header.size(); ++i) {
+    if (header[i] == "question") qCol = i;
+    if (header[i] == "category") cCol = i;
+  }
+  if (qCol == header.size()) return out;
+  while (std::getline(in, line)) {
+    if (line.empty()) continue;
+    std::vector<std::string> f = splitCsvLine(line);
+    if (f.size() <= qCol) continue;
+    out.push_back({f[qCol], cCol < f.size() ? f[cCol] : std::string()});
+  }
+  return out;
+}
+
+std::vector<LabeledQuery> loadProcessedDataset(const std::string &path) {
+  std::vector<LabeledQuery> out;
+  jsonlite::Value doc;
+  if (!jsonlite::parseFile(path, doc)) return out;
+  for (const jsonlite::Value &s : doc["samples"].array) {
+    if (s["text"].isString()) out.push_back({s["text"].string, s["label"].string});
+  }
+  return out;
+}
+
+std::vector<LabeledQuery> loadConversationLog(const std::string &path) {
+  std::vector<LabeledQuery> out;
+  jsonlite::Value doc;
+  if (!jsonlite::parseFile(path, doc)) return out;
+  for (const jsonlite::Value &turn : doc.array) {
+    if (turn["user_query"].isString()) out.push_back({turn["user_query"].string, turn["intent"].string});
+  }
+  return out;
+}
+
+std::vector<LabeledQuery> loadQueryLines(const std::string &path) {
+  std::vector<LabeledQuery> out;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty() || line[0] == '#') continue;
+    size_t tab = line.find('\t');
+    if (tab == std::string::npos) out.push_back({line, std::string()});
+    else out.push_back({line.substr(0, tab), line.substr(tab + 1)});
+  }
+  return out;
+}
+
+std::vector<LabeledQuery> syntheticLongUtterances(size_t count, size_t words, uint32_t seed) {
+  static const char *const kFiller[] = {
+    "um", "so", "i", "was", "wondering", "if", "you", "could", "tell", "me", "about", "the",
+    "university", "because", "my", "parents", "and", "friends", "keep", "asking", "whether",
+    "this", "year", "next", "semester", "really", "would", "like", "know", "more", "please"};
+  static const char *const kKeywords[] = {
+    "deadline", "last date", "fee", "payment", "documents", "certificates", "eligibility",
+    "requirements", "apply online", "application process", "scholarship", "programs", "classes start"};
+  const size_t nFiller = sizeof(kFiller) / sizeof(kFiller[0]);
+  const size_t nKeywords = sizeof(kKeywords) / sizeof(kKeywords[0]);
+
+  uint32_t state = seed ? seed : 1;
+  auto next = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  };
+
+  std::vector<LabeledQuery> out;
+  out.reserve(count);
+  for (size_t q = 0; q < count; ++q) {
+    std::string text;
+    for (size_t w = 0; w < words; ++w) {
+      if (!text.empty()) text += ' ';
+      text += next() % 12 == 0 ? kKeywords[next() % nKeywords] : kFiller[next() % nFiller];
+    }
+    text += '?';
+    out.push_back({text, std::string()});
+  }
+  return out;
+}
@@ -0,0 +1,33 @@
+// query_corpus.h - Query corpora for host benchmarks and replay tools
+#ifndef HOST_QUERY_CORPUS_H
+#define HOST_QUERY_CORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct LabeledQuery {
+  std::string text;
+  std::string label; // expected category; empty when unknown
+};
+
+// Root of the repository checkout (compiled in by CMake, overridable with
+// the ADMISSION_REPO_DIR environment variable).
+std::string repoPath(const std::string &relative);
+
+// database/faq.csv: question,answer,category
+std::vector<LabeledQuery> loadFaqCsv(const std::string &path);
+// ml_model/training/artifacts/processed_dataset.json: {"samples":[{text,label}]}
+std::vector<LabeledQuery> loadProcessedDataset(const std::string &path);
+// conversation_log.json: [{"user_query", "intent", ...}] as logged by the
+// Python prototype; its intents are that model's guesses, not ground truth.
+std::vector<LabeledQuery> loadConversationLog(const std::string &path);
+// Plain text: one query per line, optionally followed by a TAB and the
+// expected category. Blank lines and lines starting with '#' are skipped.
+std::vector<LabeledQuery> loadQueryLines(const std::string &path);
+// Long, rambling utterances built from filler words with FAQ keywords mixed
+// in, deterministic for a given seed. Labels are left empty.
+std::vector<LabeledQuery> syntheticLongUtterances(size_t count, size_t words, uint32_t seed = 1);
+
+#endif // HOST_QUERY_CORPUS_H
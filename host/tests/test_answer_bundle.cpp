@@ -0,0 +1,162 @@
+// test_answer_bundle.cpp - Pre-rendered FAQ answers played from a mapped partition
+//
+// usage: test_answer_bundle <answer_audio.bin> [endpoint-url]
+//
+// Maps the image built by tools/gen_answer_audio.py through the esp_partition
+// shim and checks that every answer faqResponse() can give is in it and
+// decodes, and that damaged images are refused. With an endpoint
+// (tools/stt_standin_server.py), TTSClient plays an FAQ answer from the
+// partition with the server unreachable, bit-exact, and still synthesizes
+// dynamic text over the network; request-to-speaker latency is reported for
+// both.
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <unistd.h>
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include <esp_partition.h>
+
+#include "answer_bundle.h"
+#include "faq_responder.h"
+#include "tts_cache.h"
+#include "tts_client.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+uint64_t answerKey(Intent intent) {
+  return TTSCache::key(String(faqResponse(intent)), TTS_VOICE);
+}
+
+// FNV-1a over the samples, so the speaker can be compared with the image.
+struct Digest {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  uint32_t samples = 0;
+  int16_t peak = 0;
+
+  void add(const int16_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      hash = (hash ^ (uint16_t)src[i]) * 0x100000001b3ULL;
+      if (abs(src[i]) > peak) peak = (int16_t)abs(src[i]);
+    }
+    samples += count;
+  }
+};
+
+Digest decodeAnswer(AnswerBundle &bundle, uint64_t key) {
+  Digest d;
+  if (!bundle.open(key)) return d;
+  AudioBuffer frame;
+  while (bundle.readFrame(frame)) d.add(frame.samples, frame.count);
+  bundle.close();
+  return d;
+}
+
+// The first `keep` bytes of the image with byte `at` set to `value`, mapped
+// as the answer partition.
+bool mountEdited(const std::vector<char> &image, const std::filesystem::path &path, size_t keep, size_t at,
+                 char value) {
+  std::vector<char> copy(image.begin(), image.begin() + keep);
+  if (at < copy.size()) copy[at] = value;
+  std::ofstream(path, std::ios::binary).write(copy.data(), (std::streamsize)copy.size());
+  host::partitionSetImage(ANSWER_BUNDLE_PARTITION, ANSWER_BUNDLE_SUBTYPE, path.c_str());
+  AnswerBundle bundle;
+  return bundle.begin();
+}
+
+void testImage(const char *path) {
+  std::ifstream in(path, std::ios::binary);
+  std::vector<char> image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  std::filesystem::path tmp =
+      std::filesystem::temp_directory_path() / ("answer_bundle_test_" + std::to_string(getpid()));
+  check(!image.empty() && !mountEdited(image, tmp, image.size(), 0, 'X'), "image with a bad magic is refused");
+  check(!mountEdited(image, tmp, image.size() / 2, image.size(), 0), "truncated image is refused");
+  std::filesystem::remove(tmp);
+
+  host::partitionSetImage(ANSWER_BUNDLE_PARTITION, ANSWER_BUNDLE_SUBTYPE, path);
+  AnswerBundle bundle;
+  check(bundle.begin(), "answer partition maps");
+  bool all = true, audible = true;
+  double seconds = 0;
+  for (uint8_t i = 0; i <= INTENT_COUNT; ++i) {
+    Digest d = decodeAnswer(bundle, answerKey((Intent)i));
+    all = all && d.samples > 0;
+    audible = audible && d.peak > 1000;
+    seconds += (double)d.samples / AUDIO_SAMPLE_RATE;
+  }
+  AnswerBundleStats st = bundle.stats();
+  std::printf("  %u answers, %.1f s of audio in %u bytes\n", st.entries, seconds, st.bytes);
+  check(all && st.entries == INTENT_COUNT + 1, "every FAQ answer is pre-rendered");
+  check(audible, "every answer decodes to audio");
+  check(!bundle.contains(TTSCache::key(String(faqResponse(Intent::Fee)), "other voice")) &&
+        !bundle.contains(TTSCache::key("Your appointment is at 3 pm.", TTS_VOICE)),
+        "other voices and dynamic text are not in the image");
+  bundle.end();
+}
+
+struct Speaker {
+  Digest digest;
+  uint32_t mismatches = 0;   // against the stand-in's counting pattern
+};
+
+void speakerSink(const int16_t *src, size_t count, void *ctx) {
+  Speaker &spk = *static_cast<Speaker *>(ctx);
+  for (size_t i = 0; i < count; ++i) {
+    if ((uint16_t)src[i] != (uint16_t)((spk.digest.samples + i) * 7919u)) ++spk.mismatches;
+  }
+  spk.digest.add(src, count);
+}
+
+void testClient(const char *image, const char *url) {
+  host::partitionSetImage(ANSWER_BUNDLE_PARTITION, ANSWER_BUNDLE_SUBTYPE, image);
+  Speaker spk;
+  host::i2sSetSink(I2S_NUM_1, speakerSink, &spk);
+  AudioIO io;
+  AnswerBundle bundle;
+  TTSClient tts;
+  // Nothing listens there: FAQ answers must not touch the network.
+  if (!io.begin(true) || !bundle.begin() || !tts.begin("http://127.0.0.1:1")) {
+    check(false, "audio, answer partition and TTS client start");
+    return;
+  }
+  tts.setBundle(&bundle);
+  Digest want = decodeAnswer(bundle, answerKey(Intent::Fee));
+  bool ok = tts.requestAndPlay(String(faqResponse(Intent::Fee)), io);
+  check(ok && spk.digest.samples == want.samples && spk.digest.hash == want.hash,
+        "FAQ answer plays from flash, no network");
+
+  tts.begin(url);
+  spk = Speaker();
+  ok = tts.requestAndPlay("Your appointment is at 3 pm.", io);
+  check(ok && spk.digest.samples > 0 && spk.mismatches == 0, "dynamic text is synthesized by the server");
+  tts.end();
+
+  const TTSMetrics &m = tts.metrics();
+  std::printf("  request-to-speaker: flash %u ms, network %u ms\n", m.bundled.lastMs, m.miss.lastMs);
+  check(m.bundled.count == 1 && m.miss.count == 1 && m.bundled.lastMs < m.miss.lastMs,
+        "pre-rendered answers reach the speaker sooner");
+  check(bundle.stats().hits == 2 && bundle.stats().misses == 1, "one lookup per request");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: %s <answer_audio.bin> [endpoint-url]\n", argv[0]);
+    return 2;
+  }
+  testImage(argv[1]);
+  if (argc > 2) testClient(argv[1], argv[2]);
+  return g_failures ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+// test_audio_codec.cpp - Audio codecs: size, round-trip SNR, per-frame decoding
+//
+// Encodes two seconds of a speech-band test signal (two tones plus noise, with
+// a loud and a quiet half) with every AudioCodec and decodes it with reference
+// G.711 / IMA-ADPCM decoders, decoding every IMA-ADPCM frame from its own
+// header as the stand-in server does. The same decoders are implemented in
+// tools/stt_standin_server.py; audioDecode(), used by the TTS cache, must
+// agree with them sample for sample.
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "audio_codec.h"
+
+namespace {
+
+const int16_t IMA_STEP[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+  253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+  3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+  11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+  32767,
+};
+const int IMA_INDEX_ADJUST[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+int16_t muLawDecode(uint8_t code) {
+  code = (uint8_t)~code;
+  int exponent = (code >> 4) & 7;
+  int magnitude = ((((code & 0x0f) << 3) + 0x84) << exponent) - 0x84;
+  return (int16_t)((code & 0x80) ? -magnitude : magnitude);
+}
+
+void decode(AudioCodec codec, const uint8_t *in, size_t bytes, std::vector<int16_t> &out) {
+  switch (codec) {
+    case AudioCodec::Pcm16:
+      for (size_t i = 0; i + 1 < bytes; i += 2) out.push_back((int16_t)(in[i] | (in[i + 1] << 8)));
+      break;
+    case AudioCodec::MuLaw:
+      for (size_t i = 0; i < bytes; ++i) out.push_back(muLawDecode(in[i]));
+      break;
+    case AudioCodec::ImaAdpcm: {
+      int predictor = (int16_t)(in[0] | (in[1] << 8));
+      int index = in[2];
+      for (size_t i = IMA_ADPCM_HEADER_BYTES; i < bytes; ++i) {
+        for (int nibble : {in[i] & 0x0f, in[i] >> 4}) {
+          int step = IMA_STEP[index];
+          int delta = step >> 3;
+          if (nibble & 4) delta += step;
+          if (nibble & 2) delta += step >> 1;
+          if (nibble & 1) delta += step >> 2;
+          predictor += (nibble & 8) ? -delta : delta;
+          predictor = predictor > 32767 ? 32767 : (predictor < -32768 ? -32768 : predictor);
+          index += IMA_INDEX_ADJUST[nibble & 7];
+          index = index < 0 ? 0 : (index > 88 ? 88 : index);
+          out.push_back((int16_t)predictor);
+        }
+      }
+      break;
+    }
+  }
+}
+
+int16_t testSignal(size_t n, uint32_t &noise) {
+  double t = (double)n / AUDIO_SAMPLE_RATE;
+  double level = n < AUDIO_SAMPLE_RATE ? 1.0 : 0.05; // -26 dB second half
+  noise = noise * 1103515245u + 12345u;
+  double v = 9000 * std::sin(2 * M_PI * 230 * t) + 4000 * std::sin(2 * M_PI * 1900 * t) +
+             (double)((int32_t)(noise >> 16) % 1000);
+  return (int16_t)(level * v);
+}
+
+} // namespace
+
+int main() {
+  const size_t frames = 2 * AUDIO_SAMPLE_RATE / AUDIO_FRAME_SAMPLES;
+  struct Case { AudioCodec codec; size_t frameBytes; double minSnrDb; };
+  const Case cases[] = {
+    {AudioCodec::Pcm16, 1024, 1e9},
+    {AudioCodec::MuLaw, 512, 30.0},
+    {AudioCodec::ImaAdpcm, 260, 20.0},
+  };
+
+  int failures = 0;
+  for (const Case &c : cases) {
+    AudioEncoder enc(c.codec);
+    AudioBuffer frame;
+    uint8_t encoded[AUDIO_ENCODED_MAX_BYTES];
+    uint32_t noise = 1;
+    size_t n = 0;
+    double signal = 0, error = 0;
+    bool sizeOk = true;
+    bool decoderOk = true;
+    for (size_t f = 0; f < frames; ++f) {
+      frame.count = AUDIO_FRAME_SAMPLES;
+      for (size_t i = 0; i < frame.count; ++i) frame.samples[i] = testSignal(n + i, noise);
+      size_t bytes = enc.encode(frame, encoded);
+      sizeOk &= bytes == c.frameBytes && bytes == audioEncodedSize(c.codec, frame.count);
+      std::vector<int16_t> decoded;
+      decode(c.codec, encoded, bytes, decoded);
+      sizeOk &= decoded.size() == frame.count;
+      int16_t device[AUDIO_FRAME_SAMPLES];
+      audioDecode(c.codec, encoded, frame.count, device);
+      decoderOk &= decoded.size() == frame.count && std::memcmp(device, decoded.data(), sizeof(device)) == 0;
+      for (size_t i = 0; i < frame.count && i < decoded.size(); ++i) {
+        double d = (double)decoded[i] - frame.samples[i];
+        signal += (double)frame.samples[i] * frame.samples[i];
+        error += d * d;
+      }
+      n += frame.count;
+    }
+    double snr = error > 0 ? 10 * std::log10(signal / error) : INFINITY;
+    bool ok = sizeOk && decoderOk && snr >= c.minSnrDb;
+    std::printf("%-9s %4zu B/frame  %.2f:1  SNR %6.1f dB  audioDecode %s  %s\n", audioCodecName(c.codec), c.frameBytes,
+                (double)AUDIO_FRAME_SAMPLES * 2 / (double)c.frameBytes, snr, decoderOk ? "matches" : "differs",
+                ok ? "ok" : "FAIL");
+    if (!ok) ++failures;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+// test_audio_pipeline.cpp - No audio is lost between I2S capture and a jittery uploader
+//
+// The I2S shim runs in realtime with the firmware's 4-buffer DMA ring, fed by a
+// sample counter. The upload function stands in for WiFi: a few ms per frame
+// with periodic 250 ms stalls, far longer than the DMA ring (128 ms) covers.
+// Every sample must arrive in order, and neither the DMA ring nor the frame
+// ring may overrun.
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+
+#include "audio_pipeline.h"
+
+namespace {
+
+std::atomic<uint32_t> g_nextSample{0};
+
+size_t counterSource(int16_t *dst, size_t count, void *) {
+  for (size_t i = 0; i < count; ++i) dst[i] = (int16_t)(g_nextSample++ & 0x7fff);
+  return count;
+}
+
+struct Receiver {
+  bool started = false;
+  uint16_t expected = 0;
+  uint32_t samples = 0;
+  uint32_t gaps = 0;
+  uint32_t frames = 0;
+};
+
+bool jitteryUpload(const AudioBuffer &frame, void *ctx) {
+  Receiver &rx = *static_cast<Receiver *>(ctx);
+  for (size_t i = 0; i < frame.count; ++i) {
+    uint16_t s = (uint16_t)frame.samples[i];
+    if (rx.started && s != rx.expected) ++rx.gaps;
+    rx.started = true;
+    rx.expected = (uint16_t)((s + 1) & 0x7fff);
+  }
+  rx.samples += frame.count;
+  ++rx.frames;
+  std::this_thread::sleep_for(std::chrono::milliseconds(rx.frames % 20 == 0 ? 250 : 8));
+  return true;
+}
+
+} // namespace
+
+int main() {
+  host::i2sSetSource(I2S_NUM_0, counterSource, nullptr);
+  AudioIO io;
+  if (!io.begin(false)) {
+    std::fprintf(stderr, "AudioIO::begin failed\n");
+    return 2;
+  }
+
+  Receiver rx;
+  AudioPipeline pipeline;
+  if (!pipeline.begin(io, jitteryUpload, &rx)) {
+    std::fprintf(stderr, "AudioPipeline::begin failed\n");
+    return 2;
+  }
+  pipeline.start();
+  delay(3000);
+  pipeline.stop();
+  AudioPipelineStats st = pipeline.stats();
+  pipeline.end();
+
+  uint64_t dmaDropped = host::i2sDroppedFrames(I2S_NUM_0);
+  std::printf("captured %u uploaded %u overruns %u max fill %u/%u, DMA dropped %llu, gaps %u, samples %u\n",
+              st.framesCaptured, st.framesUploaded, st.ringOverruns, st.maxFill, (unsigned)AUDIO_RING_FRAMES,
+              (unsigned long long)dmaDropped, rx.gaps, rx.samples);
+  bool ok = st.framesCaptured > 0 && st.framesUploaded == st.framesCaptured && st.ringOverruns == 0 &&
+            st.uploadErrors == 0 && dmaDropped == 0 && rx.gaps == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+// test_classify_batch.cpp - AdmissionModel::classifyBatch against per-query classify()
+//
+// Every corpus is classified both ways, in one batch and in odd-sized slices
+// that split lockstep groups and blocks unevenly; intent and confidence must
+// match classify() exactly, bit for bit.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "ml_model.h"
+#include "query_corpus.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+bool same(const ClassificationResult &a, const ClassificationResult &b) {
+  return a.intent == b.intent && std::memcmp(&a.confidence, &b.confidence, sizeof(float)) == 0;
+}
+
+// Classifies `queries` in slices of `slice` and compares with classify().
+size_t mismatches(const AdmissionModel &model, const std::vector<LabeledQuery> &queries, size_t slice) {
+  std::vector<const char *> texts;
+  std::vector<size_t> lens;
+  for (const LabeledQuery &q : queries) {
+    texts.push_back(q.text.data());
+    lens.push_back(q.text.size());
+  }
+  std::vector<ClassificationResult> got(queries.size());
+  for (size_t i = 0; i < queries.size(); i += slice) {
+    size_t n = std::min(slice, queries.size() - i);
+    model.classifyBatch(texts.data() + i, lens.data() + i, n, got.data() + i);
+  }
+  size_t bad = 0;
+  for (size_t i = 0; i < queries.size(); ++i) {
+    if (!same(got[i], model.classify(texts[i], lens[i]))) {
+      if (bad++ < 3) std::printf("  mismatch: \"%s\"\n", queries[i].text.c_str());
+    }
+  }
+  return bad;
+}
+
+} // namespace
+
+int main() {
+  host::setSerialOutputEnabled(false);
+  AdmissionModel model;
+  model.begin();
+
+  std::vector<LabeledQuery> faq = loadFaqCsv(repoPath("database/faq.csv"));
+  std::vector<LabeledQuery> augmented = loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json"));
+  std::vector<LabeledQuery> log = loadConversationLog(repoPath("conversation_log.json"));
+  if (faq.empty() || augmented.empty()) {
+    std::fprintf(stderr, "corpus not found (set ADMISSION_REPO_DIR)\n");
+    return 2;
+  }
+  std::vector<LabeledQuery> all = faq;
+  all.insert(all.end(), augmented.begin(), augmented.end());
+  all.insert(all.end(), log.begin(), log.end());
+  std::vector<LabeledQuery> longer = syntheticLongUtterances(100, 80);
+  all.insert(all.end(), longer.begin(), longer.end());
+  // Empty, one-byte and non-ASCII queries next to long ones in the same lanes.
+  for (const char *odd : {"", "a", "fee", "\xc3\xa9tudiant hostel?", "   ", "FEE STRUCTURE"}) {
+    all.push_back({odd, ""});
+  }
+
+  check(mismatches(model, all, all.size()) == 0, "one batch matches classify()");
+  check(mismatches(model, all, 1) == 0, "batches of 1 match classify()");
+  check(mismatches(model, all, 7) == 0, "batches of 7 match classify()");
+  check(mismatches(model, all, 65) == 0, "batches of 65 match classify()");
+
+  ClassificationResult sentinel{Intent::Greeting, 0.5f};
+  model.classifyBatch(nullptr, nullptr, 0, &sentinel);
+  check(sentinel.intent == Intent::Greeting && sentinel.confidence == 0.5f, "empty batch writes nothing");
+
+  std::printf("%zu queries\n", all.size());
+  return g_failures ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+// test_faq_db.cpp - Binary FAQ image mapped from a file and from a partition
+//
+// usage: test_faq_db <faq_db.bin>
+//
+// Maps the image built by tools/gen_faq_db.py and checks it against
+// database/faq.json and the compiled-in answers. faqResponse() must serve
+// the same text from inside the mapping once the image is installed, damaged
+// or mismatched images must be refused, and the esp_partition shim must
+// reach the same image through FaqDbPartition. Reports the cost of attach()
+// next to parsing faq.json.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "faq_answers.h"
+#include "faq_db.h"
+#include "faq_db_partition.h"
+#include "faq_responder.h"
+#include "json_lite.h"
+#include "mapped_file.h"
+#include "ml_model.h"
+#include "query_corpus.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+// A writable copy of the image, 4-byte aligned like a mapping.
+std::vector<uint32_t> copyImage(const MappedFile &file) {
+  std::vector<uint32_t> words((file.size() + 3) / 4);
+  std::memcpy(words.data(), file.data(), file.size());
+  return words;
+}
+
+bool attaches(const std::vector<uint32_t> &words, size_t size) {
+  FaqDb db;
+  return db.attach(words.data(), size);
+}
+
+void setWord(std::vector<uint32_t> &words, size_t byteOffset, uint32_t value) {
+  std::memcpy(reinterpret_cast<uint8_t *>(words.data()) + byteOffset, &value, sizeof(value));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: %s <faq_db.bin>\n", argv[0]);
+    return 2;
+  }
+  host::setSerialOutputEnabled(false);
+  MappedFile file;
+  if (!file.open(argv[1])) {
+    std::fprintf(stderr, "cannot map %s\n", argv[1]);
+    return 2;
+  }
+
+  FaqDb db;
+  auto t0 = Clock::now();
+  bool attached = db.attach(file.data(), file.size());
+  auto t1 = Clock::now();
+  check(attached, "image attaches");
+  check(db.verify(), "checksum matches");
+  check(db.categoryCount() == INTENT_COUNT + 1, "one category per intent, plus unknown");
+
+  // Every category answer is the compiled-in one, read from the mapping.
+  bool answersMatch = true, inImage = true, namesMatch = true;
+  for (uint8_t i = 0; i <= INTENT_COUNT; ++i) {
+    answersMatch &= std::strcmp(db.answer(i), FAQ_ANSWERS[i]) == 0;
+    inImage &= db.contains(db.answer(i));
+    namesMatch &= std::strcmp(db.categoryName(i), reinterpret_cast<const char *>(intentName((Intent)i))) == 0;
+  }
+  check(answersMatch, "answers match code/faq_answers.h");
+  check(inImage, "answers point into the mapping");
+  check(namesMatch, "category names match intentName()");
+  check(std::strcmp(db.answer(200), db.answer(INTENT_COUNT)) == 0, "out-of-range category reads as unknown");
+
+  // Every FAQ in faq.json, under its category, with its keywords.
+  auto t2 = Clock::now();
+  jsonlite::Value doc;
+  bool parsed = jsonlite::parseFile(repoPath("database/faq.json"), doc);
+  auto t3 = Clock::now();
+  const auto &faqs = doc["faqs"].array;
+  bool faqsMatch = parsed && db.faqCount() == faqs.size() && !faqs.empty();
+  for (const auto &f : faqs) {
+    int c = db.findCategory(f["category"].string.c_str());
+    bool found = false;
+    for (uint32_t i = db.firstFaq(c < 0 ? 0 : (uint16_t)c), n = 0; c >= 0 && n < db.faqsIn((uint16_t)c); ++i, ++n) {
+      FaqDbEntry e;
+      if (!db.entry(i, e) || e.id != (uint32_t)f["id"].number) continue;
+      found = std::strcmp(e.question, f["question"].string.c_str()) == 0 &&
+              std::strcmp(e.answer, f["answer"].string.c_str()) == 0 && e.category == c &&
+              e.keywordCount == f["keywords"].array.size();
+      for (uint16_t k = 0; found && k < e.keywordCount; ++k) {
+        found = f["keywords"].array[k].string == db.keyword(i, k);
+      }
+    }
+    faqsMatch &= found;
+  }
+  check(faqsMatch, "every faq.json entry, grouped by category");
+  check(db.findCategory("no_such_category") < 0, "unknown category name not found");
+
+  // faqResponse() serves from the installed image, then from flash again.
+  check(faqSetDatabase(&db), "image installs into the responder");
+  bool served = true;
+  for (uint8_t i = 0; i <= INTENT_COUNT; ++i) {
+    const char *text = reinterpret_cast<const char *>(faqResponse((Intent)i));
+    served &= db.contains(text) && std::strcmp(text, FAQ_ANSWERS[i]) == 0;
+  }
+  check(served, "faqResponse() answers from the mapping");
+  faqSetDatabase(nullptr);
+  check(!db.contains(faqResponse(Intent::Fee)), "uninstalled: back to the compiled-in table");
+
+  // Damaged or foreign images.
+  std::vector<uint32_t> words = copyImage(file);
+  size_t size = file.size();
+  check(!attaches(words, 16), "truncated header refused");
+  check(!attaches(words, size - 4), "truncated image refused");
+  std::vector<uint32_t> bad = words;
+  bad[0] ^= 1;
+  check(!attaches(bad, size), "bad magic refused");
+  bad = words;
+  setWord(bad, 8, 0x10000000);   // FAQ count far past the image
+  check(!attaches(bad, size), "tables past the string pool refused");
+  bad = words;
+  reinterpret_cast<uint8_t *>(bad.data())[size - 1] = 'x';
+  check(!attaches(bad, size), "unterminated string pool refused");
+  bad = words;
+  reinterpret_cast<uint8_t *>(bad.data())[size / 2] ^= 0x20;
+  FaqDb flipped;
+  check(flipped.attach(bad.data(), size) && !flipped.verify(), "flipped byte caught by verify()");
+  bad = words;
+  setWord(bad, 4, 1 | (INTENT_COUNT << 16));   // one category fewer than the firmware
+  FaqDb fewer;
+  check(fewer.attach(bad.data(), size) && !faqSetDatabase(&fewer), "image for other categories not installed");
+  const char *fee = reinterpret_cast<const char *>(faqResponse(Intent::Fee));
+  check(!fewer.contains(fee) && std::strcmp(fee, FAQ_ANSWERS[(uint8_t)Intent::Fee]) == 0,
+        "refused image leaves the table in place");
+
+  // The same image through the partition shim, as on the device.
+  FaqDbPartition part;
+  bool mapped = host::partitionSetImage(FAQ_DB_PARTITION, FAQ_DB_SUBTYPE, argv[1]) && part.begin();
+  check(mapped && part.db().faqCount() == db.faqCount() && part.db().verify(), "FaqDbPartition maps the partition");
+  check(mapped && std::strcmp(part.db().answer((uint8_t)Intent::Fee), FAQ_ANSWERS[(uint8_t)Intent::Fee]) == 0,
+        "answers readable from the partition");
+  part.end();
+
+  std::printf("%zu-byte image, %u FAQs: attach %.2f us, parsing faq.json %.2f us\n", file.size(),
+              (unsigned)db.faqCount(), std::chrono::duration<double, std::micro>(t1 - t0).count(),
+              std::chrono::duration<double, std::micro>(t3 - t2).count());
+  return g_failures ? 1 : 0;
+}
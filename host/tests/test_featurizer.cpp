@@ -0,0 +1,60 @@
+// test_featurizer.cpp - Bit-exact parity of HashedFeaturizer with the Python reference
+//
+// The golden vectors come from ml_model/training/hashed_features.py; any
+// difference in a single float bit means on-device and offline predictions can
+// disagree, so the comparison is on raw float32 bit patterns. Cases with a
+// "repeat" count feed their text that many times (long-input saturation).
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "featurizer.h"
+#include "json_lite.h"
+#include "query_corpus.h"
+
+int main(int argc, char **argv) {
+  std::string path = argc > 1 ? argv[1] : repoPath("ml_model/training/artifacts/featurizer_vectors.json");
+  jsonlite::Value doc;
+  std::string error;
+  if (!jsonlite::parseFile(path, doc, &error)) {
+    std::fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+    return 2;
+  }
+  if ((int)doc["input_size"].number != MODEL_INPUT_SIZE) {
+    std::fprintf(stderr, "golden vectors are %d wide, MODEL_INPUT_SIZE is %d\n",
+                 (int)doc["input_size"].number, MODEL_INPUT_SIZE);
+    return 1;
+  }
+
+  size_t failures = 0;
+  const auto &cases = doc["cases"].array;
+  for (const auto &c : cases) {
+    const std::string &text = c["text"].string;
+    size_t repeat = c["repeat"].number > 1 ? (size_t)c["repeat"].number : 1;
+    uint32_t expected[MODEL_INPUT_SIZE] = {};
+    for (const auto &nz : c["nonzero"].array) {
+      expected[(size_t)nz.array[0].number] = (uint32_t)std::strtoul(nz.array[1].string.c_str(), nullptr, 16);
+    }
+
+    // Exercise the streaming interface one byte at a time.
+    HashedFeaturizer f;
+    for (size_t r = 0; r < repeat; ++r) {
+      for (char ch : text) f.push((uint8_t)ch);
+    }
+    float out[MODEL_INPUT_SIZE];
+    f.finish(out);
+
+    for (size_t i = 0; i < MODEL_INPUT_SIZE; ++i) {
+      uint32_t bits;
+      std::memcpy(&bits, &out[i], sizeof(bits));
+      if (bits != expected[i]) {
+        std::fprintf(stderr, "mismatch \"%s\" [%zu]: got %08x want %08x\n", text.c_str(), i, bits, expected[i]);
+        ++failures;
+        break;
+      }
+    }
+  }
+  std::printf("%zu/%zu featurizer vectors match\n", cases.size() - failures, cases.size());
+  return failures ? 1 : 0;
+}
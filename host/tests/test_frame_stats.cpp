@@ -0,0 +1,80 @@
+// test_frame_stats.cpp - computeFrameStats matches a double-precision reference
+//
+// Random, extreme (full-scale -32768, alternating rails) and silent frames at
+// lengths around every vector width, from aligned and odd start addresses,
+// so the SIMD body, its tail and the scalar path are all compared.
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "frame_stats.h"
+
+namespace {
+
+struct Reference {
+  uint64_t sumSquares = 0;
+  int64_t sum = 0;
+  int peak = 0;
+  unsigned zeroCrossings = 0;
+  double rms = 0;
+  long dc = 0;
+};
+
+Reference reference(const int16_t *s, size_t n) {
+  Reference r;
+  double acc = 0;
+  for (size_t i = 0; i < n; ++i) {
+    r.sumSquares += (uint64_t)((int64_t)s[i] * s[i]);
+    r.sum += s[i];
+    r.peak = std::max(r.peak, std::abs((int)s[i]));
+    if (i > 0 && ((s[i] < 0) != (s[i - 1] < 0))) ++r.zeroCrossings;
+    acc += (double)s[i] * s[i];
+  }
+  if (n) {
+    r.rms = std::sqrt(acc / (double)n) / 32768.0;
+    r.dc = std::lround((double)r.sum / (double)n);
+  }
+  return r;
+}
+
+} // namespace
+
+int main() {
+  const size_t lengths[] = {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 255, 256, 257, 512, 513, 4099, 65535};
+  std::vector<int16_t> buf(65535 + 8);
+  uint32_t rng = 7;
+  int failures = 0, cases = 0;
+  for (int pattern = 0; pattern < 4; ++pattern) {
+    for (size_t i = 0; i < buf.size(); ++i) {
+      rng = rng * 1103515245u + 12345u;
+      switch (pattern) {
+        case 0: buf[i] = (int16_t)(rng >> 16); break;                           // full-range noise
+        case 1: buf[i] = -32768; break;                                         // worst case for squares
+        case 2: buf[i] = (i & 1) ? 32767 : -32768; break;                       // crossing every sample
+        default: buf[i] = (int16_t)(300 + (int32_t)((rng >> 16) % 41) - 20); break; // DC offset, no crossings
+      }
+    }
+    for (size_t n : lengths) {
+      for (size_t offset = 0; offset < 2; ++offset) {
+        const int16_t *s = buf.data() + offset;
+        FrameStats st = computeFrameStats(s, n);
+        Reference r = reference(s, n);
+        bool ok = st.sumSquares == r.sumSquares && st.sum == r.sum && st.peak == r.peak &&
+                  st.zeroCrossings == r.zeroCrossings && st.dc == r.dc && st.count == n &&
+                  std::fabs(st.rms - r.rms) <= 1e-6 * std::max(1.0, r.rms);
+        ++cases;
+        if (!ok) {
+          ++failures;
+          std::printf("pattern %d n=%zu offset %zu: sq %llu/%llu sum %d/%lld peak %u/%d zc %u/%u dc %d/%ld rms %.7f/%.7f\n",
+                      pattern, n, offset, (unsigned long long)st.sumSquares, (unsigned long long)r.sumSquares,
+                      st.sum, (long long)r.sum, st.peak, r.peak, st.zeroCrossings, r.zeroCrossings, st.dc, r.dc,
+                      st.rms, r.rms);
+        }
+      }
+    }
+  }
+  std::printf("%d/%d frame-stat cases match\n", cases - failures, cases);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,64 @@
+// test_neural_model.cpp - NeuralClassifier against the integer reference in Python
+//
+// The golden logits come from ml_model/training/train_int8_model.py, which
+// runs the same int8 arithmetic in exact integers: every logit must match. The
+// training set must also classify correctly through AdmissionModel, and the
+// layers must stay inside the static arena reserved in config.h.
+#include <cstdio>
+#include <string>
+
+#include "featurizer.h"
+#include "json_lite.h"
+#include "ml_model.h"
+#include "neural_model.h"
+#include "query_corpus.h"
+
+int main(int argc, char **argv) {
+  host::setSerialOutputEnabled(false);
+  std::string path = argc > 1 ? argv[1] : repoPath("ml_model/training/artifacts/neural_model_vectors.json");
+  jsonlite::Value doc;
+  std::string error;
+  if (!jsonlite::parseFile(path, doc, &error)) {
+    std::fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+    return 2;
+  }
+  if (doc["labels"].array.size() != NEURAL_NUM_LABELS) {
+    std::fprintf(stderr, "golden file has %zu labels, firmware has %d\n", doc["labels"].array.size(), NEURAL_NUM_LABELS);
+    return 1;
+  }
+
+  size_t failures = 0;
+  const auto &cases = doc["cases"].array;
+  for (const auto &c : cases) {
+    const std::string &text = c["text"].string;
+    float features[MODEL_INPUT_SIZE];
+    HashedFeaturizer::featurize(text.data(), text.size(), features);
+    int8_t z[NEURAL_NUM_LABELS];
+    NeuralClassifier::logits(features, z);
+    size_t wrong = 0;
+    for (size_t k = 0; k < NEURAL_NUM_LABELS; ++k) wrong += z[k] != (int)c["logits"].array[k].number;
+    if (wrong) {
+      std::fprintf(stderr, "mismatch \"%s\": %zu of %d logits differ\n", text.c_str(), wrong, NEURAL_NUM_LABELS);
+      ++failures;
+    }
+  }
+  std::printf("%zu/%zu queries match the integer reference\n", cases.size() - failures, cases.size());
+
+  AdmissionModel model;
+  model.begin();
+  std::vector<LabeledQuery> samples = loadProcessedDataset(repoPath("ml_model/training/artifacts/processed_dataset.json"));
+  size_t correct = 0;
+  for (const LabeledQuery &q : samples) {
+    ClassificationResult r = model.classifyNeural(q.text.data(), q.text.size());
+    correct += q.label == String(intentName(r.intent)).c_str();
+  }
+  bool accurate = !samples.empty() && correct == samples.size();
+  std::printf("training set through classifyNeural: %zu/%zu %s\n", correct, samples.size(), accurate ? "ok" : "FAIL");
+  if (!accurate) ++failures;
+
+  size_t used = NeuralClassifier::arenaUsedBytes();
+  bool fits = used > 0 && used <= NeuralClassifier::arenaSize();
+  std::printf("arena high-water mark %zu of %zu bytes: %s\n", used, NeuralClassifier::arenaSize(), fits ? "ok" : "FAIL");
+  if (!fits) ++failures;
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+// test_query_server.cpp - QueryServer end of input, overlong lines and back-pressure
+//
+// A client pipelines 20,001 queries, the last without its LF, shuts down its
+// sending side and only starts reading once everything is sent: every query
+// must be answered, in order, before the server closes. An overlong line
+// must still be preceded by the answers to the lines before it.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Arduino.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "ml_model.h"
+#include "query_server.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+// Sends `data`, then shuts down the sending side.
+void sendAll(int fd, const std::string &data) {
+  size_t pos = 0;
+  while (pos < data.size()) {
+    ssize_t n = send(fd, data.data() + pos, data.size() - pos, MSG_NOSIGNAL);
+    if (n <= 0) break;
+    pos += (size_t)n;
+  }
+  shutdown(fd, SHUT_WR);
+}
+
+// Every response line until the server closes.
+std::vector<std::string> readAll(int fd) {
+  std::string buf;
+  char tmp[4096];
+  ssize_t n;
+  while ((n = recv(fd, tmp, sizeof(tmp), 0)) > 0) buf.append(tmp, (size_t)n);
+  std::vector<std::string> lines;
+  size_t start = 0, nl;
+  while ((nl = buf.find('\n', start)) != std::string::npos) {
+    lines.push_back(buf.substr(start, nl - start));
+    start = nl + 1;
+  }
+  if (start < buf.size()) lines.push_back(buf.substr(start));   // unterminated: a failure below
+  return lines;
+}
+
+std::string category(const std::string &response) { return response.substr(0, response.find('\t')); }
+
+} // namespace
+
+int main() {
+  host::setSerialOutputEnabled(false);
+  AdmissionModel model;
+  model.begin();
+  const char *queries[] = {"What is the application fee?", "what documents do I need", "when is the deadline", "hello"};
+  const size_t kinds = sizeof(queries) / sizeof(queries[0]);
+
+  QueryServer server;
+  std::string endpoint = "unix:/tmp/test_query_server." + std::to_string(getpid()) + ".sock";
+  if (!server.start(endpoint, 2)) {
+    std::fprintf(stderr, "cannot listen on %s\n", endpoint.c_str());
+    return 2;
+  }
+
+  // Far more responses than fit the socket buffers: the server has to stop
+  // reading while the client is not, and pick up again once it is.
+  const size_t total = 20001;
+  std::string request;
+  for (size_t i = 0; i < total; ++i) {
+    request += queries[i % kinds];
+    if (i + 1 < total) request += '\n';
+  }
+  int fd = connectQueryServer(server.endpoint());
+  std::thread writer(sendAll, fd, request);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  std::vector<std::string> lines = readAll(fd);
+  writer.join();
+  close(fd);
+  bool inOrder = lines.size() == total;
+  for (size_t i = 0; inOrder && i < total; ++i) {
+    inOrder = category(lines[i]) == String(intentName(model.classify(String(queries[i % kinds])).intent)).c_str();
+  }
+  std::printf("%zu of %zu responses\n", lines.size(), total);
+  check(lines.size() == total, "every query answered, last one without LF");
+  check(inOrder, "answers in request order");
+
+  fd = connectQueryServer(server.endpoint());
+  sendAll(fd, "application fee\r");
+  lines = readAll(fd);
+  close(fd);
+  check(lines.size() == 1 && category(lines[0]) == "fee", "unterminated CRLF line answered at shutdown");
+
+  fd = connectQueryServer(server.endpoint());
+  std::thread longWriter(sendAll, fd, "hello\nwhen is the deadline\n" + std::string(QUERY_SERVER_MAX_LINE + 1, 'x'));
+  lines = readAll(fd);
+  longWriter.join();
+  close(fd);
+  check(lines.size() == 3 && category(lines[1]) == "deadline" && lines[2] == "error\t0.000\tline too long",
+        "overlong line: earlier answers, then the error");
+
+  fd = connectQueryServer(server.endpoint());
+  sendAll(fd, "");
+  check(readAll(fd).empty(), "empty connection closed without a response");
+  close(fd);
+
+  server.stop();
+  return g_failures ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+// test_stt_stream.cpp - STT transports against tools/stt_standin_server.py
+//
+// usage: test_stt_stream <endpoint-url> <expected-text> [frames] [--realtime]
+//                        [--codec=pcm_s16le|mulaw|ima_adpcm]
+//
+// Streams `frames` 32 ms frames over one connection (paced at the capture rate
+// with --realtime), checks the transcript and reports the time pushAudio()
+// spends per chunk. The server side prints throughput and lag. An http:// URL
+// uses the chunked-POST STTClient; a ws:// URL uses STTWebSocketClient, whose
+// partial transcripts are classified as they arrive to show how far ahead of
+// the final text the intent is known.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "ml_model.h"
+#include "stt_client.h"
+#include "stt_ws_client.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Transcripts {
+  const AdmissionModel *model;
+  std::vector<std::pair<Clock::time_point, Intent>> partials;
+  Clock::time_point finalAt;
+};
+
+void onTranscript(const String &text, bool final, void *ctx) {
+  auto *t = static_cast<Transcripts *>(ctx);
+  if (final) t->finalAt = Clock::now();
+  else t->partials.emplace_back(Clock::now(), t->model->classify(text).intent);
+}
+
+template <typename Client>
+int stream(Client &stt, const char *expected, int frames, bool realtime, AudioCodec codec) {
+  stt.setCodec(codec);
+  if (!stt.beginStream()) {
+    std::fprintf(stderr, "could not open stream\n");
+    return 1;
+  }
+  AudioBuffer frame;
+  frame.count = AUDIO_FRAME_SAMPLES;
+  std::vector<double> pushUs;
+  auto start = Clock::now();
+  for (int f = 0; f < frames; ++f) {
+    for (size_t i = 0; i < frame.count; ++i) {
+      frame.samples[i] = (int16_t)(8000 * std::sin(2 * M_PI * 440.0 * (double)(f * AUDIO_FRAME_SAMPLES + i) / AUDIO_SAMPLE_RATE));
+    }
+    if (realtime) {
+      std::this_thread::sleep_until(start + std::chrono::microseconds((int64_t)f * AUDIO_FRAME_SAMPLES * 1000000 / AUDIO_SAMPLE_RATE));
+    }
+    auto t0 = Clock::now();
+    if (!stt.pushAudio(frame)) {
+      std::fprintf(stderr, "pushAudio failed at frame %d\n", f);
+      return 1;
+    }
+    pushUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+  }
+
+  String text;
+  bool ok = stt.endStream(text);
+  std::sort(pushUs.begin(), pushUs.end());
+  std::printf("client: %u chunks, %u bytes, pushAudio p50 %.1f us p99 %.1f us, transcript \"%s\"\n",
+              stt.chunksSent(), stt.bytesSent(), pushUs[pushUs.size() / 2],
+              pushUs[(size_t)(0.99 * (double)(pushUs.size() - 1))], text.c_str());
+  return ok && text == expected ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "usage: %s <endpoint-url> <expected-text> [frames] [--realtime] [--codec=NAME]\n", argv[0]);
+    return 2;
+  }
+  int frames = 100;
+  bool realtime = false;
+  AudioCodec codec = AudioCodec::Pcm16;
+  for (int i = 3; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--realtime") == 0) {
+      realtime = true;
+    } else if (std::strncmp(argv[i], "--codec=", 8) == 0) {
+      const char *name = argv[i] + 8;
+      if (std::strcmp(name, audioCodecName(AudioCodec::MuLaw)) == 0) codec = AudioCodec::MuLaw;
+      else if (std::strcmp(name, audioCodecName(AudioCodec::ImaAdpcm)) == 0) codec = AudioCodec::ImaAdpcm;
+      else if (std::strcmp(name, audioCodecName(AudioCodec::Pcm16)) != 0) {
+        std::fprintf(stderr, "unknown codec %s\n", name);
+        return 2;
+      }
+    } else {
+      frames = std::atoi(argv[i]);
+    }
+  }
+  String url = argv[1];
+
+  if (!url.startsWith("ws://")) {
+    STTClient stt;
+    if (!stt.begin(url)) {
+      std::fprintf(stderr, "bad endpoint %s\n", argv[1]);
+      return 1;
+    }
+    return stream(stt, argv[2], frames, realtime, codec);
+  }
+
+  AdmissionModel model;
+  model.begin();
+  Transcripts transcripts{&model, {}, {}};
+  STTWebSocketClient stt;
+  stt.onTranscript(onTranscript, &transcripts);
+  if (!stt.begin(url)) {
+    std::fprintf(stderr, "bad endpoint %s\n", argv[1]);
+    return 1;
+  }
+  int rc = stream(stt, argv[2], frames, realtime, codec);
+  if (rc != 0) return rc;
+  if (transcripts.partials.empty()) {
+    std::fprintf(stderr, "no partial transcripts received\n");
+    return 1;
+  }
+  // Earliest partial after which the classified intent never changed again.
+  Intent finalIntent = model.classify(argv[2]).intent;
+  size_t settled = transcripts.partials.size();
+  while (settled > 0 && transcripts.partials[settled - 1].second == finalIntent) --settled;
+  std::printf("partials: %u, intent %s", stt.partialsReceived(), reinterpret_cast<const char *>(intentName(finalIntent)));
+  if (settled < transcripts.partials.size()) {
+    std::printf(" known from partial %zu, %.1f ms before the final text\n", settled + 1,
+                std::chrono::duration<double, std::milli>(transcripts.finalAt - transcripts.partials[settled].first).count());
+  } else {
+    std::printf(" only known from the final text\n");
+  }
+  return 0;
+}
@@ -0,0 +1,185 @@
+// test_tts_cache.cpp - Flash TTS answer cache: LRU eviction, persistence, hit path
+//
+// usage: test_tts_cache [endpoint-url]
+//
+// Runs TTSCache on the LittleFS shim (a temporary directory): answers decode
+// back to what was stored, the least recently used answer is evicted first,
+// the index and LRU order survive a reboot, and unfinished stores are cleaned
+// up. With an endpoint (tools/stt_standin_server.py), TTSClient synthesizes
+// an answer once, then plays it again from flash with the server unreachable,
+// and reports request-to-speaker latency for the miss and the hit.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <unistd.h>
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <driver/i2s.h>
+
+#include "tts_cache.h"
+#include "tts_client.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+const uint32_t ANSWER_FRAMES = 4;
+
+std::string indexBytes() {
+  std::string out;
+  File f = LittleFS.open(TTS_CACHE_DIR "/index", "r");
+  while (f && f.available()) out += (char)f.read();
+  return out;
+}
+
+void toneFrame(AudioBuffer &frame, uint32_t f, uint32_t seed) {
+  frame.count = AUDIO_FRAME_SAMPLES;
+  for (size_t i = 0; i < frame.count; ++i) {
+    double t = (double)(f * AUDIO_FRAME_SAMPLES + i) / AUDIO_SAMPLE_RATE;
+    frame.samples[i] = (int16_t)(6000 * std::sin(2 * M_PI * (200 + 40 * seed) * t));
+  }
+}
+
+bool store(TTSCache &cache, uint64_t key, uint32_t seed) {
+  if (!cache.beginStore(key)) return false;
+  AudioBuffer frame;
+  for (uint32_t f = 0; f < ANSWER_FRAMES; ++f) {
+    toneFrame(frame, f, seed);
+    cache.storeFrame(frame);
+  }
+  return cache.commitStore();
+}
+
+// SNR in dB of the cached answer against the original, or -1 if it is missing.
+double replaySnr(TTSCache &cache, uint64_t key, uint32_t seed) {
+  if (!cache.open(key)) return -1;
+  AudioBuffer got, want;
+  double signal = 0, error = 0;
+  uint32_t f = 0;
+  while (cache.readFrame(got)) {
+    toneFrame(want, f++, seed);
+    for (size_t i = 0; i < got.count; ++i) {
+      double d = (double)got.samples[i] - want.samples[i];
+      signal += (double)want.samples[i] * want.samples[i];
+      error += d * d;
+    }
+  }
+  cache.close();
+  if (f != ANSWER_FRAMES) return -1;
+  return error > 0 ? 10 * std::log10(signal / error) : 200;
+}
+
+void testCache() {
+  const uint64_t A = TTSCache::key("answer a", TTS_VOICE), B = TTSCache::key("answer b", TTS_VOICE),
+                 C = TTSCache::key("answer c", TTS_VOICE), D = TTSCache::key("answer d", TTS_VOICE),
+                 E = TTSCache::key("answer e", TTS_VOICE);
+  // Room for three ADPCM answers of four frames (16 B header + 4 x 260 B).
+  const uint32_t budget = 3 * (16 + ANSWER_FRAMES * 260) + 100;
+
+  {
+    // Left behind by a reset in the middle of a store.
+    File stale = LittleFS.open(TTS_CACHE_DIR "/00000000deadbeef.tmp", "w", true);
+    stale.print("partial");
+  }
+  TTSCache cache;
+  check(cache.begin(LittleFS, budget), "cache mounts on LittleFS");
+  check(!LittleFS.exists(TTS_CACHE_DIR "/00000000deadbeef.tmp"), "unfinished store removed at boot");
+  check(TTSCache::key("answer a", "other voice") != A, "voice settings are part of the key");
+
+  check(store(cache, A, 1) && store(cache, B, 2) && store(cache, C, 3), "three answers stored");
+  double snr = replaySnr(cache, A, 1);   // A becomes the most recently used
+  std::printf("  cached ADPCM answer replays at %.1f dB SNR\n", snr);
+  check(snr > 25, "cached answer decodes to what was stored");
+  check(store(cache, D, 4), "fourth answer stored");
+  TTSCacheStats st = cache.stats();
+  check(cache.contains(A) && !cache.contains(B) && cache.contains(C) && cache.contains(D) && st.evictions == 1,
+        "least recently used answer evicted");
+  check(st.bytes <= budget && st.entries == 3, "cache stays within its flash budget");
+  std::string index = indexBytes();
+  replaySnr(cache, C, 3);   // C overtakes A
+  check(indexBytes() == index, "a hit does not rewrite the index");
+  cache.end();
+  check(indexBytes() != index, "end() persists recency from hits");
+
+  TTSCache rebooted;
+  rebooted.begin(LittleFS, budget);
+  check(rebooted.contains(A) && rebooted.contains(C) && rebooted.contains(D) && rebooted.stats().bytes == st.bytes,
+        "index survives a reboot");
+  store(rebooted, E, 5);
+  check(!rebooted.contains(A) && rebooted.contains(C), "LRU order survives a reboot");
+  check(replaySnr(rebooted, B, 2) < 0 && rebooted.stats().misses == 1, "evicted answer is a miss");
+  rebooted.clear();
+  check(rebooted.stats().entries == 0 && rebooted.stats().bytes == 0 && !rebooted.contains(A),
+        "clear() empties the cache");
+}
+
+struct Speaker {
+  uint32_t samples = 0;
+  uint32_t mismatches = 0;
+};
+
+void speakerSink(const int16_t *src, size_t count, void *ctx) {
+  Speaker &spk = *static_cast<Speaker *>(ctx);
+  for (size_t i = 0; i < count; ++i, ++spk.samples) {
+    if ((uint16_t)src[i] != (uint16_t)(spk.samples * 7919u)) ++spk.mismatches;
+  }
+}
+
+void testClient(const char *url) {
+  Speaker spk;
+  host::i2sSetSink(I2S_NUM_1, speakerSink, &spk);
+  AudioIO io;
+  TTSCache cache;
+  TTSClient tts;
+  // PCM storage, so the stand-in's test pattern must come back bit-exact.
+  if (!io.begin(true) || !cache.begin(LittleFS, TTS_CACHE_MAX_BYTES, AudioCodec::Pcm16) || !tts.begin(url)) {
+    check(false, "audio, cache and TTS client start");
+    return;
+  }
+  tts.setCache(&cache);
+  const char *answer = "The application fee is fifty dollars.";
+
+  bool ok = tts.requestAndPlay(answer, io);
+  uint32_t missSamples = spk.samples, missBad = spk.mismatches;
+  check(ok && missSamples > 0 && missBad == 0 && cache.stats().stores == 1, "miss: synthesized, played and stored");
+
+  // Nothing listens there: a hit must not touch the network.
+  tts.begin("http://127.0.0.1:1");
+  spk = Speaker();
+  ok = tts.requestAndPlay(answer, io);
+  check(ok && spk.samples == missSamples && spk.mismatches == 0, "hit: same audio from flash, no network");
+
+  tts.setVoice("other voice");
+  check(!tts.requestAndPlay(answer, io), "another voice is not served from the cache");
+  tts.end();
+
+  const TTSMetrics &m = tts.metrics();
+  std::printf("  request-to-speaker: miss %u ms, hit %u ms (%u hit, %u miss)\n", m.miss.lastMs, m.hit.lastMs,
+              m.hit.count, m.miss.count);
+  check(m.hit.count == 1 && m.miss.count == 1 && m.hit.lastMs < m.miss.lastMs, "hits reach the speaker sooner");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::filesystem::path root = std::filesystem::temp_directory_path() / ("tts_cache_test_" + std::to_string(getpid()));
+  host::littleFsSetRoot(root.c_str());
+  if (!LittleFS.begin(true)) {
+    check(false, "LittleFS mounts");
+    return 1;
+  }
+  testCache();
+  if (argc > 1) testClient(argv[1]);
+  LittleFS.end();
+  std::filesystem::remove_all(root);
+  return g_failures ? 1 : 0;
+}
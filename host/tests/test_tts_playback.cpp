@@ -0,0 +1,89 @@
+// test_tts_playback.cpp - Streamed TTS playback against tools/stt_standin_server.py
+//
+// usage: test_tts_playback <endpoint-url> [--seconds=S] [--underruns=N]
+//
+// Plays one TTS response on the realtime I2S shim. The stand-in streams a
+// counting pattern at real time with per-chunk jitter (and optionally one long
+// stall); the speaker sink checks that every sample arrives exactly once and
+// in order. Expects N underruns (default 0: the jitter buffer absorbs the
+// jitter), each one seen by both PlaybackPipeline and the I2S shim.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+
+#include "tts_client.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+struct Speaker {
+  uint32_t samples = 0;
+  uint32_t mismatches = 0;
+};
+
+void speakerSink(const int16_t *src, size_t count, void *ctx) {
+  Speaker &spk = *static_cast<Speaker *>(ctx);
+  for (size_t i = 0; i < count; ++i, ++spk.samples) {
+    if ((uint16_t)src[i] != (uint16_t)(spk.samples * 7919u)) ++spk.mismatches;
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: %s <endpoint-url> [--seconds=S] [--underruns=N]\n", argv[0]);
+    return 2;
+  }
+  double seconds = 2.0;
+  uint32_t expectUnderruns = 0;
+  for (int i = 2; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--seconds=", 10) == 0) seconds = std::atof(argv[i] + 10);
+    else if (std::strncmp(argv[i], "--underruns=", 12) == 0) expectUnderruns = (uint32_t)std::atoi(argv[i] + 12);
+  }
+  const uint32_t expected = (uint32_t)(seconds * AUDIO_SAMPLE_RATE);
+
+  Speaker spk;
+  host::i2sSetSink(I2S_NUM_1, speakerSink, &spk);
+  AudioIO io;
+  TTSClient tts;
+  if (!io.begin(true) || !tts.begin(argv[1])) {
+    check(false, "audio and TTS client start");
+    return 1;
+  }
+  auto t0 = std::chrono::steady_clock::now();
+  bool ok = tts.requestAndPlay("what is the application fee", io);
+  double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  PlaybackStats st = tts.playbackStats();
+  double shimUnderrunMs = host::i2sUnderrunFrames(I2S_NUM_1) * 1000.0 / AUDIO_SAMPLE_RATE;
+  tts.end();
+
+  std::printf("  %u samples in %.0f ms, first audio after %u ms, %u frames, max fill %u/%u, %u producer waits\n",
+              spk.samples, elapsedMs, st.firstAudioMs, st.framesPlayed, st.maxFill, PLAYBACK_RING_FRAMES,
+              st.producerWaits);
+  std::printf("  underruns: %u (%u ms); I2S shim saw %.1f ms of silence\n", st.underruns, st.underrunMs,
+              shimUnderrunMs);
+  check(ok, "requestAndPlay succeeds");
+  check(spk.samples == expected && spk.mismatches == 0, "every sample played once, in order");
+  check(st.framesPlayed == (expected + AUDIO_FRAME_SAMPLES - 1) / AUDIO_FRAME_SAMPLES, "one I2S write per ring slot");
+  check(elapsedMs >= seconds * 1000, "returns once the speaker has finished");
+  check(st.underruns == expectUnderruns, expectUnderruns ? "the stall is one underrun, then playback recovers"
+                                                         : "jitter absorbed by the prefill: no underruns");
+  if (expectUnderruns) {
+    check(shimUnderrunMs > 0 && std::abs((double)st.underrunMs - shimUnderrunMs) < 25,
+          "underrun time matches the silence the DMA played");
+  } else {
+    check(shimUnderrunMs == 0, "the DMA never ran dry");
+  }
+  return g_failures ? 1 : 0;
+}
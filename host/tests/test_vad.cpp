@@ -0,0 +1,143 @@
+// test_vad.cpp - Energy VAD: onset, hangover, adaptive floor, and VAD-gated capture
+//
+// First drives VoiceActivityDetector with per-frame levels: speech with a
+// short pause must give one utterance ending exactly one hangover after the
+// last loud frame; a slowly rising background must not trigger; silence must
+// time out. Then runs AudioPipeline on the realtime I2S shim with a scripted
+// microphone (noise, 1.2 s of speech with a pause, noise): capture has to end
+// by itself one hangover after the speech, and only voiced frames may reach
+// the uploader.
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+
+#include "audio_pipeline.h"
+#include "vad.h"
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *what) {
+  std::printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) ++g_failures;
+}
+
+void testStateMachine() {
+  VoiceActivityDetector vad;
+  const VadConfig cfg = vad.config();
+  int started = -1, ended = -1, events = 0, frame = 0;
+  auto feed = [&](float level, int frames) {
+    for (int i = 0; i < frames; ++i, ++frame) {
+      VadEvent ev = vad.update(level);
+      if (ev == VadEvent::SpeechStart) { started = frame; ++events; }
+      if (ev != VadEvent::None && ev != VadEvent::SpeechStart) { ended = frame; ++events; }
+    }
+  };
+  feed(0.003f, 20);                     // frames 0-19: background
+  feed(0.05f, 15);                      // 20-34: speech
+  feed(0.003f, cfg.hangoverFrames - 3); // a pause shorter than the hangover
+  feed(0.05f, 15);
+  int lastLoud = frame - 1;
+  feed(0.003f, 40);
+  check(started == 20 + cfg.attackFrames - 1, "speech starts after the attack window");
+  check(ended == lastLoud + cfg.hangoverFrames, "one utterance, ends one hangover after the speech");
+  check(events == 2 && vad.done(), "pause inside the hangover does not split it");
+
+  // Background creeping up 4x over ~5 s (a fan spinning up) is tracked, not speech.
+  // The floor lags the ramp by about 1 / floorRise frames.
+  vad.reset();
+  VadConfig patient = cfg;
+  patient.noSpeechFrames = 1000;
+  vad.setConfig(patient);
+  bool falseStart = false;
+  for (int i = 0; i < 160; ++i) falseStart |= vad.update(0.003f * (1.0f + 3.0f * (float)i / 160)) == VadEvent::SpeechStart;
+  check(!falseStart && vad.noiseFloor() > 0.006f, "noise floor follows a slowly rising background");
+  bool startAbove = false;
+  for (int i = 0; i < 4; ++i) startAbove |= vad.update(0.06f) == VadEvent::SpeechStart;
+  check(startAbove, "speech still detected above the raised floor");
+
+  VoiceActivityDetector quiet;
+  VadEvent last = VadEvent::None;
+  int n = 0;
+  while (last == VadEvent::None && n < 1000) { last = quiet.update(0.001f); ++n; }
+  check(last == VadEvent::NoSpeech && n == cfg.noSpeechFrames, "silence times out after LISTEN_DURATION");
+}
+
+// Scripted microphone: 0.5 s noise, 0.5 s speech, 0.2 s pause, 0.5 s speech, noise.
+constexpr uint32_t MS = AUDIO_SAMPLE_RATE / 1000;
+constexpr uint32_t SPEECH_END = 1700 * MS;
+std::atomic<uint32_t> g_sample{0};
+uint32_t g_noise = 1;
+
+bool speaking(uint32_t n) {
+  return (n >= 500 * MS && n < 1000 * MS) || (n >= 1200 * MS && n < SPEECH_END);
+}
+
+size_t scriptedMic(int16_t *dst, size_t count, void *) {
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t n = g_sample++;
+    g_noise = g_noise * 1103515245u + 12345u;
+    double v = (double)((int32_t)(g_noise >> 16) % 120); // ~-52 dBFS hiss
+    if (speaking(n)) v += 3000 * std::sin(2 * M_PI * 180 * n / AUDIO_SAMPLE_RATE) * (0.6 + 0.4 * std::sin(2 * M_PI * 4 * n / AUDIO_SAMPLE_RATE));
+    dst[i] = (int16_t)v;
+  }
+  return count;
+}
+
+struct Uploaded {
+  std::atomic<uint32_t> frames{0};
+  std::atomic<uint32_t> speechFrames{0};
+};
+
+bool countUpload(const AudioBuffer &frame, void *ctx) {
+  Uploaded &up = *static_cast<Uploaded *>(ctx);
+  ++up.frames;
+  // A frame counts as speech if any part of it was scripted as speech.
+  uint32_t energy = 0;
+  for (size_t i = 0; i < frame.count; ++i) energy = max(energy, (uint32_t)std::abs(frame.samples[i]));
+  if (energy > 500) ++up.speechFrames;
+  return true;
+}
+
+void testGatedCapture() {
+  host::i2sSetSource(I2S_NUM_0, scriptedMic, nullptr);
+  AudioIO io;
+  Uploaded up;
+  AudioPipeline pipeline;
+  VoiceActivityDetector vad;
+  if (!io.begin(false) || !pipeline.begin(io, countUpload, &up)) {
+    check(false, "pipeline starts");
+    return;
+  }
+  pipeline.setVad(&vad);
+  g_sample = 0;
+  pipeline.start();
+  unsigned long t0 = millis();
+  while (!pipeline.utteranceEnded() && millis() - t0 < 5000) delay(5);
+  uint32_t endedAtMs = g_sample / MS;
+  pipeline.stop();
+  AudioPipelineStats st = pipeline.stats();
+  pipeline.end();
+
+  int32_t lagMs = (int32_t)endedAtMs - (int32_t)(SPEECH_END / MS);
+  std::printf("  ended %u ms into the stream (%d ms after speech), uploaded %u frames (%u speech), %u silent skipped\n",
+              endedAtMs, lagMs, up.frames.load(), up.speechFrames.load(), st.framesSilent);
+  check(pipeline.utteranceEnded() && pipeline.heardSpeech(), "capture ends by itself after speech");
+  check(lagMs >= VAD_HANGOVER_MS && lagMs < VAD_HANGOVER_MS + 4 * (int32_t)VAD_FRAME_MS + 100,
+        "end-of-utterance one hangover after the speaker stops");
+  check(up.frames == st.framesCaptured && up.frames - up.speechFrames <= (VAD_HANGOVER_MS + 200) / VAD_FRAME_MS + 2,
+        "only speech, the pause and the hangover are uploaded");
+  check(st.framesSilent >= 500 / VAD_FRAME_MS - 2, "leading silence is not uploaded");
+}
+
+} // namespace
+
+int main() {
+  testStateMachine();
+  testGatedCapture();
+  return g_failures ? 1 : 0;
+}
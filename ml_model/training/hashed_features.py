@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Hashed n-gram featurizer shared by training and the firmware.
+
+This is the reference for code/featurizer.cpp; both must produce bit-identical
+vectors so that offline and on-device predictions agree. The definition is
+deliberately simple and byte-oriented:
+
+  * The UTF-8 bytes of the text are scanned once. ASCII letters and digits
+    (letters folded to lower case) form tokens; every other byte separates them.
+  * Each token contributes its unigram, and each adjacent pair of tokens its
+    bigram "a b". Features are hashed with 32-bit FNV-1a. The bucket is
+    hash % MODEL_INPUT_SIZE and the sign is -1 when bit 31 is set, else +1.
+  * Bucket counts are integers that saturate at +-COUNT_MAX, one step at a
+    time, as the firmware's int16 counters do. The vector is L2-normalised in
+    IEEE float32: n = f32(sum c^2), with the exact integer sum (it fits in 64
+    bits), inv = f32(1 / f32(sqrt(n))), x_i = f32(c_i * inv).
+    Every float32 op is correctly rounded, so emulating each one in double and
+    rounding to float32 here gives exactly the C result.
+
+Run as a script to regenerate the golden vectors used by the host parity test.
+"""
+
+from __future__ import annotations
+import argparse, json, math, pathlib, struct
+from typing import Iterable, List
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent.parent
+ART_DIR = pathlib.Path(__file__).resolve().parent / 'artifacts'
+DATA_PATH = ART_DIR / 'processed_dataset.json'
+GOLDEN_PATH = ART_DIR / 'featurizer_vectors.json'
+
+MODEL_INPUT_SIZE = 128  # keep in sync with code/config.h
+COUNT_MAX = 32767       # FEATURE_COUNT_MAX in code/featurizer.h
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+def _f32(x: float) -> float:
+	return struct.unpack('<f', struct.pack('<f', x))[0]
+
+def _f32_bits(x: float) -> int:
+	return struct.unpack('<I', struct.pack('<f', x))[0]
+
+def _fnv(h: int, b: int) -> int:
+	return ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+
+def _is_token_byte(b: int) -> bool:
+	return 48 <= b <= 57 or 65 <= b <= 90 or 97 <= b <= 122
+
+def hashed_counts(text: str, size: int = MODEL_INPUT_SIZE) -> List[int]:
+	counts = [0] * size
+
+	def add(h):
+		i = h % size
+		if h & 0x80000000:
+			counts[i] = max(counts[i] - 1, -COUNT_MAX)
+		else:
+			counts[i] = min(counts[i] + 1, COUNT_MAX)
+
+	uni = FNV_OFFSET
+	bi = 0
+	prev = None      # hash of the previous token, if any
+	in_token = False
+	for b in text.encode('utf-8') + b' ':
+		if _is_token_byte(b):
+			if 65 <= b <= 90:
+				b += 32
+			if not in_token:
+				in_token = True
+				uni = FNV_OFFSET
+				if prev is not None:
+					bi = _fnv(prev, 0x20)
+			uni = _fnv(uni, b)
+			if prev is not None:
+				bi = _fnv(bi, b)
+		elif in_token:
+			in_token = False
+			add(uni)
+			if prev is not None:
+				add(bi)
+			prev = uni
+	return counts
+
+def featurize(text: str, size: int = MODEL_INPUT_SIZE) -> List[float]:
+	counts = hashed_counts(text, size)
+	n = _f32(float(sum(c * c for c in counts)))
+	if n == 0.0:
+		return [0.0] * size
+	inv = _f32(1.0 / _f32(math.sqrt(n)))
+	return [_f32(c * inv) for c in counts]
+
+class HashedNgramVectorizer:
+	"""scikit-learn compatible transformer wrapping featurize()."""
+
+	def __init__(self, n_features: int = MODEL_INPUT_SIZE):
+		self.n_features = n_features
+
+	def fit(self, X, y=None):
+		return self
+
+	def transform(self, X: Iterable[str]):
+		import numpy as np
+		return np.array([featurize(t, self.n_features) for t in X], dtype=np.float32)
+
+	def fit_transform(self, X, y=None):
+		return self.transform(X)
+
+	def get_params(self, deep=True):
+		return {'n_features': self.n_features}
+
+	def set_params(self, **params):
+		for k, v in params.items():
+			setattr(self, k, v)
+		return self
+
+EDGE_CASES = [
+	'',
+	'   ',
+	'?!',
+	'Fee',
+	'WHAT IS THE APPLICATION FEE???',
+	'last-date   to apply... 2026!',
+	'café naïve résumé deadline',
+	'tab\tseparated\nnew line words',
+	'a b c d e f g h i j k l m n o p q r s t u v w x y z 0 1 2 3 4 5 6 7 8 9',
+	'fee fee fee fee fee fee fee fee fee fee fee fee fee fee fee fee',
+]
+
+# (text, repeat): inputs long enough to saturate the counts and to overflow a
+# 32-bit sum of squares. Stored once with a repeat count, not expanded.
+LONG_CASES = [
+	('what is the application fee ', 40000),
+]
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description='Write golden featurizer vectors for the C++ parity test')
+	ap.add_argument('-o', '--output', type=pathlib.Path, default=GOLDEN_PATH)
+	args = ap.parse_args(argv)
+	with open(DATA_PATH, 'r', encoding='utf-8') as f:
+		texts = [s['text'] for s in json.load(f)['samples']]
+	cases = []
+	for text, repeat in [(t, 1) for t in EDGE_CASES + texts] + LONG_CASES:
+		vec = featurize(text * repeat)
+		# float32 bit patterns of the non-zero buckets keep the comparison exact
+		case = {'text': text, 'nonzero': [[i, '%08x' % _f32_bits(v)] for i, v in enumerate(vec) if v != 0.0]}
+		if repeat > 1:
+			case['repeat'] = repeat
+		cases.append(case)
+	lines = ',\n'.join('  ' + json.dumps(c, ensure_ascii=False) for c in cases)
+	args.output.write_text('{"input_size": %d, "cases": [\n%s\n]}\n' % (MODEL_INPUT_SIZE, lines), encoding='utf-8')
+	print(f'Wrote {len(cases)} vectors to {args.output}')
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Write golden logits for the firmware's linear scorer from scikit-learn itself.
+
+code/linear_model.cpp runs the pipeline exported by tools/export_linear_model.py.
+Its host test (host/tests/test_linear_model.cpp) compares against the
+decision_function() of the trained intent_pipeline.joblib, not against the
+exporter's own reading of the pickle, so a mistake in the export shows up as
+a mismatch. train_model.py calls this after training; run it by hand after
+replacing the pipeline any other way.
+"""
+
+from __future__ import annotations
+import argparse, json, pathlib
+
+import joblib
+import sklearn
+
+ART_DIR = pathlib.Path(__file__).resolve().parent / 'artifacts'
+DATA_PATH = ART_DIR / 'processed_dataset.json'
+MODEL_PATH = ART_DIR / 'intent_pipeline.joblib'
+GOLDEN_PATH = ART_DIR / 'linear_model_vectors.json'
+
+# Inputs beyond the training set that stress the tokenizer
+EDGE_CASES = [
+	'',
+	'a b c',
+	'FEE?',
+	'What is the application fee???',
+	'please, kindly: when do classes start',
+	'is there any financial aid_available',
+	"what's the deadline for 2026",
+	'fee fee fee fee fee fee fee fee fee fee fee fee fee fee fee fee',
+]
+
+def long_cases(texts):
+	"""Text far past the device's STT_LINE_MAX, with most of the vocabulary in it."""
+	return [' '.join(texts), ' '.join(reversed(texts)), ' '.join(texts[::3]) * 4]
+
+def write_golden(pipe, labels, texts, path=GOLDEN_PATH):
+	clf = pipe.steps[-1][1]
+	names = [labels[c] for c in clf.classes_]
+	scores = pipe.decision_function(texts)
+	cases = []
+	for text, z in zip(texts, scores):
+		z = [float(v) for v in z]
+		cases.append({'text': text, 'label': max(range(len(z)), key=z.__getitem__), 'logits': [round(v, 9) for v in z]})
+	lines = ',\n'.join('  ' + json.dumps(c, ensure_ascii=False) for c in cases)
+	source = f'scikit-learn {sklearn.__version__} decision_function'
+	path.write_text('{"source": %s, "labels": %s, "cases": [\n%s\n]}\n' % (json.dumps(source), json.dumps(names), lines),
+		encoding='utf-8')
+	print(f'Wrote {len(cases)} golden logit vectors to {path}')
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--model', type=pathlib.Path, default=MODEL_PATH)
+	ap.add_argument('-o', '--output', type=pathlib.Path, default=GOLDEN_PATH)
+	args = ap.parse_args(argv)
+	bundle = joblib.load(args.model)
+	with open(DATA_PATH, 'r', encoding='utf-8') as f:
+		texts = [s['text'] for s in json.load(f)['samples']]
+	write_golden(bundle['pipeline'], bundle['labels'], EDGE_CASES + texts + long_cases(texts), args.output)
+
+if __name__ == '__main__':
+	main()
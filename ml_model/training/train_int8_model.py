@@ -0,0 +1,324 @@
+#!/usr/bin/env python3
+"""Train the int8 neural intent model and export it for code/neural_model.cpp.
+
+The network is hashed features (hashed_features.py, MODEL_INPUT_SIZE buckets)
+-> fully connected + ReLU (MODEL_HIDDEN_SIZE) -> fully connected logits, one
+per label. It is trained in float with plain Python (Adam, softmax
+cross-entropy, fixed seed), so neither numpy nor TensorFlow is needed and
+reruns give the same weights. It is then quantized the way TFLite Micro's
+int8 kernels run a model:
+
+  * input x_q = round(x * 127), zero point 0 (features are in [-1, 1])
+  * weights per-tensor symmetric int8, biases int32 at input_scale * w_scale
+  * activations int8 with a zero point; the ReLU is folded into the clamp
+  * requantization by an integer multiplier and shift,
+    (acc * M + 2^(S-1)) >> S, computed in 64 bits
+
+and emitted as code/neural_model_data.h/.cpp. The integer forward pass below
+is the reference for the firmware: artifacts/neural_model_vectors.json holds
+its int8 logits for the host parity test (host/tests/test_neural_model.cpp),
+which must match exactly.
+"""
+
+from __future__ import annotations
+import argparse, json, math, pathlib, random, struct, sys
+
+from hashed_features import EDGE_CASES, MODEL_INPUT_SIZE, featurize
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent.parent
+ART_DIR = pathlib.Path(__file__).resolve().parent / 'artifacts'
+DATA_PATH = ART_DIR / 'processed_dataset.json'
+GOLDEN_PATH = ART_DIR / 'neural_model_vectors.json'
+OUT_DIR = ROOT / 'code'
+
+MODEL_HIDDEN_SIZE = 32  # keep in sync with code/config.h
+MODEL_OUTPUT_SIZE = 10
+SEED = 7
+EPOCHS = 300
+LEARNING_RATE = 0.01
+L2 = 1e-4
+
+def _f32(x: float) -> float:
+	return struct.unpack('<f', struct.pack('<f', x))[0]
+
+# ---------------------------------------------------------------------------
+# Float training
+# ---------------------------------------------------------------------------
+def _sparse(vec):
+	return [(i, v) for i, v in enumerate(vec) if v != 0.0]
+
+def _forward(net, x):
+	w1, b1, w2, b2 = net
+	h = list(b1)
+	for i, v in x:
+		for j in range(len(h)):
+			h[j] += v * w1[j][i]
+	h = [max(0.0, v) for v in h]
+	z = [b2[k] + sum(w * v for w, v in zip(w2[k], h)) for k in range(len(b2))]
+	return h, z
+
+def _softmax(z):
+	m = max(z)
+	e = [math.exp(v - m) for v in z]
+	s = sum(e)
+	return [v / s for v in e]
+
+def train(xs, ys, n_labels):
+	rng = random.Random(SEED)
+	lim1 = math.sqrt(6.0 / (MODEL_INPUT_SIZE + MODEL_HIDDEN_SIZE))
+	lim2 = math.sqrt(6.0 / (MODEL_HIDDEN_SIZE + n_labels))
+	net = [
+		[[rng.uniform(-lim1, lim1) for _ in range(MODEL_INPUT_SIZE)] for _ in range(MODEL_HIDDEN_SIZE)],
+		[0.0] * MODEL_HIDDEN_SIZE,
+		[[rng.uniform(-lim2, lim2) for _ in range(MODEL_HIDDEN_SIZE)] for _ in range(n_labels)],
+		[0.0] * n_labels,
+	]
+	# Adam state, flattened per parameter tensor
+	flat = lambda t: [v for row in t for v in row] if isinstance(t[0], list) else list(t)
+	m = [[0.0] * len(flat(t)) for t in net]
+	v = [[0.0] * len(flat(t)) for t in net]
+	b1_, b2_, eps = 0.9, 0.999, 1e-8
+	for epoch in range(1, EPOCHS + 1):
+		g1 = [[0.0] * MODEL_INPUT_SIZE for _ in range(MODEL_HIDDEN_SIZE)]
+		gb1 = [0.0] * MODEL_HIDDEN_SIZE
+		g2 = [[0.0] * MODEL_HIDDEN_SIZE for _ in range(n_labels)]
+		gb2 = [0.0] * n_labels
+		for x, y in zip(xs, ys):
+			h, z = _forward(net, x)
+			dz = _softmax(z)
+			dz[y] -= 1.0
+			dh = [0.0] * MODEL_HIDDEN_SIZE
+			for k in range(n_labels):
+				gb2[k] += dz[k]
+				for j in range(MODEL_HIDDEN_SIZE):
+					g2[k][j] += dz[k] * h[j]
+					dh[j] += dz[k] * net[2][k][j]
+			for j in range(MODEL_HIDDEN_SIZE):
+				if h[j] <= 0.0:
+					continue
+				gb1[j] += dh[j]
+				for i, xv in x:
+					g1[j][i] += dh[j] * xv
+		n = float(len(xs))
+		grads = [g1, gb1, g2, gb2]
+		for t, (param, grad) in enumerate(zip(net, grads)):
+			decay = L2 if t in (0, 2) else 0.0
+			p, g = flat(param), flat(grad)
+			for i in range(len(p)):
+				gi = g[i] / n + decay * p[i]
+				m[t][i] = b1_ * m[t][i] + (1 - b1_) * gi
+				v[t][i] = b2_ * v[t][i] + (1 - b2_) * gi * gi
+				mh = m[t][i] / (1 - b1_ ** epoch)
+				vh = v[t][i] / (1 - b2_ ** epoch)
+				p[i] -= LEARNING_RATE * mh / (math.sqrt(vh) + eps)
+			if isinstance(param[0], list):
+				cols = len(param[0])
+				net[t] = [p[r * cols:(r + 1) * cols] for r in range(len(param))]
+			else:
+				net[t] = p
+	return net
+
+# ---------------------------------------------------------------------------
+# Quantization and the integer reference
+# ---------------------------------------------------------------------------
+def quantize_multiplier(real):
+	"""real ~= M / 2^S with M in [2^30, 2^31)."""
+	if not 0.0 < real < 1.0:
+		raise SystemExit(f'requantization scale {real} out of range')
+	shift = 31
+	while real * (1 << shift) < (1 << 30):
+		shift += 1
+	mult = int(round(real * (1 << shift)))
+	if mult == 1 << 31:
+		mult //= 2
+		shift -= 1
+	return mult, shift
+
+def requantize(acc, mult, shift):
+	return (acc * mult + (1 << (shift - 1))) >> shift
+
+def _clamp(v, lo, hi):
+	return lo if v < lo else hi if v > hi else v
+
+def quantize_input(vec):
+	out = []
+	for x in vec:
+		p = _f32(x * 127.0)   # x * 127.0f in the firmware
+		q = int(math.floor(abs(p) + 0.5))   # lroundf: half away from zero
+		out.append(_clamp(q if p >= 0 else -q, -127, 127))
+	return out
+
+def quantize(net, xs):
+	w1, b1, w2, b2 = net
+	in_scale = 1.0 / 127.0
+	w1_scale = max(abs(v) for row in w1 for v in row) / 127.0
+	w2_scale = max(abs(v) for row in w2 for v in row) / 127.0
+	# Activation ranges from the training set (post-training calibration)
+	hmax, zmin, zmax = 0.0, 0.0, 0.0
+	for x in xs:
+		h, z = _forward(net, x)
+		hmax = max(hmax, max(h))
+		zmin, zmax = min(zmin, min(z)), max(zmax, max(z))
+	h_scale, h_zero = hmax / 255.0, -128
+	z_scale = (zmax - zmin) / 255.0
+	z_zero = _clamp(int(round(-128 - zmin / z_scale)), -128, 127)
+	q = {
+		'w1': [[_clamp(int(round(v / w1_scale)), -127, 127) for v in row] for row in w1],
+		'b1': [int(round(v / (in_scale * w1_scale))) for v in b1],
+		'w2': [[_clamp(int(round(v / w2_scale)), -127, 127) for v in row] for row in w2],
+		'b2': [int(round(v / (h_scale * w2_scale))) for v in b2],
+		'h_zero': h_zero,
+		'z_zero': z_zero,
+		'z_scale': z_scale,
+	}
+	q['m1'], q['s1'] = quantize_multiplier(in_scale * w1_scale / h_scale)
+	q['m2'], q['s2'] = quantize_multiplier(h_scale * w2_scale / z_scale)
+	return q
+
+def int8_logits(q, features):
+	x = quantize_input(features)
+	h = []
+	for row, bias in zip(q['w1'], q['b1']):
+		acc = bias + sum(w * v for w, v in zip(row, x))
+		h.append(_clamp(requantize(acc, q['m1'], q['s1']) + q['h_zero'], q['h_zero'], 127))
+	z = []
+	for row, bias in zip(q['w2'], q['b2']):
+		acc = bias + sum(w * (v - q['h_zero']) for w, v in zip(row, h))
+		z.append(_clamp(requantize(acc, q['m2'], q['s2']) + q['z_zero'], -128, 127))
+	return z
+
+def _argmax(z):
+	return max(range(len(z)), key=z.__getitem__)
+
+# ---------------------------------------------------------------------------
+# Emission
+# ---------------------------------------------------------------------------
+def enum_name(category):
+	return ''.join(part.capitalize() for part in category.split('_'))
+
+def render_header(labels):
+	return '\n'.join([
+		'// neural_model_data.h - GENERATED by ml_model/training/train_int8_model.py; do not edit.',
+		'#ifndef NEURAL_MODEL_DATA_H',
+		'#define NEURAL_MODEL_DATA_H',
+		'',
+		'#include <Arduino.h>',
+		'#include "config.h"',
+		'#include "intents.h"',
+		'',
+		'#define NEURAL_NUM_LABELS %d' % len(labels),
+		'',
+		'// Layer 1: MODEL_INPUT_SIZE -> MODEL_HIDDEN_SIZE, ReLU',
+		'extern const int8_t NEURAL_W1[MODEL_HIDDEN_SIZE][MODEL_INPUT_SIZE];',
+		'extern const int32_t NEURAL_B1[MODEL_HIDDEN_SIZE];',
+		'// Layer 2: MODEL_HIDDEN_SIZE -> NEURAL_NUM_LABELS logits',
+		'extern const int8_t NEURAL_W2[NEURAL_NUM_LABELS][MODEL_HIDDEN_SIZE];',
+		'extern const int32_t NEURAL_B2[NEURAL_NUM_LABELS];',
+		'extern const Intent NEURAL_LABEL_INTENTS[NEURAL_NUM_LABELS];',
+		'',
+		'struct NeuralQuantParams {',
+		'  int32_t hiddenMultiplier;  // layer 1 accumulator -> hidden: (acc * M + 2^(S-1)) >> S',
+		'  uint8_t hiddenShift;',
+		'  int8_t hiddenZero;',
+		'  int32_t outputMultiplier;  // layer 2 accumulator -> logits',
+		'  uint8_t outputShift;',
+		'  int8_t outputZero;',
+		'  float outputScale;         // logit = (q - outputZero) * outputScale',
+		'};',
+		'extern const NeuralQuantParams NEURAL_QUANT;',
+		'',
+		'#endif // NEURAL_MODEL_DATA_H',
+	]) + '\n'
+
+def _rows(values, per_line, fmt):
+	return ['  ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',' for i in range(0, len(values), per_line)]
+
+def render_source(q, labels):
+	o = []
+	o.append('// neural_model_data.cpp - GENERATED by ml_model/training/train_int8_model.py from')
+	o.append('// ml_model/training/artifacts/processed_dataset.json; do not edit.')
+	o.append('#include "neural_model_data.h"')
+	o.append('')
+	o.append('alignas(16) const int8_t NEURAL_W1[MODEL_HIDDEN_SIZE][MODEL_INPUT_SIZE] PROGMEM = {')
+	for row in q['w1']:
+		o.append('  {')
+		o += ['  ' + line for line in _rows(row, 16, '%4d')]
+		o.append('  },')
+	o.append('};')
+	o.append('')
+	o.append('const int32_t NEURAL_B1[MODEL_HIDDEN_SIZE] PROGMEM = {')
+	o += _rows(q['b1'], 8, '%d')
+	o.append('};')
+	o.append('')
+	o.append('alignas(16) const int8_t NEURAL_W2[NEURAL_NUM_LABELS][MODEL_HIDDEN_SIZE] PROGMEM = {')
+	for row, label in zip(q['w2'], labels):
+		o.append('  { // %s' % label)
+		o += ['  ' + line for line in _rows(row, 16, '%4d')]
+		o.append('  },')
+	o.append('};')
+	o.append('')
+	o.append('const int32_t NEURAL_B2[NEURAL_NUM_LABELS] PROGMEM = {')
+	o += _rows(q['b2'], 8, '%d')
+	o.append('};')
+	o.append('')
+	o.append('const Intent NEURAL_LABEL_INTENTS[NEURAL_NUM_LABELS] = {')
+	for label in labels:
+		o.append('  Intent::%s,' % enum_name(label))
+	o.append('};')
+	o.append('')
+	o.append('const NeuralQuantParams NEURAL_QUANT PROGMEM = {')
+	o.append('  %d, %d, %d,' % (q['m1'], q['s1'], q['h_zero']))
+	o.append('  %d, %d, %d,' % (q['m2'], q['s2'], q['z_zero']))
+	o.append('  %.9gf,' % _f32(q['z_scale']))
+	o.append('};')
+	return '\n'.join(o) + '\n'
+
+def render_golden(q, labels, texts):
+	cases = []
+	for text in texts:
+		z = int8_logits(q, featurize(text))
+		cases.append({'text': text, 'label': _argmax(z), 'logits': z})
+	lines = ',\n'.join('  ' + json.dumps(c, ensure_ascii=False) for c in cases)
+	return '{"source": "train_int8_model.py integer reference", "labels": %s, "cases": [\n%s\n]}\n' % (
+		json.dumps(labels), lines)
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--out-dir', type=pathlib.Path, default=OUT_DIR)
+	ap.add_argument('-o', '--output', type=pathlib.Path, default=GOLDEN_PATH)
+	ap.add_argument('--check', action='store_true', help='fail if an output is out of date instead of writing it')
+	args = ap.parse_args(argv)
+
+	with open(DATA_PATH, 'r', encoding='utf-8') as f:
+		payload = json.load(f)
+	labels = payload['labels']
+	if len(labels) > MODEL_OUTPUT_SIZE:
+		raise SystemExit(f'{len(labels)} labels do not fit MODEL_OUTPUT_SIZE {MODEL_OUTPUT_SIZE}')
+	texts = [s['text'] for s in payload['samples']]
+	ys = [labels.index(s['label']) for s in payload['samples']]
+	xs = [_sparse(featurize(t)) for t in texts]
+
+	net = train(xs, ys, len(labels))
+	q = quantize(net, xs)
+	outputs = {
+		args.out_dir / 'neural_model_data.h': render_header(labels),
+		args.out_dir / 'neural_model_data.cpp': render_source(q, labels),
+		args.output: render_golden(q, labels, EDGE_CASES + texts),
+	}
+	stale = [p for p, text in outputs.items() if not p.exists() or p.read_text(encoding='utf-8') != text]
+	if args.check:
+		for p in stale:
+			print(f'{p} is stale; rerun ml_model/training/train_int8_model.py', file=sys.stderr)
+		return 1 if stale else 0
+
+	float_ok = sum(_argmax(_forward(net, x)[1]) == y for x, y in zip(xs, ys))
+	int8_ok = sum(_argmax(int8_logits(q, featurize(t))) == y for t, y in zip(texts, ys))
+	print(f'[train_int8_model] {MODEL_INPUT_SIZE}-{MODEL_HIDDEN_SIZE}-{len(labels)} MLP, training accuracy '
+		f'float {float_ok}/{len(ys)}, int8 {int8_ok}/{len(ys)}')
+	for p in stale:
+		p.write_text(outputs[p], encoding='utf-8')
+		print(f'Wrote {p}')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -6,7 +6,7 @@ TF-IDF + Logistic Regression. We still emit a placeholder 'model.tflite' so the
 expected artifact path exists for firmware integration planning.
 """
 from __future__ import annotations
-import json, pathlib, joblib, datetime, hashlib
+import argparse, json, pathlib, joblib, datetime, hashlib
 from typing import List
 
 from sklearn.feature_extraction.text import TfidfVectorizer
@@ -14,14 +14,25 @@ from sklearn.linear_model import LogisticRegression
 from sklearn.pipeline import Pipeline
 from sklearn.metrics import classification_report, accuracy_score
 
+from hashed_features import HashedNgramVectorizer, MODEL_INPUT_SIZE
+from linear_golden import EDGE_CASES, long_cases, write_golden
+
 ROOT = pathlib.Path(__file__).resolve().parent.parent.parent
 ART_DIR = pathlib.Path(__file__).resolve().parent / 'artifacts'
 DATA_PATH = ART_DIR / 'processed_dataset.json'
 MODEL_DIR = ROOT / 'ml_model'
 MODEL_DIR.mkdir(exist_ok=True)
-SK_MODEL_PATH = ART_DIR / 'intent_pipeline.joblib'
+# The simulator, the exporter and linear_golden.py load the TF-IDF pipeline;
+# the hashed one is kept apart so it never replaces it.
+SK_MODEL_PATHS = {
+	'tfidf': ART_DIR / 'intent_pipeline.joblib',
+	'hashed': ART_DIR / 'intent_pipeline_hashed.joblib',
+}
 TFLITE_PLACEHOLDER = MODEL_DIR / 'model.tflite'
-META_PATH = ART_DIR / 'model_metadata.json'
+META_PATHS = {
+	'tfidf': ART_DIR / 'model_metadata.json',
+	'hashed': ART_DIR / 'model_metadata_hashed.json',
+}
 
 def load_dataset():
 	with open(DATA_PATH, 'r', encoding='utf-8') as f:
@@ -32,25 +43,39 @@ def load_dataset():
 	y = [labels.index(s['label']) for s in samples]
 	return texts, y, labels
 
-def build_pipeline():
+def build_pipeline(features: str = 'tfidf'):
+	if features == 'hashed':
+		# Same vectors as code/featurizer.cpp computes on device
+		vec = ("hashed", HashedNgramVectorizer(MODEL_INPUT_SIZE))
+	else:
+		vec = ("tfidf", TfidfVectorizer(max_features=800, ngram_range=(1,2)))
 	return Pipeline([
-		("tfidf", TfidfVectorizer(max_features=800, ngram_range=(1,2)) ),
+		vec,
 		("clf", LogisticRegression(max_iter=500))
 	])
 
 def main():
+	ap = argparse.ArgumentParser(description='Train the intent classifier')
+	ap.add_argument('--features', choices=['tfidf', 'hashed'], default='tfidf',
+		help="'hashed' matches the on-device featurizer (MODEL_INPUT_SIZE buckets) and is saved "
+			"as intent_pipeline_hashed.joblib")
+	args = ap.parse_args()
 	if not DATA_PATH.exists():
 		raise SystemExit("Processed dataset missing. Run dataset_preprocessing.py first.")
 
 	texts, y, labels = load_dataset()
-	pipe = build_pipeline()
+	pipe = build_pipeline(args.features)
 	pipe.fit(texts, y)
 	preds = pipe.predict(texts)
 	acc = accuracy_score(y, preds)
 	print(f"Training (resubstitution) accuracy: {acc:.3f}")
 
-	joblib.dump({"pipeline": pipe, "labels": labels}, SK_MODEL_PATH)
-	print(f"Saved scikit-learn model to {SK_MODEL_PATH}")
+	model_path = SK_MODEL_PATHS[args.features]
+	joblib.dump({"pipeline": pipe, "labels": labels}, model_path)
+	print(f"Saved scikit-learn model to {model_path}")
+	if args.features == 'tfidf':
+		# Reference logits for code/linear_model.cpp, straight from the pipeline
+		write_golden(pipe, labels, EDGE_CASES + texts + long_cases(texts))
 
 	# Produce metadata
 	meta = {
@@ -59,9 +84,10 @@ def main():
 		"accuracy_train": acc,
 		"backend": "scikit-learn",
 		"pipeline": [step for step,_ in pipe.steps],
+		"features": args.features,
 		"tflite_available": False
 	}
-	META_PATH.write_text(json.dumps(meta, indent=2), encoding='utf-8')
+	META_PATHS[args.features].write_text(json.dumps(meta, indent=2), encoding='utf-8')
 
 	# Emit placeholder TFLite file so downstream paths do not break
 	if not TFLITE_PLACEHOLDER.exists():
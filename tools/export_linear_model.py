@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+"""Export the scikit-learn intent pipeline as a flash-resident linear classifier.
+
+Reads ml_model/training/artifacts/intent_pipeline.joblib (TfidfVectorizer +
+multinomial LogisticRegression, as written by train_model.py) and emits
+code/linear_model_data.h/.cpp for code/linear_model.cpp:
+
+  LINEAR_TERM_HASH / LINEAR_TERM_INDEX
+                     open-addressed table: FNV-1a 32 of a vocabulary term
+                     ("fee", or "application fee" for a bigram) -> column
+  LINEAR_IDF         idf weight per column
+  LINEAR_WEIGHTS     [column][label] coefficients with idf folded in, so each
+                     query term adds one contiguous 8-float row to the logits
+  LINEAR_INTERCEPT   per-label bias
+
+The pickle is read with a small joblib-compatible unpickler, so neither
+scikit-learn nor numpy is needed to export. The same reader drives a
+reference scorer that reports training accuracy. The host parity test's
+golden logits come from scikit-learn instead (ml_model/training/linear_golden.py),
+so they check this export rather than agree with it by construction.
+"""
+
+from __future__ import annotations
+import argparse, json, math, pathlib, pickle, re, struct, sys
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+ART_DIR = ROOT / 'ml_model' / 'training' / 'artifacts'
+MODEL_PATH = ART_DIR / 'intent_pipeline.joblib'
+DATA_PATH = ART_DIR / 'processed_dataset.json'
+OUT_DIR = ROOT / 'code'
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+EMPTY_SLOT = 0xFFFF
+
+# ---------------------------------------------------------------------------
+# Minimal joblib reader
+# ---------------------------------------------------------------------------
+class _Obj:
+	def __init__(self, *args):
+		self.args = args
+
+	def __setstate__(self, state):
+		if isinstance(state, dict):
+			self.__dict__.update(state)
+		else:
+			self.state = state
+
+class _ArrayWrapper(_Obj):
+	pass
+
+class _DType(_Obj):
+	pass
+
+class Array:
+	def __init__(self, shape, values):
+		self.shape = shape
+		self.values = values
+
+	def row(self, i):
+		n = self.shape[1]
+		return self.values[i * n:(i + 1) * n]
+
+def _scalar(dtype, raw):
+	return struct.unpack('<' + _dtype_code(dtype), raw)[0]
+
+def _dtype_code(dtype):
+	kind, size = dtype.args[0][0], int(dtype.args[0][1:])
+	if getattr(dtype, 'state', (0, '<'))[1] == '>':
+		raise SystemExit('big-endian arrays are not supported')
+	return {('f', 8): 'd', ('f', 4): 'f', ('i', 8): 'q', ('i', 4): 'i', ('u', 8): 'Q', ('u', 4): 'I'}[(kind, size)]
+
+class _JoblibUnpickler(pickle._Unpickler):
+	"""Rebuilds estimators as plain attribute bags and arrays as Array."""
+
+	def find_class(self, module, name):
+		if name == 'NumpyArrayWrapper':
+			return _ArrayWrapper
+		if module.startswith('numpy') and name == 'dtype':
+			return _DType
+		if module.startswith('numpy') and name == 'scalar':
+			return _scalar
+		return type(name, (_Obj,), {})
+
+	def load_build(self):
+		super().load_build()
+		obj = self.stack[-1]
+		if not isinstance(obj, _ArrayWrapper):
+			return
+		# joblib writes the raw array right after the wrapper, preceded by a
+		# padding-length byte and padding when the array is mmap-aligned.
+		if getattr(obj, 'numpy_array_alignment_bytes', None):
+			pad = self.read(1)[0]
+			self.read(pad)
+		code = _dtype_code(obj.dtype)
+		count = 1
+		for d in obj.shape:
+			count *= d
+		raw = self.read(count * struct.calcsize(code))
+		if obj.order == 'F' and len(obj.shape) == 2:
+			rows, cols = obj.shape
+			flat = struct.unpack('<%d%s' % (count, code), raw)
+			values = [flat[c * rows + r] for r in range(rows) for c in range(cols)]
+		else:
+			values = list(struct.unpack('<%d%s' % (count, code), raw))
+		self.stack[-1] = Array(obj.shape, values)
+
+	dispatch = dict(pickle._Unpickler.dispatch)
+	dispatch[pickle.BUILD[0]] = load_build
+
+def load_pipeline(path):
+	with open(path, 'rb') as f:
+		bundle = _JoblibUnpickler(f).load()
+	steps = dict(bundle['pipeline'].steps)
+	vec, clf = steps['tfidf'], steps['clf']
+	if vec.analyzer != 'word' or not vec.lowercase or vec.token_pattern != r'(?u)\b\w\w+\b':
+		raise SystemExit('only the default word analyzer is supported')
+	if vec.norm != 'l2' or vec.sublinear_tf or vec.binary:
+		raise SystemExit('only l2-normalised raw-count tf-idf is supported')
+	vocab = sorted(vec.vocabulary_.items(), key=lambda kv: kv[1])
+	if [i for _, i in vocab] != list(range(len(vocab))):
+		raise SystemExit('vocabulary indices are not contiguous')
+	coef = clf.coef_
+	if coef.shape[0] < 3:
+		raise SystemExit('binary LogisticRegression is not supported')
+	return {
+		'terms': [t for t, _ in vocab],
+		'idf': vec._tfidf.idf_.values if vec.use_idf else [1.0] * len(vocab),
+		'coef': coef,
+		'intercept': clf.intercept_.values,
+		'labels': [bundle['labels'][c] for c in clf.classes_.values],
+		'ngram_range': tuple(vec.ngram_range),
+	}
+
+# ---------------------------------------------------------------------------
+# Reference scorer (scikit-learn semantics, float64)
+# ---------------------------------------------------------------------------
+_TOKEN = re.compile(r'(?u)\b\w\w+\b')
+
+def terms_of(text, ngram_range):
+	tokens = _TOKEN.findall(text.lower())
+	lo, hi = ngram_range
+	out = []
+	for n in range(lo, hi + 1):
+		out += [' '.join(tokens[i:i + n]) for i in range(len(tokens) - n + 1)]
+	return out
+
+def logits(model, text):
+	index = {t: i for i, t in enumerate(model['terms'])}
+	counts = {}
+	for t in terms_of(text, model['ngram_range']):
+		if t in index:
+			counts[index[t]] = counts.get(index[t], 0) + 1
+	x = {j: c * model['idf'][j] for j, c in counts.items()}
+	norm = math.sqrt(sum(v * v for v in x.values()))
+	out = list(model['intercept'])
+	if norm > 0:
+		for k in range(len(out)):
+			row = model['coef'].row(k)
+			out[k] += sum(v / norm * row[j] for j, v in x.items())
+	return out
+
+# ---------------------------------------------------------------------------
+# Emission
+# ---------------------------------------------------------------------------
+def enum_name(category):
+	return ''.join(part.capitalize() for part in category.split('_'))
+
+def fnv1a(text):
+	h = FNV_OFFSET
+	for b in text.encode('utf-8'):
+		h = ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+	return h
+
+def hash_table(terms):
+	for t in terms:
+		if not all(c.isascii() and (c.isalnum() or c in '_ ') for c in t):
+			raise SystemExit(f'vocabulary term {t!r} is not ASCII; the firmware tokenizer cannot produce it')
+	hashes = [fnv1a(t) for t in terms]
+	if len(set(hashes)) != len(hashes):
+		raise SystemExit('FNV-1a collision inside the vocabulary')
+	slots = 1
+	while slots < 2 * len(terms):
+		slots *= 2
+	table = [(0, EMPTY_SLOT)] * slots
+	for i, h in enumerate(hashes):
+		s = h & (slots - 1)
+		while table[s][1] != EMPTY_SLOT:
+			s = (s + 1) & (slots - 1)
+		table[s] = (h, i)
+	return table
+
+def _f(x):
+	return '%.9gf' % x
+
+def render_header(model, slots):
+	return '\n'.join([
+		'// linear_model_data.h - GENERATED by tools/export_linear_model.py; do not edit.',
+		'#ifndef LINEAR_MODEL_DATA_H',
+		'#define LINEAR_MODEL_DATA_H',
+		'',
+		'#include <Arduino.h>',
+		'#include "intents.h"',
+		'',
+		'#define LINEAR_NUM_TERMS %d' % len(model['terms']),
+		'#define LINEAR_NUM_LABELS %d' % len(model['labels']),
+		'#define LINEAR_HASH_SLOTS %d // power of two, linear probing' % slots,
+		'#define LINEAR_EMPTY_SLOT 0x%04X' % EMPTY_SLOT,
+		'#define LINEAR_MAX_NGRAM %d' % model['ngram_range'][1],
+		'',
+		'extern const uint32_t LINEAR_TERM_HASH[LINEAR_HASH_SLOTS];',
+		'extern const uint16_t LINEAR_TERM_INDEX[LINEAR_HASH_SLOTS];',
+		'extern const float LINEAR_IDF[LINEAR_NUM_TERMS];',
+		'extern const float LINEAR_WEIGHTS[LINEAR_NUM_TERMS][LINEAR_NUM_LABELS];',
+		'extern const float LINEAR_INTERCEPT[LINEAR_NUM_LABELS];',
+		'extern const Intent LINEAR_LABEL_INTENTS[LINEAR_NUM_LABELS];',
+		'',
+		'#endif // LINEAR_MODEL_DATA_H',
+	]) + '\n'
+
+def render_source(model, table):
+	n_labels = len(model['labels'])
+	o = []
+	o.append('// linear_model_data.cpp - GENERATED by tools/export_linear_model.py from')
+	o.append('// ml_model/training/artifacts/intent_pipeline.joblib; do not edit.')
+	o.append('#include "linear_model_data.h"')
+	o.append('')
+	o.append('const uint32_t LINEAR_TERM_HASH[LINEAR_HASH_SLOTS] PROGMEM = {')
+	for i in range(0, len(table), 6):
+		o.append('  ' + ', '.join('0x%08x' % h for h, _ in table[i:i + 6]) + ',')
+	o.append('};')
+	o.append('')
+	o.append('const uint16_t LINEAR_TERM_INDEX[LINEAR_HASH_SLOTS] PROGMEM = {')
+	for i in range(0, len(table), 12):
+		o.append('  ' + ', '.join('0x%04x' % j for _, j in table[i:i + 12]) + ',')
+	o.append('};')
+	o.append('')
+	o.append('const float LINEAR_IDF[LINEAR_NUM_TERMS] PROGMEM = {')
+	for i in range(0, len(model['idf']), 6):
+		o.append('  ' + ', '.join(_f(v) for v in model['idf'][i:i + 6]) + ',')
+	o.append('};')
+	o.append('')
+	o.append('// Rows are vocabulary terms; coef * idf, one float per label.')
+	o.append('alignas(16) const float LINEAR_WEIGHTS[LINEAR_NUM_TERMS][LINEAR_NUM_LABELS] PROGMEM = {')
+	for j, term in enumerate(model['terms']):
+		row = [model['coef'].row(k)[j] * model['idf'][j] for k in range(n_labels)]
+		o.append('  {%s}, // %s' % (', '.join(_f(v) for v in row), term))
+	o.append('};')
+	o.append('')
+	o.append('const float LINEAR_INTERCEPT[LINEAR_NUM_LABELS] PROGMEM = {')
+	o.append('  ' + ', '.join(_f(v) for v in model['intercept']) + ',')
+	o.append('};')
+	o.append('')
+	o.append('const Intent LINEAR_LABEL_INTENTS[LINEAR_NUM_LABELS] = {')
+	for label in model['labels']:
+		o.append('  Intent::%s,' % enum_name(label))
+	o.append('};')
+	return '\n'.join(o) + '\n'
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--model', type=pathlib.Path, default=MODEL_PATH)
+	ap.add_argument('--out-dir', type=pathlib.Path, default=OUT_DIR)
+	ap.add_argument('--check', action='store_true', help='fail if an output is out of date instead of writing it')
+	args = ap.parse_args(argv)
+
+	model = load_pipeline(args.model)
+	if model['ngram_range'][0] != 1 or model['ngram_range'][1] > 2:
+		raise SystemExit('only unigram and bigram vocabularies are supported')
+	table = hash_table(model['terms'])
+	with open(DATA_PATH, 'r', encoding='utf-8') as f:
+		samples = json.load(f)['samples']
+	outputs = {
+		args.out_dir / 'linear_model_data.h': render_header(model, len(table)),
+		args.out_dir / 'linear_model_data.cpp': render_source(model, table),
+	}
+	stale = [p for p, text in outputs.items() if not p.exists() or p.read_text(encoding='utf-8') != text]
+	if args.check:
+		for p in stale:
+			print(f'{p} is stale; rerun tools/export_linear_model.py', file=sys.stderr)
+		return 1 if stale else 0
+
+	correct = 0
+	for s in samples:
+		z = logits(model, s['text'])
+		correct += model['labels'][max(range(len(z)), key=z.__getitem__)] == s['label']
+	print(f'[export_linear_model] {len(model["terms"])} terms x {len(model["labels"])} labels, '
+		f'training accuracy {correct}/{len(samples)}')
+	for p in stale:
+		p.write_text(outputs[p], encoding='utf-8')
+		print(f'Wrote {p}')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Pre-render every FAQ answer to audio and pack it into a flash partition image.
+
+Every answer the responder can give (tools/gen_faq_answers.py) is static text,
+so its speech can be synthesized once at build time instead of per query. The
+answers are rendered, encoded in IMA-ADPCM frames exactly as
+esp32/audio_codec.cpp writes them, and packed into one image that
+esp32/answer_bundle.cpp memory-maps from the "answers" data partition
+(esp32/partitions.csv):
+
+  header   "TTSB", version, codec, entry count, sample rate, image bytes
+  index    one entry per answer, sorted by key: key (u64), offset (u32),
+           samples (u32); the key is TTSCache::key(text, voice)
+  audio    each answer's frames back to back, 4-byte aligned
+
+All fields are little-endian. Keys hash the exact text and voice, so an image
+left over from older answers simply misses and the device falls back to the
+network for those.
+
+The audio comes from a TTS server speaking the device's POST /tts contract
+(esp32/README_ESP32.md), given with --tts-url. --placeholder asks for a
+deterministic stand-in voice instead (a pitched burst per word, pauses at
+punctuation) so the flash path can be tested offline; such an image is not
+speech and must not be flashed.
+"""
+
+from __future__ import annotations
+import argparse, array, json, math, pathlib, struct, sys, urllib.request
+
+from gen_faq_answers import FAQ_CSV_PATH, load_answers
+from gen_keyword_automaton import FAQ_JSON_PATH, load_categories
+
+SAMPLE_RATE = 16000        # AUDIO_SAMPLE_RATE
+FRAME_SAMPLES = 512        # AUDIO_FRAME_SAMPLES
+MAGIC = 0x42535454         # "TTSB"
+VERSION = 1
+CODECS = {'pcm_s16le': 0, 'ima_adpcm': 2}   # AudioCodec values
+HEADER = struct.Struct('<IBBHII')
+ENTRY = struct.Struct('<QII')
+PARTITION_BYTES = 0x100000  # "answers" in esp32/partitions.csv
+
+IMA_STEP = [
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767,
+]
+IMA_INDEX_ADJUST = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+def answer_key(text, voice):
+	"""TTSCache::key(): FNV-1a over voice, NUL, sample rate (u32 LE), text."""
+	h = 0xcbf29ce484222325
+	for b in voice.encode('utf-8') + b'\0' + struct.pack('<I', SAMPLE_RATE) + text.encode('utf-8'):
+		h = ((h ^ b) * 0x100000001b3) & 0xffffffffffffffff
+	return h
+
+def placeholder_voice(text):
+	"""Deterministic stand-in speech: one harmonic burst per word."""
+	out = array.array('h')
+	words = text.split()
+	for n, word in enumerate(words):
+		length = int(SAMPLE_RATE * min(0.6, 0.05 + 0.045 * len(word)))
+		f0 = 110 + 9 * (sum(word.encode('utf-8')) % 8) + (20 if n == len(words) - 1 else 0)
+		w = 2 * math.pi * f0 / SAMPLE_RATE
+		for i in range(length):
+			env = math.sin(math.pi * i / length)
+			s = math.sin(w * i) + 0.5 * math.sin(2 * w * i) + 0.25 * math.sin(3 * w * i)
+			out.append(int(7000 * env * s))
+		pause = 0.25 if word[-1] in '.,;:!?' else 0.06
+		out.extend([0] * int(SAMPLE_RATE * pause))
+	return out
+
+def server_voice(url, text, voice):
+	body = json.dumps({'text': text, 'voice': voice}).encode('utf-8')
+	req = urllib.request.Request(url.rstrip('/') + '/tts', data=body, headers={'Content-Type': 'application/json'})
+	with urllib.request.urlopen(req, timeout=60) as resp:
+		data = resp.read()
+	out = array.array('h')
+	out.frombytes(data[:len(data) & ~1])
+	if sys.byteorder == 'big':
+		out.byteswap()
+	return out
+
+def encode_ima_adpcm(pcm):
+	"""AudioEncoder::encode() frame by frame; the state carries across frames."""
+	out = bytearray()
+	predictor, index = 0, 0
+	for start in range(0, len(pcm), FRAME_SAMPLES):
+		frame = pcm[start:start + FRAME_SAMPLES]
+		out += struct.pack('<hBB', predictor, index, 0)
+		packed = 0
+		for i, sample in enumerate(frame):
+			step = IMA_STEP[index]
+			diff = sample - predictor
+			nibble = 0
+			if diff < 0:
+				nibble, diff = 8, -diff
+			delta = step >> 3
+			if diff >= step: nibble |= 4; diff -= step; delta += step
+			step >>= 1
+			if diff >= step: nibble |= 2; diff -= step; delta += step
+			step >>= 1
+			if diff >= step: nibble |= 1; delta += step
+			predictor = max(-32768, min(32767, predictor - delta if nibble & 8 else predictor + delta))
+			index = max(0, min(88, index + IMA_INDEX_ADJUST[nibble & 7]))
+			if i & 1:
+				out.append(packed | nibble << 4)
+			else:
+				packed = nibble
+		if len(frame) & 1:
+			out.append(packed)
+	return bytes(out)
+
+def encode(codec, pcm):
+	if codec == 'ima_adpcm':
+		return encode_ima_adpcm(pcm)
+	data = array.array('h', pcm)
+	if sys.byteorder == 'big':
+		data.byteswap()
+	return data.tobytes()
+
+def build(texts, voice, codec, synth):
+	index = sorted({(answer_key(t, voice), t) for t in texts})
+	entries, blobs = [], []
+	offset = HEADER.size + ENTRY.size * len(index)
+	for key, text in index:
+		pcm = synth(text)
+		blob = encode(codec, pcm)
+		blob += b'\0' * (-len(blob) % 4)
+		entries.append(ENTRY.pack(key, offset, len(pcm)))
+		blobs.append(blob)
+		offset += len(blob)
+	header = HEADER.pack(MAGIC, VERSION, CODECS[codec], len(entries), SAMPLE_RATE, offset)
+	return header + b''.join(entries) + b''.join(blobs), len(entries)
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--csv', type=pathlib.Path, default=FAQ_CSV_PATH)
+	ap.add_argument('--faq', type=pathlib.Path, default=FAQ_JSON_PATH)
+	ap.add_argument('--out', type=pathlib.Path, required=True, help='partition image to write')
+	ap.add_argument('--voice', default='default', help='voice name; must match the device (TTS_VOICE)')
+	ap.add_argument('--codec', choices=sorted(CODECS), default='ima_adpcm')
+	src = ap.add_mutually_exclusive_group(required=True)
+	src.add_argument('--tts-url', help='TTS endpoint to synthesize with')
+	src.add_argument('--placeholder', action='store_true', help='tone bursts instead of speech, for tests only')
+	ap.add_argument('--max-bytes', type=lambda s: int(s, 0), default=PARTITION_BYTES, help='partition size')
+	args = ap.parse_args(argv)
+	categories = load_categories(args.faq)
+	answers = load_answers(args.csv, args.faq)
+	texts = [answers[name] for name, _ in categories] + [answers['unknown']]
+	if args.tts_url:
+		synth = lambda text: server_voice(args.tts_url, text, args.voice)
+	else:
+		synth = placeholder_voice
+	image, count = build(texts, args.voice, args.codec, synth)
+	if len(image) > args.max_bytes:
+		print(f'{len(image)} bytes of answer audio do not fit the {args.max_bytes}-byte partition', file=sys.stderr)
+		return 1
+	args.out.parent.mkdir(parents=True, exist_ok=True)
+	args.out.write_bytes(image)
+	seconds = sum(ENTRY.unpack_from(image, HEADER.size + i * ENTRY.size)[2] for i in range(count)) / SAMPLE_RATE
+	print(f'Wrote {args.out}: {count} answers, {seconds:.1f} s of audio, {len(image)} bytes')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
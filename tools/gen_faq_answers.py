@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Generate the FAQ answer table used by code/faq_responder.cpp.
+
+Answers come from database/faq.csv (first row per category wins), falling back
+to the "answer" fields of database/faq.json. Categories without an FAQ entry
+(greeting) and the Unknown fallback take their text from BUILTIN_ANSWERS. The
+table is indexed by the Intent ids from tools/gen_keyword_automaton.py and is
+emitted as PROGMEM strings in code/faq_answers.h, so the responder is a single
+array read and answers never have to be copied into RAM.
+"""
+
+from __future__ import annotations
+import argparse, csv, json, pathlib, sys
+
+from gen_keyword_automaton import FAQ_JSON_PATH, load_categories
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+FAQ_CSV_PATH = ROOT / 'database' / 'faq.csv'
+OUT_DIR = ROOT / 'code'
+
+BUILTIN_ANSWERS = {
+	'greeting': "Hello! I'm your admission assistant. How can I help you today?",
+	'unknown': "I'm sorry, I didn't understand your question. Please ask about admissions, requirements, deadlines, fees, or application process.",
+}
+
+def load_answers(csv_path, json_path):
+	answers = {}
+	if csv_path.exists():
+		with open(csv_path, newline='', encoding='utf-8') as f:
+			for row in csv.DictReader(f):
+				cat, answer = row['category'].strip(), row['answer'].strip()
+				if cat and answer:
+					answers.setdefault(cat, answer)
+	with open(json_path, 'r', encoding='utf-8') as f:
+		for faq in json.load(f)['faqs']:
+			if faq.get('answer'):
+				answers.setdefault(faq['category'], faq['answer'].strip())
+	for cat, answer in BUILTIN_ANSWERS.items():
+		answers.setdefault(cat, answer)
+	return answers
+
+def c_string(text):
+	out = []
+	for ch in text:
+		if ch in '\\"':
+			out.append('\\' + ch)
+		elif ch == '\n':
+			out.append('\\n')
+		elif ord(ch) < 0x20:
+			out.append('\\x%02x' % ord(ch))
+		else:
+			out.append(ch)
+	return '"' + ''.join(out) + '"'
+
+def render(categories, answers):
+	names = [name for name, _ in categories] + ['unknown']
+	missing = [n for n in names if n not in answers]
+	if missing:
+		raise SystemExit('no answer for categories: ' + ', '.join(missing))
+	o = []
+	o.append('// faq_answers.h - GENERATED by tools/gen_faq_answers.py from')
+	o.append('// database/faq.csv and database/faq.json; do not edit.')
+	o.append('#ifndef FAQ_ANSWERS_H')
+	o.append('#define FAQ_ANSWERS_H')
+	o.append('')
+	o.append('#include <Arduino.h>')
+	o.append('#include "intents.h"')
+	o.append('')
+	for i, name in enumerate(names):
+		o.append('static const char FAQ_ANSWER_%d[] PROGMEM = %s; // %s' % (i, c_string(answers[name]), name))
+	o.append('')
+	o.append('// Indexed by Intent; the last entry answers Intent::Unknown.')
+	o.append('static const char *const FAQ_ANSWERS[INTENT_COUNT + 1] PROGMEM = {')
+	for i in range(0, len(names), 4):
+		o.append('  ' + ', '.join('FAQ_ANSWER_%d' % j for j in range(i, min(i + 4, len(names)))) + ',')
+	o.append('};')
+	o.append('')
+	o.append('#endif // FAQ_ANSWERS_H')
+	return '\n'.join(o) + '\n'
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--csv', type=pathlib.Path, default=FAQ_CSV_PATH)
+	ap.add_argument('--faq', type=pathlib.Path, default=FAQ_JSON_PATH)
+	ap.add_argument('--out-dir', type=pathlib.Path, default=OUT_DIR)
+	ap.add_argument('--check', action='store_true', help='fail if an output is out of date instead of writing it')
+	args = ap.parse_args(argv)
+	out = args.out_dir / 'faq_answers.h'
+	text = render(load_categories(args.faq), load_answers(args.csv, args.faq))
+	stale = not out.exists() or out.read_text(encoding='utf-8') != text
+	if args.check:
+		if stale:
+			print(f'{out} is stale; rerun tools/gen_faq_answers.py', file=sys.stderr)
+		return 1 if stale else 0
+	if stale:
+		out.write_text(text, encoding='utf-8')
+		print(f'Wrote {out}')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Compile database/faq.json into the binary FAQ image read by code/faq_db.cpp.
+
+The image is laid out so it can be used in place, memory-mapped from a file
+on the host or from the "faqdb" data partition on the ESP32
+(esp32/partitions.csv). Nothing is parsed at start-up: the reader checks the
+header and takes pointers into the mapping.
+
+  header      32 bytes: "FAQD", version (u16), category count (u16),
+              FAQ count, keyword count, string pool offset, string pool bytes,
+              image bytes, FNV-1a checksum of everything after the header
+              (all u32)
+  categories  one per Intent id, then Unknown: name, answer (string refs),
+              first FAQ, FAQ count (u32 each)
+  faqs        grouped by category, in faq.json order within one: id,
+              question, answer (string refs), first keyword (u32), keyword
+              count (u16), category (u16)
+  keywords    string refs, each FAQ's keywords contiguous
+  strings     interned, NUL-terminated UTF-8; a ref is an offset into the
+              pool, which starts with the empty string
+
+All fields are little-endian and every table is 4-byte aligned. Category
+answers are the ones the firmware compiles in (tools/gen_faq_answers.py),
+so serving from the image never changes what is said.
+"""
+
+from __future__ import annotations
+import argparse, json, pathlib, struct, sys
+
+from gen_faq_answers import FAQ_CSV_PATH, load_answers
+from gen_keyword_automaton import FAQ_JSON_PATH, load_categories
+
+MAGIC = 0x44514146          # "FAQD"
+VERSION = 1
+HEADER = struct.Struct('<IHHIIIIII')
+CATEGORY = struct.Struct('<IIII')
+FAQ = struct.Struct('<IIIIHH')
+KEYWORD = struct.Struct('<I')
+PARTITION_BYTES = 0x10000   # "faqdb" in esp32/partitions.csv
+
+def fnv1a(data):
+	h = 0x811c9dc5
+	for b in data:
+		h = ((h ^ b) * 0x01000193) & 0xffffffff
+	return h
+
+class StringPool:
+	def __init__(self):
+		self.data = bytearray(b'\0')
+		self.refs = {'': 0}
+
+	def ref(self, text):
+		if text not in self.refs:
+			self.refs[text] = len(self.data)
+			self.data += text.encode('utf-8') + b'\0'
+		return self.refs[text]
+
+def build(categories, answers, faqs):
+	names = [name for name, _ in categories] + ['unknown']
+	missing = [n for n in names if n not in answers]
+	if missing:
+		raise SystemExit('no answer for categories: ' + ', '.join(missing))
+	index = {name: i for i, name in enumerate(names)}
+	unknown = [f['category'] for f in faqs if f['category'] not in index]
+	if unknown:
+		raise SystemExit('FAQs in unknown categories: ' + ', '.join(sorted(set(unknown))))
+
+	pool = StringPool()
+	by_category = [[f for f in faqs if index[f['category']] == c] for c in range(len(names))]
+	cat_table, faq_table, kw_table = bytearray(), bytearray(), bytearray()
+	first = 0
+	for c, name in enumerate(names):
+		cat_table += CATEGORY.pack(pool.ref(name), pool.ref(answers[name]), first, len(by_category[c]))
+		first += len(by_category[c])
+	for c, group in enumerate(by_category):
+		for f in group:
+			words = [w.strip() for w in f.get('keywords', []) if w.strip()]
+			faq_table += FAQ.pack(int(f.get('id', 0)), pool.ref(f.get('question', '').strip()),
+			                      pool.ref(f.get('answer', '').strip()), len(kw_table) // KEYWORD.size, len(words), c)
+			for w in words:
+				kw_table += KEYWORD.pack(pool.ref(w))
+
+	body = bytes(cat_table + faq_table + kw_table)
+	strings_offset = HEADER.size + len(body)
+	strings = bytes(pool.data) + b'\0' * (-len(pool.data) % 4)
+	total = strings_offset + len(strings)
+	payload = body + strings
+	header = HEADER.pack(MAGIC, VERSION, len(names), len(faqs), len(kw_table) // KEYWORD.size, strings_offset,
+	                     len(strings), total, fnv1a(payload))
+	return header + payload
+
+def read(image):
+	"""Decode an image back into (categories, faqs); used by --dump."""
+	magic, version, ncat, nfaq, nkw, soff, sbytes, total, checksum = HEADER.unpack_from(image)
+	if magic != MAGIC or version != VERSION or total > len(image) or fnv1a(image[HEADER.size:total]) != checksum:
+		raise ValueError('not a valid FAQ image')
+	def string(ref):
+		return image[soff + ref:image.index(b'\0', soff + ref)].decode('utf-8')
+	faq_base = HEADER.size + ncat * CATEGORY.size
+	kw_base = faq_base + nfaq * FAQ.size
+	categories = []
+	for c in range(ncat):
+		name, answer, first, count = CATEGORY.unpack_from(image, HEADER.size + c * CATEGORY.size)
+		categories.append({'name': string(name), 'answer': string(answer), 'faqs': list(range(first, first + count))})
+	faqs = []
+	for i in range(nfaq):
+		fid, question, answer, kw_first, kw_count, cat = FAQ.unpack_from(image, faq_base + i * FAQ.size)
+		words = [string(KEYWORD.unpack_from(image, kw_base + (kw_first + k) * KEYWORD.size)[0]) for k in range(kw_count)]
+		faqs.append({'id': fid, 'question': string(question), 'answer': string(answer),
+		             'category': categories[cat]['name'], 'keywords': words})
+	return categories, faqs
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--csv', type=pathlib.Path, default=FAQ_CSV_PATH)
+	ap.add_argument('--faq', type=pathlib.Path, default=FAQ_JSON_PATH)
+	ap.add_argument('--out', type=pathlib.Path, help='image to write')
+	ap.add_argument('--dump', type=pathlib.Path, help='print an existing image as JSON instead')
+	ap.add_argument('--max-bytes', type=lambda s: int(s, 0), default=PARTITION_BYTES, help='partition size')
+	args = ap.parse_args(argv)
+	if args.dump:
+		categories, faqs = read(args.dump.read_bytes())
+		json.dump({'categories': categories, 'faqs': faqs}, sys.stdout, indent=2, ensure_ascii=False)
+		print()
+		return 0
+	if not args.out:
+		ap.error('--out or --dump is required')
+	with open(args.faq, 'r', encoding='utf-8') as f:
+		faqs = json.load(f)['faqs']
+	image = build(load_categories(args.faq), load_answers(args.csv, args.faq), faqs)
+	if len(image) > args.max_bytes:
+		print(f'{len(image)}-byte FAQ image does not fit the {args.max_bytes}-byte partition', file=sys.stderr)
+		return 1
+	args.out.parent.mkdir(parents=True, exist_ok=True)
+	args.out.write_bytes(image)
+	print(f'Wrote {args.out}: {len(faqs)} FAQs, {len(image)} bytes')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""Generate the keyword Aho-Corasick automaton used by AdmissionModel.
+
+Categories and keywords come from the "keywords" arrays in database/faq.json
+(in order of first appearance), plus the conversational categories in
+BUILTIN_CATEGORIES that have no FAQ entry. The automaton is emitted as const
+PROGMEM tables in code/keyword_automaton.h (with the category ids in
+code/intents.h) so the classifier scores every
+category in one pass over the query without parsing or building anything at
+start-up. The host CMake build reruns this whenever faq.json changes; the
+header stays committed for the Arduino IDE, and --check fails if it is stale.
+
+Layout (all tables in flash):
+  KW_CHAR_CLASS      ASCII byte -> input class (upper case folded to lower;
+                     class 0 = any character that appears in no keyword)
+  KW_ROOT_NEXT       dense transition row for the root state
+  KW_EDGE_*          sparse goto edges for every other state
+  KW_FAIL            failure links
+  KW_DELTA           full DFA (state x class) for targets with flash to spare;
+                     AVR boards walk the sparse edges + failure links instead
+  KW_STATE_OUTPUT    1-based index into KW_OUTPUT_MASK (0 = no match ends here);
+                     masks are already merged along the failure chain
+  KW_CATEGORY_*      per-category keyword mask, keyword count and name
+"""
+
+from __future__ import annotations
+import argparse, collections, json, pathlib, sys
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+FAQ_JSON_PATH = ROOT / 'database' / 'faq.json'
+OUT_DIR = ROOT / 'code'
+
+# Intents the device answers that are not FAQ entries. Appended after the
+# database categories.
+BUILTIN_CATEGORIES = [
+	('greeting', ['hello', 'hi', 'hey']),
+]
+
+def load_categories(path):
+	"""Category order is the classifier's tie-break order (first wins on equal score)."""
+	with open(path, 'r', encoding='utf-8') as f:
+		faqs = json.load(f)['faqs']
+	merged = {}
+	for faq in faqs:
+		words = merged.setdefault(faq['category'], [])
+		for kw in faq.get('keywords', []):
+			kw = kw.strip().lower()
+			if kw and kw not in words:
+				words.append(kw)
+	categories = [(name, words) for name, words in merged.items() if words]
+	known = {name for name, _ in categories}
+	categories += [(name, words) for name, words in BUILTIN_CATEGORIES if name not in known]
+	return categories
+
+def build(categories):
+	keywords = []
+	for _, words in categories:
+		for w in words:
+			w = w.lower()
+			if w not in keywords:
+				keywords.append(w)
+	alphabet = sorted({c for w in keywords for c in w})
+	if any(ord(c) > 127 for c in alphabet):
+		raise SystemExit('keywords must be ASCII')
+	cls = {c: i + 1 for i, c in enumerate(alphabet)}
+
+	# Trie
+	goto = [dict()]
+	out = [0]
+	for kid, w in enumerate(keywords):
+		s = 0
+		for c in w:
+			k = cls[c]
+			if k not in goto[s]:
+				goto.append(dict())
+				out.append(0)
+				goto[s][k] = len(goto) - 1
+			s = goto[s][k]
+		out[s] |= 1 << kid
+
+	# Failure links (BFS) with outputs merged along the chain
+	fail = [0] * len(goto)
+	queue = collections.deque()
+	for k, t in goto[0].items():
+		queue.append(t)
+	while queue:
+		s = queue.popleft()
+		for k, t in sorted(goto[s].items()):
+			f = fail[s]
+			while f and k not in goto[f]:
+				f = fail[f]
+			fail[t] = goto[f].get(k, 0)
+			out[t] |= out[fail[t]]
+			queue.append(t)
+
+	cat_masks = []
+	for _, words in categories:
+		m = 0
+		for w in words:
+			m |= 1 << keywords.index(w.lower())
+		cat_masks.append(m)
+	return keywords, cls, goto, fail, out, cat_masks
+
+def c_array(values, per_line=16, fmt=str):
+	lines = []
+	for i in range(0, len(values), per_line):
+		lines.append('  ' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+	return '\n'.join(lines)
+
+def render(categories):
+	keywords, cls, goto, fail, out, cat_masks = build(categories)
+	n_states = len(goto)
+	n_classes = len(cls) + 1
+	n_kw = len(keywords)
+	if n_kw > 64:
+		raise SystemExit('more than 64 keywords; widen kw_mask_t')
+	state_t = 'uint8_t' if n_states < 256 else 'uint16_t'
+	read_state = 'pgm_read_byte' if state_t == 'uint8_t' else 'pgm_read_word'
+	mask_t = 'uint32_t' if n_kw <= 32 else 'uint64_t'
+	mask_fmt = (lambda v: '0x%08XUL' % v) if mask_t == 'uint32_t' else (lambda v: '0x%016XULL' % v)
+
+	char_class = [0] * 128
+	for c, k in cls.items():
+		char_class[ord(c)] = k
+		if c.isalpha():
+			char_class[ord(c.upper())] = k
+
+	def delta(s, k):
+		while s and k not in goto[s]:
+			s = fail[s]
+		return goto[s].get(k, 0)
+	dense = [delta(s, k) if k else 0 for s in range(n_states) for k in range(n_classes)]
+
+	root_next = [goto[0].get(k, 0) for k in range(n_classes)]
+	edge_start, edge_class, edge_next = [], [], []
+	for s in range(n_states):
+		edge_start.append(len(edge_class))
+		if s == 0:
+			continue
+		for k, t in sorted(goto[s].items()):
+			edge_class.append(k)
+			edge_next.append(t)
+	edge_start.append(len(edge_class))
+
+	masks = []
+	state_out = []
+	for m in out:
+		if m == 0:
+			state_out.append(0)
+			continue
+		if m not in masks:
+			masks.append(m)
+		state_out.append(masks.index(m) + 1)
+	if len(masks) > 255:
+		raise SystemExit('too many distinct outputs')
+
+	flash_bytes = (128 + n_classes * (1 if state_t == 'uint8_t' else 2)
+		+ 2 * len(edge_start) + len(edge_class) * (1 + (1 if state_t == 'uint8_t' else 2))
+		+ n_states * (1 if state_t == 'uint8_t' else 2) + n_states
+		+ len(masks) * (4 if mask_t == 'uint32_t' else 8)
+		+ len(categories) * ((4 if mask_t == 'uint32_t' else 8) + 1))
+
+	o = []
+	o.append('// keyword_automaton.h - GENERATED by tools/gen_keyword_automaton.py from')
+	o.append('// database/faq.json; do not edit.')
+	o.append('//')
+	o.append('// Aho-Corasick automaton over the classifier keywords, stored in flash')
+	o.append('// (%d states, %d keywords, %d categories; ~%d bytes sparse, plus a %d byte' % (n_states, n_kw, len(categories), flash_bytes, len(dense) * (1 if state_t == 'uint8_t' else 2)))
+	o.append('// dense DFA on targets other than AVR).')
+	o.append('#ifndef KEYWORD_AUTOMATON_H')
+	o.append('#define KEYWORD_AUTOMATON_H')
+	o.append('')
+	o.append('#include <Arduino.h>')
+	o.append('#include "intents.h"')
+	o.append('')
+	o.append('#define KW_NUM_CATEGORIES INTENT_COUNT')
+	o.append('#define KW_NUM_KEYWORDS   %d' % n_kw)
+	o.append('#define KW_NUM_STATES     %d' % n_states)
+	o.append('#define KW_NUM_CLASSES    %d' % n_classes)
+	o.append('')
+	o.append('typedef %s kw_state_t;' % state_t)
+	o.append('typedef %s kw_mask_t;' % mask_t)
+	o.append('#define KW_READ_STATE(p) ((kw_state_t)%s(p))' % read_state)
+	o.append('')
+	o.append('// Keywords by id (bit position in kw_mask_t):')
+	for i, w in enumerate(keywords):
+		o.append('//   %2d  "%s"' % (i, w))
+	o.append('')
+	o.append('static const uint8_t KW_CHAR_CLASS[128] PROGMEM = {')
+	o.append(c_array(char_class))
+	o.append('};')
+	o.append('')
+	o.append('static const kw_state_t KW_ROOT_NEXT[KW_NUM_CLASSES] PROGMEM = {')
+	o.append(c_array(root_next))
+	o.append('};')
+	o.append('')
+	o.append('static const uint16_t KW_EDGE_START[KW_NUM_STATES + 1] PROGMEM = {')
+	o.append(c_array(edge_start))
+	o.append('};')
+	o.append('')
+	o.append('static const uint8_t KW_EDGE_CLASS[%d] PROGMEM = {' % max(1, len(edge_class)))
+	o.append(c_array(edge_class or [0]))
+	o.append('};')
+	o.append('')
+	o.append('static const kw_state_t KW_EDGE_NEXT[%d] PROGMEM = {' % max(1, len(edge_next)))
+	o.append(c_array(edge_next or [0]))
+	o.append('};')
+	o.append('')
+	o.append('static const kw_state_t KW_FAIL[KW_NUM_STATES] PROGMEM = {')
+	o.append(c_array(fail))
+	o.append('};')
+	o.append('')
+	o.append('#ifndef __AVR__')
+	o.append('#define KW_HAS_DELTA 1')
+	o.append('static const kw_state_t KW_DELTA[KW_NUM_STATES * KW_NUM_CLASSES] PROGMEM = {')
+	o.append(c_array(dense, per_line=n_classes if n_classes <= 32 else 16))
+	o.append('};')
+	o.append('#endif')
+	o.append('')
+	o.append('static const uint8_t KW_STATE_OUTPUT[KW_NUM_STATES] PROGMEM = {')
+	o.append(c_array(state_out))
+	o.append('};')
+	o.append('')
+	o.append('static const kw_mask_t KW_OUTPUT_MASK[%d] PROGMEM = {' % max(1, len(masks)))
+	o.append(c_array(masks or [0], per_line=4, fmt=mask_fmt))
+	o.append('};')
+	o.append('')
+	o.append('static const kw_mask_t KW_CATEGORY_MASK[KW_NUM_CATEGORIES] PROGMEM = {')
+	o.append(c_array(cat_masks, per_line=4, fmt=mask_fmt))
+	o.append('};')
+	o.append('')
+	o.append('static const uint8_t KW_CATEGORY_KEYWORDS[KW_NUM_CATEGORIES] PROGMEM = {')
+	o.append(c_array([len(set(w.lower() for w in words)) for _, words in categories]))
+	o.append('};')
+	o.append('')
+	for i, (name, _) in enumerate(categories):
+		o.append('static const char KW_CATEGORY_NAME_%d[] PROGMEM = "%s";' % (i, name))
+	o.append('static const char KW_CATEGORY_NAME_UNKNOWN[] PROGMEM = "unknown";')
+	o.append('// Indexed by Intent; the last entry names Intent::Unknown.')
+	o.append('static const char *const KW_CATEGORY_NAMES[KW_NUM_CATEGORIES + 1] PROGMEM = {')
+	o.append(c_array(['KW_CATEGORY_NAME_%d' % i for i in range(len(categories))] + ['KW_CATEGORY_NAME_UNKNOWN'], per_line=4))
+	o.append('};')
+	o.append('')
+	o.append('#endif // KEYWORD_AUTOMATON_H')
+	return '\n'.join(o) + '\n'
+
+def enum_name(category):
+	return ''.join(part.capitalize() for part in category.split('_'))
+
+def render_intents(categories):
+	o = []
+	o.append('// intents.h - GENERATED by tools/gen_keyword_automaton.py from')
+	o.append('// database/faq.json; do not edit.')
+	o.append('//')
+	o.append('// Category ids returned by AdmissionModel::classify. The order matches the')
+	o.append('// keyword tables and is the classifier\'s tie-break order.')
+	o.append('#ifndef INTENTS_H')
+	o.append('#define INTENTS_H')
+	o.append('')
+	o.append('#include <stdint.h>')
+	o.append('')
+	o.append('#define INTENT_COUNT %d' % len(categories))
+	o.append('')
+	o.append('enum class Intent : uint8_t {')
+	width = max(len(enum_name(n)) for n, _ in categories + [('unknown', [])])
+	for i, (name, _) in enumerate(categories):
+		o.append('  %s = %d,' % (enum_name(name).ljust(width), i))
+	o.append('  %s = INTENT_COUNT, // below threshold / no keyword matched' % 'Unknown'.ljust(width))
+	o.append('};')
+	o.append('')
+	o.append('#endif // INTENTS_H')
+	return '\n'.join(o) + '\n'
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--faq', type=pathlib.Path, default=FAQ_JSON_PATH)
+	ap.add_argument('--out-dir', type=pathlib.Path, default=OUT_DIR)
+	ap.add_argument('--check', action='store_true', help='fail if an output is out of date instead of writing it')
+	args = ap.parse_args(argv)
+	categories = load_categories(args.faq)
+	outputs = {
+		args.out_dir / 'intents.h': render_intents(categories),
+		args.out_dir / 'keyword_automaton.h': render(categories),
+	}
+	stale = [p for p, text in outputs.items() if not p.exists() or p.read_text(encoding='utf-8') != text]
+	if args.check:
+		for p in stale:
+			print(f'{p} is stale; rerun tools/gen_keyword_automaton.py', file=sys.stderr)
+		return 1 if stale else 0
+	args.out_dir.mkdir(parents=True, exist_ok=True)
+	for p in stale:
+		p.write_text(outputs[p], encoding='utf-8')
+		print(f'Wrote {p}')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
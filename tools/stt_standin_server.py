@@ -0,0 +1,408 @@
+#!/usr/bin/env python3
+"""Local stand-in for the cloud STT/TTS bridge, for measuring the ESP32 audio paths.
+
+Implements the server side of esp32/stt_client.cpp:
+
+  POST {prefix}/stt/stream   chunked body of 16-bit PCM -> {"text": "..."}
+  GET  {prefix}/stt/ws       WebSocket: binary PCM frames up, {"partial": "..."}
+                             every --partial-every frames down; a text
+                             {"event":"end"} is answered with {"text": "..."}
+  POST {prefix}/stt/chunk    legacy: one request per frame
+  GET  {prefix}/stt/finish   legacy: ends the per-frame session -> text
+  POST {prefix}/tts          {"text": "..."} -> --tts-seconds of 16-bit PCM,
+                             streamed at real time in 20 ms chunks
+
+Audio is 16 kHz mono in the encoding named by the X-Audio-Format request
+header (esp32/audio_codec.cpp): pcm_s16le, mulaw (G.711) or ima_adpcm (4-byte
+predictor/step-index header, then low-nibble-first codes, per chunk); chunks
+are decoded as they arrive.
+
+No recognition is done; every utterance is answered with --text, and WebSocket
+partials reveal it one word at a time. For each
+stream it records what the device actually achieved: chunk count, wire
+throughput, decoded RMS level, inter-chunk gaps and per-chunk lag behind real time (wall time
+since the first chunk minus the audio duration received before it). Stats are
+printed per stream and optionally appended as JSON lines to --log.
+
+TTS responses carry a test pattern (sample i is (i * 7919) mod 2^16 as int16)
+so the client can check that every sample reached the speaker in order. Each
+chunk is delayed by up to --tts-jitter-ms, and --tts-stall-ms pauses the
+stream once half way through, to exercise the device's jitter buffer.
+
+With --run, the server listens on an ephemeral port, runs the given command
+with {url} replaced by the endpoint URL, and exits with its status (used by
+ctest). {url} is the http:// endpoint, {ws_url} the ws:// one.
+"""
+
+from __future__ import annotations
+import argparse, array, base64, hashlib, json, math, random, socket, struct, subprocess, sys, threading, time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+SAMPLE_RATE = 16000
+BYTES_PER_SAMPLE = 2
+TTS_CHUNK_MS = 20
+WS_GUID = '258EAFA5-E914-47DA-95CA-C5AB0DC85B11'
+
+IMA_STEP = [
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767,
+]
+IMA_INDEX_ADJUST = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+
+def _mulaw_sample(code):
+	code = ~code & 0xff
+	exponent, mantissa = (code >> 4) & 7, code & 0x0f
+	magnitude = (((mantissa << 3) + 0x84) << exponent) - 0x84
+	return -magnitude if code & 0x80 else magnitude
+
+MULAW_TABLE = [_mulaw_sample(c) for c in range(256)]
+
+def decode_ima_adpcm(data):
+	if len(data) < 4:
+		raise ValueError('ima_adpcm chunk shorter than its header')
+	predictor, index = struct.unpack_from('<hB', data)
+	if index > 88:
+		raise ValueError('ima_adpcm step index out of range')
+	out = array.array('h')
+	for byte in data[4:]:
+		for nibble in (byte & 0x0f, byte >> 4):
+			step = IMA_STEP[index]
+			delta = step >> 3
+			if nibble & 4: delta += step
+			if nibble & 2: delta += step >> 1
+			if nibble & 1: delta += step >> 2
+			predictor = max(-32768, min(32767, predictor - delta if nibble & 8 else predictor + delta))
+			index = max(0, min(88, index + IMA_INDEX_ADJUST[nibble]))
+			out.append(predictor)
+	return out
+
+def decode_audio(codec, data):
+	"""Decode one chunk to 16-bit samples."""
+	if codec == 'pcm_s16le':
+		out = array.array('h')
+		out.frombytes(data[:len(data) & ~1])
+		if sys.byteorder == 'big':
+			out.byteswap()
+		return out
+	if codec == 'mulaw':
+		return array.array('h', (MULAW_TABLE[b] for b in data))
+	if codec == 'ima_adpcm':
+		return decode_ima_adpcm(data)
+	raise ValueError('unsupported audio format ' + codec)
+
+CODECS = ('pcm_s16le', 'mulaw', 'ima_adpcm')
+
+def audio_codec(headers):
+	return headers.get('X-Audio-Format', 'pcm_s16le').split(';', 1)[0].strip().lower()
+
+def percentile(values, p):
+	if not values:
+		return 0.0
+	s = sorted(values)
+	return s[min(len(s) - 1, int(p * (len(s) - 1) + 0.5))]
+
+def tts_pattern(samples):
+	# Unsigned storage: same bytes as the int16 two's complement values.
+	pcm = array.array('H', ((i * 7919) & 0xffff for i in range(samples)))
+	if sys.byteorder == 'big':
+		pcm.byteswap()
+	return pcm.tobytes()
+
+class StreamStats:
+	def __init__(self, kind, codec='pcm_s16le'):
+		self.kind = kind
+		self.codec = codec
+		self.start = None
+		self.last = None
+		self.bytes = 0
+		self.samples = 0
+		self.sum_squares = 0
+		self.chunks = 0
+		self.gaps_ms = []
+		self.lag_ms = []
+		self.partials = 0
+
+	def chunk(self, data, now=None):
+		now = time.monotonic() if now is None else now
+		samples = decode_audio(self.codec, data)
+		if self.start is None:
+			self.start = now
+		else:
+			self.gaps_ms.append((now - self.last) * 1e3)
+		audio_s = self.samples / SAMPLE_RATE
+		self.lag_ms.append(((now - self.start) - audio_s) * 1e3)
+		self.last = now
+		self.bytes += len(data)
+		self.samples += len(samples)
+		self.sum_squares += sum(v * v for v in samples)
+		self.chunks += 1
+
+	def summary(self):
+		elapsed = (self.last - self.start) if self.chunks > 1 else 0.0
+		audio_s = self.samples / SAMPLE_RATE
+		return {
+			'kind': self.kind,
+			'codec': self.codec,
+			'chunks': self.chunks,
+			'bytes': self.bytes,
+			'audio_s': round(audio_s, 3),
+			'ratio': round(self.samples * BYTES_PER_SAMPLE / self.bytes, 2) if self.bytes else 0.0,
+			'rms': round(math.sqrt(self.sum_squares / self.samples), 1) if self.samples else 0.0,
+			'elapsed_s': round(elapsed, 3),
+			'throughput_kbps': round(self.bytes * 8 / elapsed / 1e3, 1) if elapsed else 0.0,
+			'gap_p50_ms': round(percentile(self.gaps_ms, 0.50), 2),
+			'gap_p99_ms': round(percentile(self.gaps_ms, 0.99), 2),
+			'gap_max_ms': round(max(self.gaps_ms, default=0.0), 2),
+			'lag_max_ms': round(max(self.lag_ms, default=0.0), 2),
+			'partials': self.partials,
+		}
+
+class Handler(BaseHTTPRequestHandler):
+	protocol_version = 'HTTP/1.1'
+	server_version = 'STTStandIn/1.0'
+
+	def log_message(self, fmt, *args):
+		if self.server.verbose:
+			super().log_message(fmt, *args)
+
+	def _route(self):
+		path = self.path.split('?', 1)[0]
+		prefix = self.server.prefix
+		return path[len(prefix):] if path.startswith(prefix) else None
+
+	def _reply(self, code, body, content_type='application/json'):
+		data = body.encode('utf-8')
+		self.send_response(code)
+		self.send_header('Content-Type', content_type)
+		self.send_header('Content-Length', str(len(data)))
+		self.end_headers()
+		self.wfile.write(data)
+
+	def _read_chunked(self, stats):
+		while True:
+			line = self.rfile.readline()
+			if not line:
+				raise ConnectionError('connection closed mid-stream')
+			size = int(line.split(b';', 1)[0].strip() or b'0', 16)
+			if size == 0:
+				# optional trailers, then the blank line
+				while self.rfile.readline() not in (b'\r\n', b'\n', b''):
+					pass
+				return
+			data = self.rfile.read(size)
+			self.rfile.readline()
+			stats.chunk(data)
+
+	def do_POST(self):
+		route = self._route()
+		if route in ('/stt/stream', '/stt/chunk') and audio_codec(self.headers) not in CODECS:
+			self.close_connection = True # the body is left unread
+			self._reply(415, '{"error":"unsupported X-Audio-Format"}')
+		elif route == '/stt/stream':
+			if 'chunked' not in self.headers.get('Transfer-Encoding', '').lower():
+				self._reply(411, '{"error":"chunked body required"}')
+				return
+			stats = StreamStats('stream', audio_codec(self.headers))
+			self._read_chunked(stats)
+			self.server.record(stats.summary())
+			self._reply(200, json.dumps({'text': self.server.text}))
+		elif route == '/tts':
+			self._tts()
+		elif route == '/stt/chunk':
+			length = int(self.headers.get('Content-Length', '0'))
+			self.server.legacy_chunk(self.client_address, audio_codec(self.headers), self.rfile.read(length))
+			self._reply(200, '{}')
+		else:
+			self._reply(404, '{"error":"not found"}')
+
+	def _tts(self):
+		length = int(self.headers.get('Content-Length', '0'))
+		try:
+			text = json.loads(self.rfile.read(length) or b'{}').get('text', '')
+		except ValueError:
+			text = ''
+		if not text:
+			self._reply(400, '{"error":"text required"}')
+			return
+		srv = self.server
+		pcm = tts_pattern(int(srv.tts_seconds * SAMPLE_RATE))
+		# Small paced writes; Nagle would batch them and hide the jitter.
+		self.connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+		self.send_response(200)
+		self.send_header('Content-Type', 'audio/L16;rate=%d' % SAMPLE_RATE)
+		self.send_header('Content-Length', str(len(pcm)))
+		self.end_headers()
+		step = TTS_CHUNK_MS * SAMPLE_RATE // 1000 * BYTES_PER_SAMPLE
+		rng = random.Random(len(pcm))
+		start = time.monotonic()
+		delay = 0.0
+		lag = []
+		for k, off in enumerate(range(0, len(pcm), step)):
+			if srv.tts_stall_ms and off >= len(pcm) // 2 and not delay:
+				delay = srv.tts_stall_ms / 1e3
+			due = start + k * TTS_CHUNK_MS / 1e3 + delay + rng.uniform(0, srv.tts_jitter_ms / 1e3)
+			wait = due - time.monotonic()
+			if wait > 0:
+				time.sleep(wait)
+			lag.append((time.monotonic() - start - k * TTS_CHUNK_MS / 1e3) * 1e3)
+			self.wfile.write(pcm[off:off + step])
+		srv.record({
+			'kind': 'tts',
+			'chars': len(text),
+			'bytes': len(pcm),
+			'audio_s': round(len(pcm) / BYTES_PER_SAMPLE / SAMPLE_RATE, 3),
+			'elapsed_s': round(time.monotonic() - start, 3),
+			'jitter_ms': srv.tts_jitter_ms,
+			'stall_ms': srv.tts_stall_ms,
+			'lag_max_ms': round(max(lag, default=0.0), 2),
+		})
+
+	def _ws_read(self):
+		head = self.rfile.read(2)
+		if len(head) < 2:
+			raise ConnectionError('connection closed mid-stream')
+		opcode, length = head[0] & 0x0f, head[1] & 0x7f
+		if length == 126:
+			length = struct.unpack('!H', self.rfile.read(2))[0]
+		elif length == 127:
+			length = struct.unpack('!Q', self.rfile.read(8))[0]
+		mask = self.rfile.read(4) if head[1] & 0x80 else None
+		data = self.rfile.read(length)
+		if mask:
+			data = bytes(b ^ mask[i & 3] for i, b in enumerate(data))
+		return opcode, data
+
+	def _ws_send(self, opcode, data):
+		n = len(data)
+		head = bytes([0x80 | opcode, n]) if n < 126 else bytes([0x80 | opcode, 126]) + struct.pack('!H', n)
+		self.wfile.write(head + data)
+		self.wfile.flush()
+
+	def _websocket(self):
+		key = self.headers.get('Sec-WebSocket-Key', '')
+		if self.headers.get('Upgrade', '').lower() != 'websocket' or not key:
+			self._reply(400, '{"error":"websocket upgrade required"}')
+			return
+		if audio_codec(self.headers) not in CODECS:
+			self._reply(415, '{"error":"unsupported X-Audio-Format"}')
+			return
+		accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode()).digest()).decode()
+		self.send_response(101, 'Switching Protocols')
+		self.send_header('Upgrade', 'websocket')
+		self.send_header('Connection', 'Upgrade')
+		self.send_header('Sec-WebSocket-Accept', accept)
+		self.end_headers()
+		self.wfile.flush()
+		self.close_connection = True
+
+		words = self.server.text.split()
+		every = self.server.partial_every
+		stats = StreamStats('websocket', audio_codec(self.headers))
+		while True:
+			opcode, data = self._ws_read()
+			if opcode == 0x2:
+				stats.chunk(data)
+				if every and stats.chunks % every == 0 and stats.partials < len(words):
+					stats.partials += 1
+					self._ws_send(0x1, json.dumps({'partial': ' '.join(words[:stats.partials])}).encode())
+			elif opcode == 0x1 and json.loads(data or b'{}').get('event') == 'end':
+				self.server.record(stats.summary())
+				self._ws_send(0x1, json.dumps({'text': self.server.text}).encode())
+			elif opcode == 0x9:
+				self._ws_send(0xA, data)
+			elif opcode == 0x8:
+				self._ws_send(0x8, data[:2])
+				return
+
+	def do_GET(self):
+		route = self._route()
+		if route == '/stt/ws':
+			self._websocket()
+		elif route == '/stt/finish':
+			self.server.legacy_finish(self.client_address)
+			self._reply(200, self.server.text, 'text/plain; charset=utf-8')
+		else:
+			self._reply(404, '{"error":"not found"}')
+
+class StandInServer(ThreadingHTTPServer):
+	daemon_threads = True
+
+	def __init__(self, addr, text, prefix='', log_path=None, verbose=False, partial_every=8,
+	             tts_seconds=2.0, tts_jitter_ms=0.0, tts_stall_ms=0.0):
+		super().__init__(addr, Handler)
+		self.text = text
+		self.partial_every = partial_every
+		self.tts_seconds = tts_seconds
+		self.tts_jitter_ms = tts_jitter_ms
+		self.tts_stall_ms = tts_stall_ms
+		self.prefix = prefix.rstrip('/')
+		self.log_path = log_path
+		self.verbose = verbose
+		self.sessions = []
+		self._legacy = {}
+		self._lock = threading.Lock()
+
+	def record(self, summary):
+		with self._lock:
+			self.sessions.append(summary)
+			print('[stt-standin] ' + ' '.join(f'{k}={v}' for k, v in summary.items()), flush=True)
+			if self.log_path:
+				with open(self.log_path, 'a', encoding='utf-8') as f:
+					f.write(json.dumps(summary) + '\n')
+
+	# Legacy sessions are keyed by client host: each frame is a new connection.
+	def legacy_chunk(self, client, codec, data):
+		with self._lock:
+			stats = self._legacy.setdefault(client[0], StreamStats('per-request', codec))
+			stats.chunk(data)
+
+	def legacy_finish(self, client):
+		with self._lock:
+			stats = self._legacy.pop(client[0], None)
+		if stats:
+			self.record(stats.summary())
+
+def main(argv=None):
+	ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	ap.add_argument('--host', default='127.0.0.1')
+	ap.add_argument('--port', type=int, default=8080)
+	ap.add_argument('--prefix', default='', help='path prefix, e.g. /api')
+	ap.add_argument('--text', default='what is the application fee', help='transcript returned for every utterance')
+	ap.add_argument('--partial-every', type=int, default=8, metavar='N', help='WebSocket: send a partial every N audio frames (0: none)')
+	ap.add_argument('--tts-seconds', type=float, default=2.0, help='length of every TTS response')
+	ap.add_argument('--tts-jitter-ms', type=float, default=0.0, metavar='MS', help='TTS: delay each 20 ms chunk by up to MS')
+	ap.add_argument('--tts-stall-ms', type=float, default=0.0, metavar='MS', help='TTS: pause once, half way through')
+	ap.add_argument('--log', help='append per-stream stats as JSON lines')
+	ap.add_argument('-v', '--verbose', action='store_true')
+	ap.add_argument('--run', nargs=argparse.REMAINDER, help='run a client command ({url} is substituted), then exit')
+	args = ap.parse_args(argv)
+
+	server = StandInServer((args.host, 0 if args.run else args.port), args.text, args.prefix, args.log, args.verbose,
+	                       args.partial_every, args.tts_seconds, args.tts_jitter_ms, args.tts_stall_ms)
+	url = 'http://%s:%d%s' % (args.host, server.server_address[1], server.prefix)
+	ws_url = 'ws' + url[4:]
+	if not args.run:
+		print(f'[stt-standin] listening on {url} and {ws_url}', flush=True)
+		try:
+			server.serve_forever()
+		except KeyboardInterrupt:
+			pass
+		return 0
+
+	thread = threading.Thread(target=server.serve_forever, daemon=True)
+	thread.start()
+	cmd = [a.replace('{url}', url).replace('{ws_url}', ws_url) for a in args.run]
+	rc = subprocess.call(cmd)
+	server.shutdown()
+	if rc == 0 and not server.sessions:
+		print('[stt-standin] client exited without completing a stream', file=sys.stderr)
+		rc = 1
+	return rc
+
+if __name__ == '__main__':
+	sys.exit(main())